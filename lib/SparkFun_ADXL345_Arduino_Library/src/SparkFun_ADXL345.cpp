@@ -740,6 +740,49 @@ byte ADXL345::get_bw_code() {
   return bw_code;
 }
 
+/****************************** FIFO ********************************/
+/*                                                                  */
+
+// Mode: ADXL345_FIFO_BYPASS ... ADXL345_FIFO_TRIGGER
+// Samples: Watermark level (or trigger position), 0 ... 31
+// Switching to bypass mode clears the FIFO.
+void ADXL345::setFIFOMode(byte mode, byte samples) {
+  writeTo(ADXL345_FIFO_CTL, ((mode & 0x03) << 6) | (samples & 0x1F));
+}
+
+// Nr of values available in the FIFO, 0 ... 32
+byte ADXL345::getFIFOEntries() {
+  byte _b;
+
+  readFrom(ADXL345_FIFO_STATUS, 1, &_b);
+  return _b & 0x3F;
+}
+
+// Read the values present in the FIFO, at most maxEntries.
+// Each value (x, y, z) must be read as a separate 6 byte read of the data registers,
+// which pops it from the FIFO.
+// Returns the nr of values stored in xyz (3 int16_t per value).
+int ADXL345::readFIFO(int16_t *xyz, int maxEntries) {
+  int entries = getFIFOEntries();
+
+  if (entries > maxEntries) {
+    entries = maxEntries;
+  }
+
+  for (int i = 0; i < entries; i++) {
+    readFrom(ADXL345_DATAX0, ADXL345_TO_READ, _buff);
+    *xyz++ = (int16_t)((((int)_buff[1]) << 8) | _buff[0]);
+    *xyz++ = (int16_t)((((int)_buff[3]) << 8) | _buff[2]);
+    *xyz++ = (int16_t)((((int)_buff[5]) << 8) | _buff[4]);
+
+    if (!I2C) {
+      // At least 5 usec between the end of a read and the next read of the FIFO
+      delayMicroseconds(5);
+    }
+  }
+  return entries;
+}
+
 /************************* TRIGGER CHECK  ***************************/
 /*                                                                  */
 
@@ -54,6 +54,12 @@
 # define ADXL345_FIFO_CTL                0x38         // FIFO Control
 # define ADXL345_FIFO_STATUS             0x39         // FIFO Status
 
+# define ADXL345_FIFO_BYPASS             0x00         // FIFO is bypassed
+# define ADXL345_FIFO_FIFO               0x01         // Collects up to 32 values, then stops
+# define ADXL345_FIFO_STREAM             0x02         // Holds the last 32 values
+# define ADXL345_FIFO_TRIGGER            0x03         // Holds the last 'samples' values before a trigger event
+# define ADXL345_FIFO_SIZE               32
+
 # define ADXL345_BW_1600                 0xF          // 1111		IDD = 40uA
 # define ADXL345_BW_800                  0xE          // 1110		IDD = 90uA
 # define ADXL345_BW_400                  0xD          // 1101		IDD = 140uA
@@ -239,6 +245,12 @@ public:
   void setJustifyBit(bool justifyBit);
   void printAllRegister();
 
+  void setFIFOMode(byte mode,
+                   byte samples = 0);
+  byte getFIFOEntries();
+  int  readFIFO(int16_t *xyz,
+                int      maxEntries);
+
 private:
 
   void writeTo(byte address,
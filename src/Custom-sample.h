@@ -186,6 +186,7 @@
 // #define PLUGIN_USES_ADAFRUITGFX // Used by Display plugins using Adafruit GFX library
 // #define ADAGFX_ARGUMENT_VALIDATION  0 // Disable argument validation in AdafruitGFX_helper
 // #define ADAGFX_SUPPORT_7COLOR  0 // Disable the support of 7-color eInk displays by AdafruitGFX_helper
+// #define USES_CONTROLLER_WORKER // ESP32 only: run HTTP/UDP controller sends on a worker task on the other core
 
 
 #ifdef USE_CUSTOM_PROVISIONING
@@ -17,11 +17,18 @@
 
 WiFiUDP C013_portUDP;
 
+C013_DeltaSender   C013_deltaSender;
+C013_DeltaReceiver C013_deltaReceiver;
+
 // Forward declarations
 void C013_SendUDPTaskInfo(uint8_t destUnit, uint8_t sourceTaskIndex, uint8_t destTaskIndex);
 void C013_SendUDPTaskData(uint8_t destUnit, uint8_t sourceTaskIndex, uint8_t destTaskIndex);
+void C013_SendUDPDeltaData();
+void C013_SendUDPDataPullRequest(uint8_t destUnit, uint8_t sourceTaskIndex, uint8_t destTaskIndex);
+bool C013_nodeSupportsDeltaData(uint8_t unit);
 void C013_sendUDP(uint8_t unit, const uint8_t *data, uint8_t size);
 void C013_Receive(struct EventStruct *event);
+void C013_ReceiveDeltaData(struct EventStruct *event);
 
 
 bool CPlugin_013(CPlugin::Function function, struct EventStruct *event, String& string)
@@ -52,6 +59,7 @@ bool CPlugin_013(CPlugin::Function function, struct EventStruct *event, String&
     case CPlugin::Function::CPLUGIN_TASK_CHANGE_NOTIFICATION:
     {
       C013_SendUDPTaskInfo(0, event->TaskIndex, event->TaskIndex);
+      C013_deltaSender.markFullUpdate(event->TaskIndex);
       break;
     }
 
@@ -67,14 +75,13 @@ bool CPlugin_013(CPlugin::Function function, struct EventStruct *event, String&
       break;
     }
 
-    /*
-        case CPlugin::Function::CPLUGIN_FLUSH:
-          {
-            process_c013_delay_queue(event->ControllerIndex);
-            delay(0);
-            break;
-          }
-     */
+    case CPlugin::Function::CPLUGIN_TEN_PER_SECOND:
+    case CPlugin::Function::CPLUGIN_FLUSH:
+    {
+      // Send all task data collected since the last call in as few packets as possible.
+      C013_SendUDPDeltaData();
+      break;
+    }
 
     default:
       break;
@@ -149,21 +156,82 @@ void C013_SendUDPTaskData(uint8_t destUnit, uint8_t sourceTaskIndex, uint8_t des
     }
   }
 
+  // Nodes supporting delta data get the values batched via C013_SendUDPDeltaData()
+  bool queueDeltaData = false;
+  bool sentLegacyData = false;
+
   if (destUnit != 0)
   {
-    dataReply.destUnit = destUnit;
-    C013_sendUDP(destUnit, reinterpret_cast<const uint8_t *>(&dataReply), sizeof(C013_SensorDataStruct));
-    delay(10);
+    if (C013_nodeSupportsDeltaData(destUnit)) {
+      queueDeltaData = true;
+    } else {
+      dataReply.destUnit = destUnit;
+      C013_sendUDP(destUnit, reinterpret_cast<const uint8_t *>(&dataReply), sizeof(C013_SensorDataStruct));
+      sentLegacyData = true;
+      delay(10);
+    }
   } else {
     for (auto it = Nodes.begin(); it != Nodes.end(); ++it) {
       if (it->first != Settings.Unit) {
-        dataReply.destUnit = it->first;
-        C013_sendUDP(it->first, reinterpret_cast<const uint8_t *>(&dataReply), sizeof(C013_SensorDataStruct));
-        delay(10);
+        if (C013_nodeSupportsDeltaData(it->first)) {
+          queueDeltaData = true;
+        } else {
+          dataReply.destUnit = it->first;
+          C013_sendUDP(it->first, reinterpret_cast<const uint8_t *>(&dataReply), sizeof(C013_SensorDataStruct));
+          sentLegacyData = true;
+          delay(10);
+        }
       }
     }
   }
-  delay(50);
+
+  if (queueDeltaData) {
+    C013_deltaSender.queueTask(sourceTaskIndex, destTaskIndex, dataReply.Values);
+  }
+
+  if (sentLegacyData) {
+    delay(50);
+  }
+}
+
+/*********************************************************************************************\
+   Send all pending task data as batched delta packets to all nodes supporting it.
+   A single broadcast replaces a unicast packet per node per task.
+\*********************************************************************************************/
+void C013_SendUDPDeltaData()
+{
+  if (!C013_deltaSender.hasPending()) {
+    return;
+  }
+
+  if (!NetworkConnected(10)) {
+    return;
+  }
+  uint8_t data[C013_DELTA_MAX_PACKET_SIZE];
+  size_t  size = 0;
+
+  while ((size = C013_deltaSender.buildPacket(Settings.Unit, 255, data, sizeof(data))) > 0) {
+    C013_sendUDP(255, data, size);
+  }
+}
+
+void C013_SendUDPDataPullRequest(uint8_t destUnit, uint8_t sourceTaskIndex, uint8_t destTaskIndex)
+{
+  // Same header layout as C013_SensorDataStruct.
+  // sourceTaskIndex is the task on this node, destTaskIndex the task on the remote node.
+  const uint8_t data[6] = { 255, C013_MSG_ID_DATA_PULL, Settings.Unit, destUnit, sourceTaskIndex, destTaskIndex };
+
+  C013_sendUDP(destUnit, data, sizeof(data));
+}
+
+bool C013_nodeSupportsDeltaData(uint8_t unit)
+{
+  auto it = Nodes.find(unit);
+
+  if (it == Nodes.end()) {
+    return false;
+  }
+  return (it->second.p2p_capabilities & C013_P2P_CAP_DELTA_DATA) != 0;
 }
 
 /*********************************************************************************************\
@@ -276,9 +344,12 @@ void C013_Receive(struct EventStruct *event) {
       break;
     }
 
-    case 4: // sensor data pull request
+    case C013_MSG_ID_DATA_PULL: // sensor data pull request
     {
-      // SendUDPTaskData(packetBuffer[2], packetBuffer[5], packetBuffer[4]);
+      // Only sent by nodes supporting delta data, to request a full update after a missed packet.
+      if ((event->Data[3] == Settings.Unit) && validTaskIndex(event->Data[5])) {
+        C013_deltaSender.markFullUpdate(event->Data[5]);
+      }
       break;
     }
 
@@ -309,6 +380,71 @@ void C013_Receive(struct EventStruct *event) {
       }
       break;
     }
+
+    case C013_MSG_ID_DELTA_DATA: // batched delta sensor data
+    {
+      C013_ReceiveDeltaData(event);
+      break;
+    }
+  }
+}
+
+void C013_ReceiveDeltaData(struct EventStruct *event) {
+  const int len = event->Par2;
+
+  if (len < C013_DELTA_HEADER_SIZE) { return; }
+  const uint8_t sourceUnit = event->Data[2];
+  const uint8_t destUnit   = event->Data[3];
+
+  if ((destUnit != 255) && (destUnit != Settings.Unit)) { return; }
+
+  const uint8_t entryCount = event->Data[4];
+  int pos                  = C013_DELTA_HEADER_SIZE;
+
+  for (uint8_t entry = 0; entry < entryCount; ++entry) {
+    if ((pos + C013_DELTA_ENTRY_HEADER_SIZE) > len) { return; }
+    const uint8_t sourceTaskIndex = event->Data[pos];
+    const uint8_t destTaskIndex   = event->Data[pos + 1];
+    const uint8_t sequence        = event->Data[pos + 2];
+    const uint8_t valueMask       = event->Data[pos + 3];
+    pos += C013_DELTA_ENTRY_HEADER_SIZE;
+
+    int entrySize = 0;
+
+    for (uint8_t x = 0; x < VARS_PER_TASK; x++) {
+      if (valueMask & (1 << x)) { entrySize += sizeof(float); }
+    }
+
+    if ((pos + entrySize) > len) { return; }
+    const uint8_t *entryValues = &event->Data[pos];
+    pos += entrySize;
+
+    if (!validTaskIndex(sourceTaskIndex) || !validTaskIndex(destTaskIndex)) { continue; }
+
+    // only if this task has a remote feed, update values
+    const uint8_t remoteFeed = Settings.TaskDeviceDataFeed[destTaskIndex];
+
+    if ((remoteFeed == 0) || (remoteFeed != sourceUnit)) { continue; }
+
+    float values[VARS_PER_TASK];
+
+    for (uint8_t x = 0; x < VARS_PER_TASK; x++) {
+      values[x] = UserVar[destTaskIndex * VARS_PER_TASK + x];
+    }
+
+    if (!C013_deltaReceiver.applyEntry(destTaskIndex, sequence, valueMask, entryValues, values)) {
+      // Missed a packet, some values may be outdated.
+      C013_SendUDPDataPullRequest(sourceUnit, destTaskIndex, sourceTaskIndex);
+    }
+
+    for (uint8_t x = 0; x < VARS_PER_TASK; x++) {
+      UserVar[destTaskIndex * VARS_PER_TASK + x] = values[x];
+    }
+
+    if (Settings.UseRules) {
+      struct EventStruct TempEvent(destTaskIndex);
+      createRuleEvents(&TempEvent);
+    }
   }
 }
 
@@ -8,9 +8,9 @@
 //
 // Make sure physical connections are electrically well sepparated so no crossover of the signals happen.
 // Especially at rates above ~5'000 RPM with longer lines. Best use a cable with ground and signal twisted.
-// The Mode Types "PULSE low/high/change" are suited for low frequence pulses but for and precise counting
-// with pulse rates of less than 750 RPM with DebounceTime > 20ms and pulse length > 40ms. This type may
-// tolerate less good signals. After a pulse and debounce time it verifies the signal 3 times.
+// The Mode Types "PULSE low/high/change" are suited for precise counting of pulses with noisy signals.
+// The ISR only records the timestamp of each signal edge, a new state is accepted when it lasted
+// at least the DebounceTime without any further edge.
 
 
 # include "src/PluginStructs/P003_data_struct.h"
@@ -74,6 +74,7 @@ boolean Plugin_003(uint8_t function, struct EventStruct *event, String& string)
       Device[deviceCount].SendDataOption     = true;
       Device[deviceCount].TimerOption        = true;
       Device[deviceCount].GlobalSyncOption   = true;
+      Device[deviceCount].FiftyPerSecond     = true;
       break;
     }
 
@@ -116,6 +117,17 @@ boolean Plugin_003(uint8_t function, struct EventStruct *event, String& string)
         F("p003_raisetype"), 
         static_cast<Internal_GPIO_pulseHelper::GPIOtriggerMode>(PCONFIG(P003_IDX_MODETYPE)));
 
+      {
+        P003_data_struct *P003_data =
+          static_cast<P003_data_struct *>(getPluginTaskData(event->TaskIndex));
+
+        if (nullptr != P003_data) {
+          addRowLabel(F("Dropped edges"));
+          addHtmlInt(static_cast<uint32_t>(P003_data->pulseHelper.getEdgeOverflowCount()));
+          addFormNote(F("Signal edges lost in PULSE modes, because the edge buffer was full. May be caused by a noisy signal or a very high pulse rate."));
+        }
+      }
+
       success = true;
       break;
     }
@@ -332,24 +344,11 @@ boolean Plugin_003(uint8_t function, struct EventStruct *event, String& string)
         static_cast<P003_data_struct *>(getPluginTaskData(event->TaskIndex));
 
       if (nullptr != P003_data) {
-        // step 0 will check if a new signal edge is to be processed and then schedule step 1
-        P003_data->pulseHelper.doPulseStepProcessing(GPIO_PULSE_HELPER_PROCESSING_STEP_0);
+        // debounce and count the signal edges recorded by the ISR since the last call
+        P003_data->pulseHelper.doPulseProcessing();
       }
       break;
     }
-
-    case PLUGIN_TIMER_IN:
-    {
-      P003_data_struct *P003_data =
-        static_cast<P003_data_struct *>(getPluginTaskData(event->TaskIndex));
-
-      if (nullptr != P003_data) {
-        // this function is called when the next (1,2,3) processing step (Par1) is scheduled
-        P003_data->pulseHelper.doPulseStepProcessing(event->Par1);
-      }
-
-      break;
-    }
   }
   return success;
 }
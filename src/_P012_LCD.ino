@@ -50,6 +50,7 @@ boolean Plugin_012(uint8_t function, struct EventStruct *event, String& string)
       Device[deviceCount].ValueCount         = 0;
       Device[deviceCount].SendDataOption     = false;
       Device[deviceCount].TimerOption        = true;
+      Device[deviceCount].TenPerSecond       = true;
       break;
     }
 
@@ -147,6 +148,9 @@ boolean Plugin_012(uint8_t function, struct EventStruct *event, String& string)
 
     case PLUGIN_INIT:
     {
+      addTaskCommand(event->TaskIndex, F("lcd"));
+      addTaskCommand(event->TaskIndex, F("lcdcmd"));
+
       initPluginTaskData(event->TaskIndex, new (std::nothrow) P012_data_struct(P012_I2C_ADDR, P012_SIZE, P012_MODE, P012_TIMER));
       P012_data_struct *P012_data =
         static_cast<P012_data_struct *>(getPluginTaskData(event->TaskIndex));
@@ -55,6 +55,7 @@ boolean                    Plugin_013(uint8_t function, struct EventStruct *even
       Device[deviceCount].SendDataOption     = true;
       Device[deviceCount].TimerOption        = true;
       Device[deviceCount].GlobalSyncOption   = true;
+      Device[deviceCount].TenPerSecond       = true;
 
       break;
     }
@@ -184,6 +184,7 @@ boolean Plugin_016(uint8_t function, struct EventStruct *event, String& string)
       Device[deviceCount].SendDataOption     = true;
       Device[deviceCount].TimerOption        = false;
       Device[deviceCount].TimerOptional      = true;
+      Device[deviceCount].TenPerSecond = true;
       break;
     }
 
@@ -57,6 +57,7 @@ boolean Plugin_020(uint8_t function, struct EventStruct *event, String& string)
       Device[deviceCount].SendDataOption     = true;
       Device[deviceCount].TimerOption        = false;
       Device[deviceCount].GlobalSyncOption   = false;
+      Device[deviceCount].FiftyPerSecond     = true;
       break;
     }
     case PLUGIN_GET_DEVICENAME:
@@ -193,7 +194,7 @@ boolean Plugin_020(uint8_t function, struct EventStruct *event, String& string)
       // serial0 on esp32 is Ser2net: port=2 rxPin=3 txPin=1; serial1 on esp32 is Ser2net: port=4 rxPin=13 txPin=15; Serial2 on esp32 is
       // Ser2net: port=4 rxPin=16 txPin=17
       uint8_t serialconfig = serialHelper_convertOldSerialConfig(P020_SERIAL_CONFIG);
-      task->serialBegin(port, rxPin, txPin, P020_BAUDRATE, serialconfig);
+      task->serialBegin(port, rxPin, txPin, P020_BAUDRATE, serialconfig, P020_RX_WAIT, P020_RX_BUFFER);
       task->startServer(P020_SERVER_PORT);
 
       if (!task->isInit()) {
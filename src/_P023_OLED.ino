@@ -38,6 +38,7 @@ boolean Plugin_023(uint8_t function, struct EventStruct *event, String& string)
       Device[deviceCount].ValueCount         = 0;
       Device[deviceCount].SendDataOption     = false;
       Device[deviceCount].TimerOption        = true;
+      Device[deviceCount].TenPerSecond       = true;
       break;
     }
 
@@ -145,6 +146,9 @@ boolean Plugin_023(uint8_t function, struct EventStruct *event, String& string)
 
     case PLUGIN_INIT:
     {
+      addTaskCommand(event->TaskIndex, F("oled"));
+      addTaskCommand(event->TaskIndex, F("oledcmd"));
+
       uint8_t address                           = PCONFIG(0);
       uint8_t type                              = 0;
       P023_data_struct::Spacing font_spacing = P023_data_struct::Spacing::normal;
@@ -167,8 +167,16 @@ boolean Plugin_025(uint8_t function, struct EventStruct *event, String& string)
       P025_data_struct *P025_data =
         static_cast<P025_data_struct *>(getPluginTaskData(event->TaskIndex));
 
-      if (nullptr != P025_data) {
-        const int16_t value = P025_data->read();
+      if (nullptr == P025_data) {
+        break;
+      }
+      int16_t value = 0;
+
+      if (!P025_data->getResult(event->TaskIndex, value)) {
+        // No result yet, start a conversion.
+        // PLUGIN_READ is called again as soon as the result has been read.
+        P025_data->startConversion(event->TaskIndex);
+      } else {
         UserVar[event->BaseVarIndex] = value;
 
         #ifndef BUILD_NO_DEBUG
@@ -210,6 +218,18 @@ boolean Plugin_025(uint8_t function, struct EventStruct *event, String& string)
       }
       break;
     }
+
+    case PLUGIN_TIMER_IN:
+    {
+      if (I2C_async_isTimer(event->TaskIndex, event->Par1)) {
+        if (I2C_async_getState(event->TaskIndex) == I2C_async_state_e::Ready) {
+          // Conversion result has been read, have it processed by PLUGIN_READ.
+          Scheduler.schedule_task_device_timer(event->TaskIndex, millis());
+        }
+        success = true;
+      }
+      break;
+    }
   }
   return success;
 }
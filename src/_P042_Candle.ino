@@ -118,6 +118,7 @@ boolean Plugin_042(uint8_t function, struct EventStruct *event, String& string)
         Device[deviceCount].SendDataOption = true;
         Device[deviceCount].TimerOption = true;
         Device[deviceCount].GlobalSyncOption = false;
+        Device[deviceCount].FiftyPerSecond = true;
         break;
       }
 
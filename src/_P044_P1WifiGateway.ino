@@ -41,6 +41,7 @@ boolean Plugin_044(uint8_t function, struct EventStruct *event, String& string)
         Device[deviceCount].Type = DEVICE_TYPE_SINGLE;
         Device[deviceCount].Custom = true;
         Device[deviceCount].TimerOption = false;
+        Device[deviceCount].TenPerSecond = true;
         break;
       }
 
@@ -130,12 +131,12 @@ boolean Plugin_044(uint8_t function, struct EventStruct *event, String& string)
           #ifndef BUILD_NO_DEBUG
           addLog(LOG_LEVEL_DEBUG, F("P1   : DSMR version 4 meter, CRC on"));
           #endif
-          task->CRCcheck = true;
+          task->setCRCcheck(true);
         } else {
           #ifndef BUILD_NO_DEBUG
           addLog(LOG_LEVEL_DEBUG, F("P1   : DSMR version 4 meter, CRC off"));
           #endif
-          task->CRCcheck = false;
+          task->setCRCcheck(false);
         }
 
         success = true;
@@ -52,6 +52,7 @@ boolean Plugin_053(uint8_t function, struct EventStruct *event, String& string)
       Device[deviceCount].SendDataOption   = true;
       Device[deviceCount].TimerOption      = true;
       Device[deviceCount].GlobalSyncOption = true;
+      Device[deviceCount].TenPerSecond = true;
       success                              = true;
       break;
     }
@@ -300,6 +301,8 @@ boolean Plugin_053(uint8_t function, struct EventStruct *event, String& string)
 
     case PLUGIN_INIT:
     {
+      addTaskCommand(event->TaskIndex, F("pmsx003"));
+
       const int8_t rxPin            = CONFIG_PIN1;
       const int8_t txPin            = CONFIG_PIN2;
       const  ESPEasySerialPort port = static_cast<ESPEasySerialPort>(CONFIG_PORT);
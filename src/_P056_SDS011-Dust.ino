@@ -46,6 +46,7 @@ boolean Plugin_056(uint8_t function, struct EventStruct *event, String& string)
         Device[deviceCount].TimerOption = true;
         Device[deviceCount].TimerOptional = false;
         Device[deviceCount].GlobalSyncOption = true;
+        Device[deviceCount].FiftyPerSecond = true;
         break;
       }
 
@@ -92,6 +92,7 @@ boolean Plugin_057(uint8_t function, struct EventStruct *event, String& string)
       Device[deviceCount].TimerOption        = false;
       Device[deviceCount].TimerOptional      = false;
       Device[deviceCount].GlobalSyncOption   = true;
+      Device[deviceCount].TenPerSecond       = true;
       break;
     }
 
@@ -155,6 +156,12 @@ boolean Plugin_057(uint8_t function, struct EventStruct *event, String& string)
 
     case PLUGIN_INIT:
     {
+      addTaskCommand(event->TaskIndex, F("mprint"));
+      addTaskCommand(event->TaskIndex, F("mbr"));
+      addTaskCommand(event->TaskIndex, F("m"));
+      addTaskCommand(event->TaskIndex, F("mx"));
+      addTaskCommand(event->TaskIndex, F("mnum"));
+
       uint8_t address = PCONFIG(0);
 
       initPluginTaskData(event->TaskIndex, new (std::nothrow) P057_data_struct(address));
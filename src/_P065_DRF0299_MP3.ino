@@ -99,6 +99,13 @@ boolean Plugin_065(uint8_t function, struct EventStruct *event, String& string)
 
     case PLUGIN_INIT:
     {
+      addTaskCommand(event->TaskIndex, F("play"));
+      addTaskCommand(event->TaskIndex, F("stop"));
+      addTaskCommand(event->TaskIndex, F("vol"));
+      addTaskCommand(event->TaskIndex, F("eq"));
+      addTaskCommand(event->TaskIndex, F("mode"));
+      addTaskCommand(event->TaskIndex, F("repeat"));
+
       # pragma GCC diagnostic push
 
       // note: we cant fix this, its a upstream bug.
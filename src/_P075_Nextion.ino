@@ -123,6 +123,7 @@ boolean Plugin_075(uint8_t function, struct EventStruct *event, String& string)
       Device[deviceCount].GlobalSyncOption = true;
       // FIXME TD-er: Not sure if access to any existing task data is needed when saving
       Device[deviceCount].ExitTaskBeforeSave = false;
+      Device[deviceCount].TenPerSecond = true;
 
       break;
     }
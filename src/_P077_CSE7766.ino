@@ -197,6 +197,7 @@ boolean Plugin_077(uint8_t function, struct EventStruct *event, String &string)
     Device[deviceCount].TimerOption = true;
     Device[deviceCount].TimerOptional = true;
     Device[deviceCount].GlobalSyncOption = true;
+    Device[deviceCount].TenPerSecond = true;
     break;
   }
 
@@ -10,6 +10,11 @@
 // Based on the library TinyGPS++
 // http://arduiniana.org/libraries/tinygpsplus/
 //
+// Serial data is read in bulk and split into NMEA sentences and u-blox UBX frames by SerialIngest.
+// Only NMEA sentences decoded by TinyGPS++ are passed on to it.
+// Optionally fixes are recorded in a track buffer (also from UBX NAV-PVT),
+// which is sent to the controllers as a simplified track.
+//
 //
 
 #include <ESPeasySerial.h>
@@ -49,6 +54,8 @@
 # define P082_POWER_MODE     PCONFIG(7)
 # define P082_DYNAMIC_MODEL  PCONFIG_LONG(0)
 #endif // P082_USE_U_BLOX_SPECIFIC
+# define P082_TRACK_SIZE      PCONFIG_LONG(1)
+# define P082_TRACK_TOLERANCE PCONFIG_FLOAT(2)
 
 # define P082_NR_OUTPUT_VALUES   VARS_PER_TASK
 # define P082_QUERY1_CONFIG_POS  3
@@ -80,6 +87,7 @@ boolean Plugin_082(uint8_t function, struct EventStruct *event, String& string)
       Device[deviceCount].SendDataOption     = true;
       Device[deviceCount].TimerOption        = true;
       Device[deviceCount].GlobalSyncOption   = true;
+      Device[deviceCount].FiftyPerSecond     = true;
       break;
     }
 
@@ -288,6 +296,16 @@ boolean Plugin_082(uint8_t function, struct EventStruct *event, String& string)
       addUnit('m');
       addFormNote(F("0 = disable update based on distance travelled"));
 
+      addFormSubHeader(F("Track"));
+
+      addFormNumericBox(F("Track Buffer Size"), F("track_size"), P082_TRACK_SIZE, 0, P082_TRACK_MAX_SIZE);
+      addUnit(F("fixes"));
+      addFormNote(F("0 = disabled. All fixes are recorded and sent as simplified track on each update"));
+
+      addFormFloatNumberBox(F("Track Tolerance"), F("track_tol"), P082_TRACK_TOLERANCE, 0.0f, 1000.0f);
+      addUnit('m');
+      addFormNote(F("Fixes closer than this to the simplified track are not sent"));
+
       success = true;
       break;
     }
@@ -303,6 +321,9 @@ boolean Plugin_082(uint8_t function, struct EventStruct *event, String& string)
       P082_LONG_REF = getFormItemFloat(F("lng_ref"));
       P082_LAT_REF  = getFormItemFloat(F("lat_ref"));
 
+      P082_TRACK_SIZE      = getFormItemInt(F("track_size"));
+      P082_TRACK_TOLERANCE = getFormItemFloat(F("track_tol"));
+
       // Save output selector parameters.
       for (int i = 0; i < P082_NR_OUTPUT_VALUES; ++i) {
         const uint8_t pconfigIndex = i + P082_QUERY1_CONFIG_POS;
@@ -338,6 +359,10 @@ boolean Plugin_082(uint8_t function, struct EventStruct *event, String& string)
           //          pinMode(pps_pin, INPUT_PULLUP);
           attachInterrupt(pps_pin, Plugin_082_interrupt, RISING);
         }
+
+        if (!P082_data->initTrack(P082_TRACK_SIZE)) {
+          addLog(LOG_LEVEL_ERROR, F("GPS  : Not enough memory for track buffer"));
+        }
         #ifdef P082_USE_U_BLOX_SPECIFIC
         P082_data->setPowerMode(static_cast<P082_PowerMode>(P082_POWER_MODE));
         P082_data->setDynamicModel(static_cast<P082_DynamicModel>(P082_DYNAMIC_MODEL));        
@@ -373,6 +398,9 @@ boolean Plugin_082(uint8_t function, struct EventStruct *event, String& string)
         Scheduler.schedule_task_device_timer(event->TaskIndex, millis());
         delay(0); // Processing a full sentence may take a while, run some
                   // background tasks.
+      } else if ((nullptr != P082_data) && P082_data->track.isFull()) {
+        // Only UBX fixes received, still need to send the track before the oldest fix is overwritten.
+        Scheduler.schedule_task_device_timer(event->TaskIndex, millis());
       }
       success = true;
       break;
@@ -440,7 +468,7 @@ boolean Plugin_082(uint8_t function, struct EventStruct *event, String& string)
         P082_setOutputValue(event, static_cast<uint8_t>(P082_query::P082_QUERY_HDOP),        P082_data->gps->hdop.value() / 100.0f);
         P082_setOutputValue(event, static_cast<uint8_t>(P082_query::P082_QUERY_FIXQ),        P082_data->gps->location.Quality());
         P082_setOutputValue(event, static_cast<uint8_t>(P082_query::P082_QUERY_DB_MAX),      P082_data->gps->satellitesStats.getBestSNR());
-        P082_setOutputValue(event, static_cast<uint8_t>(P082_query::P082_QUERY_CHKSUM_FAIL), P082_data->gps->failedChecksum());
+        P082_setOutputValue(event, static_cast<uint8_t>(P082_query::P082_QUERY_CHKSUM_FAIL), P082_data->failedChecksum());
 
 
         if (curFixStatus) {
@@ -448,6 +476,12 @@ boolean Plugin_082(uint8_t function, struct EventStruct *event, String& string)
         }
         P082_logStats(event);
 
+        if (P082_data->track.isFull()) {
+          // Also send the track when it only holds UBX fixes, as hasFix() is then false.
+          // Otherwise it is never cleared and PLUGIN_FIFTY_PER_SECOND keeps scheduling PLUGIN_READ.
+          success = true;
+        }
+
         if (success) {
           bool distance_passed = false;
           bool interval_passed = false;
@@ -481,11 +515,14 @@ boolean Plugin_082(uint8_t function, struct EventStruct *event, String& string)
             interval_passed = true;
           } else if (timeOutReached(P082_data->_last_measurement + (Settings.TaskDeviceTimer[event->TaskIndex] * 1000))) {
             interval_passed = true;
+          } else if (P082_data->track.isFull()) {
+            interval_passed = true;
           }
           success = (distance_passed || interval_passed);
 
           if (success) {
             P082_data->_last_measurement = millis();
+            P082_sendTrack(event);
           }
         }
       }
@@ -580,6 +617,45 @@ void P082_setOutputValue(struct EventStruct *event, uint8_t outputType, float va
   }
 }
 
+// Send the simplified track to the controllers.
+// All kept fixes except the last one are sent right away.
+// The last one is left in the task values, to be sent as result of PLUGIN_READ.
+void P082_sendTrack(struct EventStruct *event) {
+  P082_data_struct *P082_data =
+    static_cast<P082_data_struct *>(getPluginTaskData(event->TaskIndex));
+
+  if ((nullptr == P082_data) || (P082_data->track.count() == 0)) {
+    return;
+  }
+  P082_track_t& track = P082_data->track;
+  const uint8_t kept  = track.simplify(P082_TRACK_TOLERANCE);
+  uint8_t sent        = 0;
+
+  for (uint8_t i = 0; i < track.count(); ++i) {
+    if (track.keep(i)) {
+      const P082_track_point_t& point = track.get(i);
+      P082_setOutputValue(event, static_cast<uint8_t>(P082_query::P082_QUERY_LONG), point.lng_e7 / 10000000.0f);
+      P082_setOutputValue(event, static_cast<uint8_t>(P082_query::P082_QUERY_LAT),  point.lat_e7 / 10000000.0f);
+      P082_setOutputValue(event, static_cast<uint8_t>(P082_query::P082_QUERY_ALT),  point.altitude);
+      P082_setOutputValue(event, static_cast<uint8_t>(P082_query::P082_QUERY_SPD),  point.speed);
+      ++sent;
+
+      if (sent < kept) {
+        sendData(event);
+      }
+    }
+  }
+
+  if (loglevelActiveFor(LOG_LEVEL_INFO)) {
+    String log = F("GPS  : Track fixes: ");
+    log += track.count();
+    log += F(" sent: ");
+    log += kept;
+    addLogMove(LOG_LEVEL_INFO, log);
+  }
+  track.clear();
+}
+
 void P082_logStats(struct EventStruct *event) {
   #ifndef BUILD_NO_DEBUG
   if (!loglevelActiveFor(LOG_LEVEL_DEBUG)) { return; }
@@ -603,7 +679,7 @@ void P082_logStats(struct EventStruct *event) {
     log += F(" Chksum(pass/fail): ");
     log += P082_data->gps->passedChecksum();
     log += '/';
-    log += P082_data->gps->failedChecksum();
+    log += P082_data->failedChecksum();
     log += F(" invalid: ");
     log += P082_data->gps->invalidData();
     addLogMove(LOG_LEVEL_DEBUG, log);
@@ -735,13 +811,21 @@ void P082_html_show_stats(struct EventStruct *event) {
     addUnit('m');
   }
 
+  if (P082_data->track.count() > 0) {
+    addRowLabel(F("Track Fixes Buffered"));
+    addHtmlInt(P082_data->track.count());
+  }
+
+  addRowLabel(F("Sentences Skipped"));
+  addHtmlInt(P082_data->_sentencesSkipped);
+
   addRowLabel(F("Checksum (pass/fail/invalid)"));
   {
     String chksumStats;
 
     chksumStats  = P082_data->gps->passedChecksum();
     chksumStats += '/';
-    chksumStats += P082_data->gps->failedChecksum();
+    chksumStats += P082_data->failedChecksum();
     chksumStats += '/';
     chksumStats += P082_data->gps->invalidData();
     addHtml(chksumStats);
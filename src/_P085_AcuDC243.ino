@@ -62,6 +62,8 @@
 
 // Forward declaration of functions:
 const __FlashStringHelper * Plugin_085_valuename(uint8_t value_nr, bool displayString);
+uint16_t p085_registerAddress(uint8_t query);
+float    p085_convertValue(uint8_t query, uint32_t raw);
 
 
 struct P085_data_struct : public PluginTaskData_base {
@@ -84,7 +86,60 @@ struct P085_data_struct : public PluginTaskData_base {
     return modbus.isInitialized();
   }
 
+  // Queue the reads for all values, without waiting for the replies.
+  // Adjacent registers are read in a single Modbus request.
+  bool startReadValues(const uint8_t queries[]) {
+    if (reading || !isInitialized()) {
+      return false;
+    }
+    valuesReady  = false;
+    pendingReads = 0;
+
+    for (uint8_t i = 0; i < P085_NR_OUTPUT_VALUES; ++i) {
+      values[i] = 0.0f;
+      const uint8_t  query   = queries[i];
+      const uint16_t address = p085_registerAddress(query);
+
+      if (address == 0xFFFF) {
+        continue;
+      }
+      const bool queued = modbus.queueReadRegisters(
+        MODBUS_READ_HOLDING_REGISTERS, address, 2,
+        [this, i, query](uint8_t errorcode, const uint16_t *registers, uint8_t count) {
+          if ((errorcode == 0) && (count == 2)) {
+            values[i] = p085_convertValue(query, (static_cast<uint32_t>(registers[0]) << 16) | registers[1]);
+          }
+
+          if (pendingReads > 0) {
+            --pendingReads;
+          }
+        });
+
+      if (queued) {
+        ++pendingReads;
+      }
+    }
+    reading = true;
+    return true;
+  }
+
+  // Returns true when all values have just been read.
+  bool loop() {
+    modbus.processQueue();
+
+    if (reading && (pendingReads == 0)) {
+      reading     = false;
+      valuesReady = true;
+      return true;
+    }
+    return false;
+  }
+
   ModbusRTU_struct modbus;
+  float            values[P085_NR_OUTPUT_VALUES] = { 0 };
+  uint8_t          pendingReads                  = 0;
+  bool             reading                       = false;
+  bool             valuesReady                   = false;
 };
 
 unsigned int _plugin_085_last_measurement = 0;
@@ -106,6 +161,7 @@ boolean Plugin_085(uint8_t function, struct EventStruct *event, String& string)
       Device[deviceCount].TimerOption        = true;
       Device[deviceCount].GlobalSyncOption   = true;
       Device[deviceCount].ExitTaskBeforeSave = false;
+      Device[deviceCount].FiftyPerSecond     = true;
       break;
     }
 
@@ -357,13 +413,34 @@ boolean Plugin_085(uint8_t function, struct EventStruct *event, String& string)
         static_cast<P085_data_struct *>(getPluginTaskData(event->TaskIndex));
 
       if ((nullptr != P085_data) && P085_data->isInitialized()) {
-        for (int i = 0; i < P085_NR_OUTPUT_VALUES; ++i) {
-          UserVar[event->BaseVarIndex + i] = p085_readValue(PCONFIG(i + P085_QUERY1_CONFIG_POS), event);
-          delay(1);
+        if (P085_data->valuesReady) {
+          // Values have been read in the background, see PLUGIN_FIFTY_PER_SECOND
+          for (int i = 0; i < P085_NR_OUTPUT_VALUES; ++i) {
+            UserVar[event->BaseVarIndex + i] = P085_data->values[i];
+          }
+          P085_data->valuesReady = false;
+          success                = true;
+        } else {
+          uint8_t queries[P085_NR_OUTPUT_VALUES];
+
+          for (int i = 0; i < P085_NR_OUTPUT_VALUES; ++i) {
+            queries[i] = PCONFIG(i + P085_QUERY1_CONFIG_POS);
+          }
+          P085_data->startReadValues(queries);
         }
+      }
+      break;
+    }
 
-        success = true;
+    case PLUGIN_FIFTY_PER_SECOND: {
+      P085_data_struct *P085_data =
+        static_cast<P085_data_struct *>(getPluginTaskData(event->TaskIndex));
+
+      if ((nullptr != P085_data) && P085_data->loop()) {
+        // All values have been read, have them processed by PLUGIN_READ.
+        Scheduler.schedule_task_device_timer(event->TaskIndex, millis());
       }
+      success = true;
       break;
     }
 #ifdef USES_PACKED_RAW_DATA
@@ -429,39 +506,71 @@ int p085_storageValueToBaudrate(uint8_t baudrate_setting) {
   return 19200;
 }
 
+// Address of the 2 holding registers holding the value, or 0xFFFF when unknown.
+uint16_t p085_registerAddress(uint8_t query) {
+  switch (query) {
+    case P085_QUERY_V:      return 0x200;
+    case P085_QUERY_A:      return 0x202;
+    case P085_QUERY_W:      return 0x204;
+    case P085_QUERY_Wh_imp: return 0x300;
+    case P085_QUERY_Wh_exp: return 0x302;
+    case P085_QUERY_Wh_tot: return 0x304;
+    case P085_QUERY_Wh_net: return 0x306;
+    case P085_QUERY_h_tot:  return 0x280;
+    case P085_QUERY_h_load: return 0x282;
+  }
+  return 0xFFFF;
+}
+
+float p085_convertValue(uint8_t query, uint32_t raw) {
+  switch (query) {
+    case P085_QUERY_V:
+    case P085_QUERY_A:
+    case P085_QUERY_W:
+    {
+      union {
+        uint32_t ival;
+        float    fval;
+      } conversion;
+
+      conversion.ival = raw;
+
+      if (query == P085_QUERY_W) {
+        return conversion.fval * 1000.0f; // power (kW => W)
+      }
+      return conversion.fval;
+    }
+    case P085_QUERY_Wh_imp:
+    case P085_QUERY_Wh_exp:
+    case P085_QUERY_Wh_tot:
+      return raw * 10.0f; // 0.01 kWh => Wh
+    case P085_QUERY_Wh_net:
+    {
+      int64_t intvalue = raw;
+
+      if (intvalue >= 2147483648ll) {
+        intvalue = 4294967296ll - intvalue;
+      }
+      float value = static_cast<float>(intvalue);
+      value *= 10.0f; // 0.01 kWh => Wh
+      return value;
+    }
+    case P085_QUERY_h_tot:
+    case P085_QUERY_h_load:
+      return raw / 100.0f;
+  }
+  return 0.0f;
+}
+
 float p085_readValue(uint8_t query, struct EventStruct *event) {
   P085_data_struct *P085_data =
     static_cast<P085_data_struct *>(getPluginTaskData(event->TaskIndex));
 
   if ((nullptr != P085_data) && P085_data->isInitialized()) {
-    switch (query) {
-      case P085_QUERY_V:
-        return P085_data->modbus.read_float_HoldingRegister(0x200);
-      case P085_QUERY_A:
-        return P085_data->modbus.read_float_HoldingRegister(0x202);
-      case P085_QUERY_W:
-        return P085_data->modbus.read_float_HoldingRegister(0x204) * 1000.0f; // power (kW => W)
-      case P085_QUERY_Wh_imp:
-        return P085_data->modbus.read_32b_HoldingRegister(0x300) * 10.0f;     // 0.01 kWh => Wh
-      case P085_QUERY_Wh_exp:
-        return P085_data->modbus.read_32b_HoldingRegister(0x302) * 10.0f;     // 0.01 kWh => Wh
-      case P085_QUERY_Wh_tot:
-        return P085_data->modbus.read_32b_HoldingRegister(0x304) * 10.0f;     // 0.01 kWh => Wh
-      case P085_QUERY_Wh_net:
-      {
-        int64_t intvalue = P085_data->modbus.read_32b_HoldingRegister(0x306);
+    const uint16_t address = p085_registerAddress(query);
 
-        if (intvalue >= 2147483648ll) {
-          intvalue = 4294967296ll - intvalue;
-        }
-        float value = static_cast<float>(intvalue);
-        value *= 10.0f; // 0.01 kWh => Wh
-        return value;
-      }
-      case P085_QUERY_h_tot:
-        return P085_data->modbus.read_32b_HoldingRegister(0x280) / 100.0f;
-      case P085_QUERY_h_load:
-        return P085_data->modbus.read_32b_HoldingRegister(0x282) / 100.0f;
+    if (address != 0xFFFF) {
+      return p085_convertValue(query, P085_data->modbus.read_32b_HoldingRegister(address));
     }
   }
   return 0.0f;
@@ -67,6 +67,7 @@ boolean Plugin_087(uint8_t function, struct EventStruct *event, String& string)
       Device[deviceCount].GlobalSyncOption   = false;
       // FIXME TD-er: Not sure if access to any existing task data is needed when saving
       Device[deviceCount].ExitTaskBeforeSave = false;
+      Device[deviceCount].FiftyPerSecond     = true;
       break;
     }
 
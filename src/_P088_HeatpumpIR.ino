@@ -70,6 +70,7 @@ boolean Plugin_088(uint8_t function, struct EventStruct *event, String& string)
         Device[deviceCount].TimerOptional = false;
         Device[deviceCount].GlobalSyncOption = false;
         Device[deviceCount].DecimalsOnly = false;
+        Device[deviceCount].TenPerSecond = true;
 
         break;
       }
@@ -75,6 +75,7 @@ boolean Plugin_094(uint8_t function, struct EventStruct *event, String& string)
 //      Device[deviceCount].DuplicateDetection = true;
       // FIXME TD-er: Not sure if access to any existing task data is needed when saving
       Device[deviceCount].ExitTaskBeforeSave = false;
+      Device[deviceCount].FiftyPerSecond     = true;
       break;
     }
 
@@ -60,6 +60,7 @@ boolean Plugin_098(uint8_t function, struct EventStruct *event, String& string)
       Device[deviceCount].SendDataOption     = false;
       Device[deviceCount].TimerOption        = false;
       Device[deviceCount].TimerOptional      = true;
+      Device[deviceCount].FiftyPerSecond     = true;
       break;
     }
 
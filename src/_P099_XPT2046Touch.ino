@@ -96,6 +96,7 @@ boolean Plugin_099(uint8_t function, struct EventStruct *event, String& string)
       Device[deviceCount].ValueCount = 3;
       Device[deviceCount].SendDataOption = false;
       Device[deviceCount].TimerOption = false;
+      Device[deviceCount].TenPerSecond = true;
       success = true;
       break;
     }
@@ -132,6 +132,7 @@ boolean Plugin_104(uint8_t function, struct EventStruct *event, String& string)
       Device[deviceCount].TimerOptional      = false;
       Device[deviceCount].GlobalSyncOption   = true;
       Device[deviceCount].ExitTaskBeforeSave = false;
+      Device[deviceCount].TenPerSecond       = true;
       break;
     }
 
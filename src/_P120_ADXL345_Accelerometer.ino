@@ -11,6 +11,7 @@
  */
 
 /** Changelog:
+ * 2026-10-19, Add FIFO burst mode: read samples at up to 3200 Hz, output RMS, peak, crest factor and FFT band RMS
  * 2021-12-10, tonhuisman: Split functional parts into P120_data_struc to re-use for P125 ADXL345 SPI plugin
  * 2021-11-22, tonhuisman: Move from DEVELOPMENT to TESTING
  * 2021-11-02, tonhuisman: Add Axis offsets for calibration
@@ -32,6 +33,10 @@
 # define PLUGIN_VALUENAME1_120  "X"
 # define PLUGIN_VALUENAME2_120  "Y"
 # define PLUGIN_VALUENAME3_120  "Z"
+# define PLUGIN_BURST_VALUENAME1_120  "RMS"
+# define PLUGIN_BURST_VALUENAME2_120  "Peak"
+# define PLUGIN_BURST_VALUENAME3_120  "Crest"
+# define PLUGIN_BURST_VALUENAME4_120  "Band"
 
 boolean Plugin_120(uint8_t function, struct EventStruct *event, String& string)
 {
@@ -50,6 +55,8 @@ boolean Plugin_120(uint8_t function, struct EventStruct *event, String& string)
       Device[deviceCount].SendDataOption = true;
       Device[deviceCount].TimerOption    = true;
       Device[deviceCount].TimerOptional  = true;
+      Device[deviceCount].TenPerSecond   = true;
+      Device[deviceCount].FiftyPerSecond = true;
 
       break;
     }
@@ -62,9 +69,30 @@ boolean Plugin_120(uint8_t function, struct EventStruct *event, String& string)
 
     case PLUGIN_GET_DEVICEVALUENAMES:
     {
-      strcpy_P(ExtraTaskSettings.TaskDeviceValueNames[0], PSTR(PLUGIN_VALUENAME1_120));
-      strcpy_P(ExtraTaskSettings.TaskDeviceValueNames[1], PSTR(PLUGIN_VALUENAME2_120));
-      strcpy_P(ExtraTaskSettings.TaskDeviceValueNames[2], PSTR(PLUGIN_VALUENAME3_120));
+      if (P120_FREQUENCY == P120_FREQUENCY_BURST) {
+        strcpy_P(ExtraTaskSettings.TaskDeviceValueNames[0], PSTR(PLUGIN_BURST_VALUENAME1_120));
+        strcpy_P(ExtraTaskSettings.TaskDeviceValueNames[1], PSTR(PLUGIN_BURST_VALUENAME2_120));
+        strcpy_P(ExtraTaskSettings.TaskDeviceValueNames[2], PSTR(PLUGIN_BURST_VALUENAME3_120));
+        strcpy_P(ExtraTaskSettings.TaskDeviceValueNames[3], PSTR(PLUGIN_BURST_VALUENAME4_120));
+      } else {
+        strcpy_P(ExtraTaskSettings.TaskDeviceValueNames[0], PSTR(PLUGIN_VALUENAME1_120));
+        strcpy_P(ExtraTaskSettings.TaskDeviceValueNames[1], PSTR(PLUGIN_VALUENAME2_120));
+        strcpy_P(ExtraTaskSettings.TaskDeviceValueNames[2], PSTR(PLUGIN_VALUENAME3_120));
+      }
+      break;
+    }
+
+    case PLUGIN_GET_DEVICEVALUECOUNT:
+    {
+      event->Par1 = (P120_FREQUENCY == P120_FREQUENCY_BURST) ? 4 : 3;
+      success     = true;
+      break;
+    }
+
+    case PLUGIN_GET_DEVICEVTYPE:
+    {
+      event->sensorType = (P120_FREQUENCY == P120_FREQUENCY_BURST) ? Sensor_VType::SENSOR_TYPE_QUAD : Sensor_VType::SENSOR_TYPE_TRIPLE;
+      success           = true;
       break;
     }
 
@@ -143,7 +171,11 @@ boolean Plugin_120(uint8_t function, struct EventStruct *event, String& string)
       P120_data_struct *P120_data = static_cast<P120_data_struct *>(getPluginTaskData(event->TaskIndex));
 
       if (nullptr != P120_data) {
-        success = P120_data->initialized();
+        if (P120_FREQUENCY == P120_FREQUENCY_BURST) {
+          success = P120_data->get_burst_features(event);
+        } else {
+          success = P120_data->initialized();
+        }
       }
 
       break;
@@ -153,7 +185,7 @@ boolean Plugin_120(uint8_t function, struct EventStruct *event, String& string)
     {
       P120_data_struct *P120_data = static_cast<P120_data_struct *>(getPluginTaskData(event->TaskIndex));
 
-      if (nullptr != P120_data) {
+      if ((nullptr != P120_data) && (P120_FREQUENCY != P120_FREQUENCY_BURST)) {
         int X, Y, Z;
 
         if (P120_data->read_data(event, X, Y, Z)) {
@@ -178,6 +210,17 @@ boolean Plugin_120(uint8_t function, struct EventStruct *event, String& string)
         if (nullptr != P120_data) {
           success = P120_data->read_sensor(event);
         }
+      } else if ((function == PLUGIN_FIFTY_PER_SECOND) && (P120_FREQUENCY == P120_FREQUENCY_BURST)) {
+        P120_data_struct *P120_data = static_cast<P120_data_struct *>(getPluginTaskData(event->TaskIndex));
+
+        if ((nullptr != P120_data) && P120_data->read_burst(event)) {
+          success = true;
+
+          if (Settings.TaskDeviceTimer[event->TaskIndex] == 0) {
+            // No interval set, send the features of each burst
+            Scheduler.schedule_task_device_timer(event->TaskIndex, millis());
+          }
+        }
       }
 
       break;
@@ -11,6 +11,7 @@
  */
 
 /** Changelog:
+ * 2026-10-19, Add FIFO burst mode: read samples at up to 3200 Hz, output RMS, peak, crest factor and FFT band RMS
  * 2021-12-10, tonhuisman, Start SPI interface version of ADXL345 plugin, based on P120 ADXL345 I2C plugin
  *                         Using Sparkfun ADXL345 library
  *                         https://github.com/sparkfun/SparkFun_ADXL345_Arduino_Library
@@ -32,6 +33,10 @@
 # define PLUGIN_VALUENAME1_125  "X"
 # define PLUGIN_VALUENAME2_125  "Y"
 # define PLUGIN_VALUENAME3_125  "Z"
+# define PLUGIN_BURST_VALUENAME1_125  "RMS"
+# define PLUGIN_BURST_VALUENAME2_125  "Peak"
+# define PLUGIN_BURST_VALUENAME3_125  "Crest"
+# define PLUGIN_BURST_VALUENAME4_125  "Band"
 
 boolean Plugin_125(uint8_t function, struct EventStruct *event, String& string)
 {
@@ -50,6 +55,8 @@ boolean Plugin_125(uint8_t function, struct EventStruct *event, String& string)
       Device[deviceCount].SendDataOption = true;
       Device[deviceCount].TimerOption    = true;
       Device[deviceCount].TimerOptional  = true;
+      Device[deviceCount].TenPerSecond   = true;
+      Device[deviceCount].FiftyPerSecond = true;
 
       break;
     }
@@ -62,9 +69,30 @@ boolean Plugin_125(uint8_t function, struct EventStruct *event, String& string)
 
     case PLUGIN_GET_DEVICEVALUENAMES:
     {
-      strcpy_P(ExtraTaskSettings.TaskDeviceValueNames[0], PSTR(PLUGIN_VALUENAME1_125));
-      strcpy_P(ExtraTaskSettings.TaskDeviceValueNames[1], PSTR(PLUGIN_VALUENAME2_125));
-      strcpy_P(ExtraTaskSettings.TaskDeviceValueNames[2], PSTR(PLUGIN_VALUENAME3_125));
+      if (P120_FREQUENCY == P120_FREQUENCY_BURST) {
+        strcpy_P(ExtraTaskSettings.TaskDeviceValueNames[0], PSTR(PLUGIN_BURST_VALUENAME1_125));
+        strcpy_P(ExtraTaskSettings.TaskDeviceValueNames[1], PSTR(PLUGIN_BURST_VALUENAME2_125));
+        strcpy_P(ExtraTaskSettings.TaskDeviceValueNames[2], PSTR(PLUGIN_BURST_VALUENAME3_125));
+        strcpy_P(ExtraTaskSettings.TaskDeviceValueNames[3], PSTR(PLUGIN_BURST_VALUENAME4_125));
+      } else {
+        strcpy_P(ExtraTaskSettings.TaskDeviceValueNames[0], PSTR(PLUGIN_VALUENAME1_125));
+        strcpy_P(ExtraTaskSettings.TaskDeviceValueNames[1], PSTR(PLUGIN_VALUENAME2_125));
+        strcpy_P(ExtraTaskSettings.TaskDeviceValueNames[2], PSTR(PLUGIN_VALUENAME3_125));
+      }
+      break;
+    }
+
+    case PLUGIN_GET_DEVICEVALUECOUNT:
+    {
+      event->Par1 = (P120_FREQUENCY == P120_FREQUENCY_BURST) ? 4 : 3;
+      success     = true;
+      break;
+    }
+
+    case PLUGIN_GET_DEVICEVTYPE:
+    {
+      event->sensorType = (P120_FREQUENCY == P120_FREQUENCY_BURST) ? Sensor_VType::SENSOR_TYPE_QUAD : Sensor_VType::SENSOR_TYPE_TRIPLE;
+      success           = true;
       break;
     }
 
@@ -134,7 +162,11 @@ boolean Plugin_125(uint8_t function, struct EventStruct *event, String& string)
       P120_data_struct *P120_data = static_cast<P120_data_struct *>(getPluginTaskData(event->TaskIndex));
 
       if (nullptr != P120_data) {
-        success = P120_data->initialized();
+        if (P120_FREQUENCY == P120_FREQUENCY_BURST) {
+          success = P120_data->get_burst_features(event);
+        } else {
+          success = P120_data->initialized();
+        }
       }
 
       break;
@@ -144,7 +176,7 @@ boolean Plugin_125(uint8_t function, struct EventStruct *event, String& string)
     {
       P120_data_struct *P120_data = static_cast<P120_data_struct *>(getPluginTaskData(event->TaskIndex));
 
-      if (nullptr != P120_data) {
+      if ((nullptr != P120_data) && (P120_FREQUENCY != P120_FREQUENCY_BURST)) {
         int X, Y, Z;
 
         if (P120_data->read_data(event, X, Y, Z)) {
@@ -169,6 +201,17 @@ boolean Plugin_125(uint8_t function, struct EventStruct *event, String& string)
         if (nullptr != P120_data) {
           success = P120_data->read_sensor(event);
         }
+      } else if ((function == PLUGIN_FIFTY_PER_SECOND) && (P120_FREQUENCY == P120_FREQUENCY_BURST)) {
+        P120_data_struct *P120_data = static_cast<P120_data_struct *>(getPluginTaskData(event->TaskIndex));
+
+        if ((nullptr != P120_data) && P120_data->read_burst(event)) {
+          success = true;
+
+          if (Settings.TaskDeviceTimer[event->TaskIndex] == 0) {
+            // No interval set, send the features of each burst
+            Scheduler.schedule_task_device_timer(event->TaskIndex, millis());
+          }
+        }
       }
 
       break;
@@ -23,6 +23,7 @@
 #include "src/Globals/ExtraTaskSettings.h"
 #include "src/Globals/GlobalMapPortStatus.h"
 #include "src/Globals/I2Cdev.h"
+#include "src/Globals/PluginCommandRouting.h"
 #include "src/Globals/Plugins.h"
 #include "src/Globals/RuntimeData.h"
 #include "src/Globals/Settings.h"
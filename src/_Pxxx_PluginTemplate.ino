@@ -114,6 +114,8 @@ boolean Plugin_xxx(uint8_t function, struct EventStruct *event, String& string)
       Device[deviceCount].TimerOption        = false;                            // Allow to set the "Interval" timer for the plugin.
       Device[deviceCount].TimerOptional      = false;                            // When taskdevice timer is not set and not optional, use default "Interval" delay (Settings.Delay)
       Device[deviceCount].DecimalsOnly       = true;                             // Allow to set the number of decimals (otherwise treated a 0 decimals)
+      Device[deviceCount].TenPerSecond       = true;                             // Plugin needs PLUGIN_TEN_PER_SECOND calls
+      Device[deviceCount].FiftyPerSecond     = false;                            // Plugin needs PLUGIN_FIFTY_PER_SECOND calls
       break;
     }
 
@@ -308,6 +310,7 @@ boolean Plugin_xxx(uint8_t function, struct EventStruct *event, String& string)
     case PLUGIN_TEN_PER_SECOND:
     {
       // code to be executed 10 times per second. Tasks which require fast response can be added here
+      // Only called when Device[deviceCount].TenPerSecond is set in PLUGIN_DEVICE_ADD
       // be careful on what is added here. Heavy processing will result in slowing the module down!
 
       success = true;
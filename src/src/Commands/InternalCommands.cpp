@@ -37,8 +37,11 @@
 #include "../Commands/wd.h"
 #include "../Commands/WiFi.h"
 
+#include "../DataStructs/TimingStats.h"
+
 #include "../ESPEasyCore/ESPEasy_Log.h"
 
+#include "../Helpers/CRC_functions.h"
 #include "../Helpers/Misc.h"
 #include "../Helpers/StringConverter.h"
 #include "../Helpers/StringParser.h"
@@ -132,55 +135,10 @@ command_case_data::command_case_data(const char *cmd, struct EventStruct *event,
 }
 
 
-// Wrapper to reduce generated code by macro
-bool do_command_case_all(command_case_data         & data,
-                         const __FlashStringHelper * cmd_test,
-                         command_function_fs         pFunc,
-                         int                         nrArguments)
-{
-  return do_command_case(data, cmd_test, pFunc, nrArguments, EventValueSourceGroup::Enum::ALL);
-}
-
-
-bool do_command_case_all(command_case_data         & data,
-                         const __FlashStringHelper * cmd_test,
-                         command_function            pFunc,
-                         int                         nrArguments)
-{
-  return do_command_case(data, cmd_test, pFunc, nrArguments, EventValueSourceGroup::Enum::ALL);
-}
-
-// Wrapper to reduce generated code by macro
-bool do_command_case_all_restricted(command_case_data         & data,
-                                    const __FlashStringHelper * cmd_test,
-                                    command_function_fs         pFunc,
-                                    int                         nrArguments)
-{
-  return do_command_case(data, cmd_test, pFunc, nrArguments, EventValueSourceGroup::Enum::RESTRICTED);
-}
-
-
-bool do_command_case_all_restricted(command_case_data         & data,
-                                    const __FlashStringHelper * cmd_test,
-                                    command_function            pFunc,
-                                    int                         nrArguments)
-{
-  return do_command_case(data, cmd_test, pFunc, nrArguments, EventValueSourceGroup::Enum::RESTRICTED);
-}
-
-
 bool do_command_case_check(command_case_data         & data,
-                           const __FlashStringHelper * cmd_test,
                            int                         nrArguments,
                            EventValueSourceGroup::Enum group)
 {
-  // The data struct is re-used on each attempt to process an internal command.
-  // Re-initialize the only two members that may have been altered by a previous call.
-  data.retval = false;
-  data.status = String();
-  if (!data.cmd_lc.equals(cmd_test)) {
-    return false;
-  }
   if (!checkSourceFlags(data.event->Source, group)) {
     data.status = return_incorrect_source();
     return false;
@@ -202,33 +160,269 @@ bool do_command_case_check(command_case_data         & data,
   return true; // Command is handled
 }
 
-bool do_command_case(command_case_data         & data,
-                     const __FlashStringHelper * cmd_test,
-                     command_function_fs         pFunc,
-                     int                         nrArguments,
-                     EventValueSourceGroup::Enum group)
-{
-  if (do_command_case_check(data, cmd_test, nrArguments, group)) {
-    // It has been handled, check if we need to execute it.
-    // FIXME TD-er: Must change command function signature to use const String&
-    data.status = pFunc(data.event, data.line.c_str());
-    return true;
+/*********************************************************************************************\
+* Table of internal commands
+*
+* Stored in flash, with the hash of the lower case command computed at compile time.
+* A small hash index in RAM (built on first use) points into this table,
+* so a command is resolved with a single hash lookup and only one string compare.
+\*********************************************************************************************/
+
+// Largest command is "resetflashwritecounter"
+#define COMMAND_TABLE_NAME_LENGTH 24
+
+struct command_table_entry {
+  uint32_t                    hash;
+  char                        name[COMMAND_TABLE_NAME_LENGTH];
+  command_function_fs         pFunc_fs;
+  command_function            pFunc;
+  int8_t                      nrArguments;
+  EventValueSourceGroup::Enum group;
+};
+
+// Select the matching function pointer type, to allow a single macro for both command function signatures.
+constexpr command_function_fs command_table_func_fs(command_function_fs pFunc) { return pFunc; }
+constexpr command_function_fs command_table_func_fs(command_function) { return nullptr; }
+constexpr command_function    command_table_func(command_function pFunc) { return pFunc; }
+constexpr command_function    command_table_func(command_function_fs) { return nullptr; }
+
+#define COMMAND_ENTRY(S, C, NARGS, G) \
+  { calc_FNV1a_hash(S), S, command_table_func_fs(&C), command_table_func(&C), NARGS, G }
+
+// EventValueSourceGroup::Enum::ALL
+#define COMMAND_ENTRY_A(S, C, NARGS) COMMAND_ENTRY(S, C, NARGS, EventValueSourceGroup::Enum::ALL)
+
+// EventValueSourceGroup::Enum::RESTRICTED
+#define COMMAND_ENTRY_R(S, C, NARGS) COMMAND_ENTRY(S, C, NARGS, EventValueSourceGroup::Enum::RESTRICTED)
+
+// FIXME TD-er: Should we execute command when number of arguments is wrong?
+
+// FIXME TD-er: must determine nr arguments where NARGS is set to -1
+static const command_table_entry internal_commands[] PROGMEM = {
+  COMMAND_ENTRY_A("accessinfo",             Command_AccessInfo_Ls,               0), // Network Command
+  COMMAND_ENTRY_A("asyncevent",             Command_Rules_Async_Events,         -1), // Rule.h
+  #ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
+  COMMAND_ENTRY_R("background",             Command_Background,                  1), // Diagnostic.h
+  #endif // ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
+  #ifdef USES_C012
+  COMMAND_ENTRY_A("blynkget",               Command_Blynk_Get,                  -1),
+  #endif // ifdef USES_C012
+  #ifdef USES_C015
+  COMMAND_ENTRY_R("blynkset",               Command_Blynk_Set,                  -1),
+  #endif // ifdef USES_C015
+  COMMAND_ENTRY_A("build",                  Command_Settings_Build,              1), // Settings.h
+  COMMAND_ENTRY_R("clearaccessblock",       Command_AccessInfo_Clear,            0), // Network Command
+  COMMAND_ENTRY_R("clearpassword",          Command_Settings_Password_Clear,     1), // Settings.h
+  COMMAND_ENTRY_R("clearrtcram",            Command_RTC_Clear,                   0), // RTC.h
+  COMMAND_ENTRY_R("config",                 Command_Task_RemoteConfig,          -1), // Tasks.h
+  COMMAND_ENTRY_R("controllerdisable",      Command_Controller_Disable,          1), // Controller.h
+  COMMAND_ENTRY_R("controllerenable",       Command_Controller_Enable,           1), // Controller.h
+  COMMAND_ENTRY_R("datetime",               Command_DateTime,                    2), // Time.h
+  COMMAND_ENTRY_R("debug",                  Command_Debug,                       1), // Diagnostic.h
+  COMMAND_ENTRY_R("deepsleep",              Command_System_deepSleep,            1), // System.h
+  COMMAND_ENTRY_R("delay",                  Command_Delay,                       1), // Timers.h
+  COMMAND_ENTRY_R("dns",                    Command_DNS,                         1), // Network Command
+  COMMAND_ENTRY_R("dst",                    Command_DST,                         1), // Time.h
+  #ifdef HAS_ETHERNET
+  COMMAND_ENTRY_R("ethphyadr",              Command_ETH_Phy_Addr,                1), // Network Command
+  COMMAND_ENTRY_R("ethpinmdc",              Command_ETH_Pin_mdc,                 1), // Network Command
+  COMMAND_ENTRY_R("ethpinmdio",             Command_ETH_Pin_mdio,                1), // Network Command
+  COMMAND_ENTRY_R("ethpinpower",            Command_ETH_Pin_power,               1), // Network Command
+  COMMAND_ENTRY_R("ethphytype",             Command_ETH_Phy_Type,                1), // Network Command
+  COMMAND_ENTRY_R("ethclockmode",           Command_ETH_Clock_Mode,              1), // Network Command
+  COMMAND_ENTRY_R("ethip",                  Command_ETH_IP,                      1), // Network Command
+  COMMAND_ENTRY_R("ethgateway",             Command_ETH_Gateway,                 1), // Network Command
+  COMMAND_ENTRY_R("ethsubnet",              Command_ETH_Subnet,                  1), // Network Command
+  COMMAND_ENTRY_R("ethdns",                 Command_ETH_DNS,                     1), // Network Command
+  COMMAND_ENTRY_A("ethdisconnect",          Command_ETH_Disconnect,              0), // Network Command
+  COMMAND_ENTRY_R("ethwifimode",            Command_ETH_Wifi_Mode,               1), // Network Command
+  #endif // HAS_ETHERNET
+  COMMAND_ENTRY_R("erasesdkwifi",           Command_WiFi_Erase,                  0), // WiFi.h
+  COMMAND_ENTRY_A("event",                  Command_Rules_Events,               -1), // Rule.h
+  COMMAND_ENTRY_A("executerules",           Command_Rules_Execute,              -1), // Rule.h
+  COMMAND_ENTRY_R("gateway",                Command_Gateway,                     1), // Network Command
+  COMMAND_ENTRY_A("gpio",                   Command_GPIO,                        2), // Gpio.h
+  COMMAND_ENTRY_A("gpiotoggle",             Command_GPIO_Toggle,                 1), // Gpio.h
+  COMMAND_ENTRY_R("i2cscanner",             Command_i2c_Scanner,                -1), // i2c.h
+  COMMAND_ENTRY_R("ip",                     Command_IP,                          1), // Network Command
+  #ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
+  COMMAND_ENTRY_A("jsonportstatus",         Command_JSONPortStatus,             -1), // Diagnostic.h
+  #endif // ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
+  COMMAND_ENTRY_A("let",                    Command_Rules_Let,                   2), // Rules.h
+  COMMAND_ENTRY_A("load",                   Command_Settings_Load,               0), // Settings.h
+  COMMAND_ENTRY_A("logentry",               Command_logentry,                   -1), // Diagnostic.h
+  COMMAND_ENTRY_A("looptimerset",           Command_Loop_Timer_Set,              3), // Timers.h
+  COMMAND_ENTRY_A("looptimerset_ms",        Command_Loop_Timer_Set_ms,           3), // Timers.h
+  COMMAND_ENTRY_A("longpulse",              Command_GPIO_LongPulse,              3), // GPIO.h
+  COMMAND_ENTRY_A("longpulse_ms",           Command_GPIO_LongPulse_Ms,           3), // GPIO.h
+  #ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
+  COMMAND_ENTRY_A("logportstatus",          Command_logPortStatus,               0), // Diagnostic.h
+  COMMAND_ENTRY_A("lowmem",                 Command_Lowmem,                      0), // Diagnostic.h
+  #endif // ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
+  COMMAND_ENTRY_A("mcpgpio",                Command_GPIO,                        2), // Gpio.h
+  COMMAND_ENTRY_A("mcpgpiorange",           Command_GPIO_McpGPIORange,          -1), // Gpio.h
+  COMMAND_ENTRY_A("mcpgpiopattern",         Command_GPIO_McpGPIOPattern,        -1), // Gpio.h
+  COMMAND_ENTRY_A("mcpgpiotoggle",          Command_GPIO_Toggle,                 1), // Gpio.h
+  COMMAND_ENTRY_A("mcplongpulse",           Command_GPIO_LongPulse,              3), // GPIO.h
+  COMMAND_ENTRY_A("mcplongpulse_ms",        Command_GPIO_LongPulse_Ms,           3), // GPIO.h
+  COMMAND_ENTRY_A("mcpmode",                Command_GPIO_Mode,                   2), // Gpio.h
+  COMMAND_ENTRY_A("mcpmoderange",           Command_GPIO_ModeRange,              3), // Gpio.h
+  COMMAND_ENTRY_A("mcppulse",               Command_GPIO_Pulse,                  3), // GPIO.h
+  COMMAND_ENTRY_A("monitor",                Command_GPIO_Monitor,                2), // GPIO.h
+  COMMAND_ENTRY_A("monitorrange",           Command_GPIO_MonitorRange,           3), // GPIO.h
+  #ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
+  COMMAND_ENTRY_A("malloc",                 Command_Malloc,                      1), // Diagnostic.h
+  COMMAND_ENTRY_A("meminfo",                Command_MemInfo,                     0), // Diagnostic.h
+  COMMAND_ENTRY_A("meminfodetail",          Command_MemInfo_detail,              0), // Diagnostic.h
+  #endif // ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
+  COMMAND_ENTRY_R("name",                   Command_Settings_Name,               1), // Settings.h
+  COMMAND_ENTRY_R("nosleep",                Command_System_NoSleep,              1), // System.h
+  #ifdef USES_NOTIFIER
+  COMMAND_ENTRY_R("notify",                 Command_Notifications_Notify,        2), // Notifications.h
+  #endif
+  COMMAND_ENTRY_R("ntphost",                Command_NTPHost,                     1), // Time.h
+  COMMAND_ENTRY_A("pcfgpio",                Command_GPIO,                        2), // Gpio.h
+  COMMAND_ENTRY_A("pcfgpiorange",           Command_GPIO_PcfGPIORange,          -1), // Gpio.h
+  COMMAND_ENTRY_A("pcfgpiopattern",         Command_GPIO_PcfGPIOPattern,        -1), // Gpio.h
+  COMMAND_ENTRY_A("pcfgpiotoggle",          Command_GPIO_Toggle,                 1), // Gpio.h
+  COMMAND_ENTRY_A("pcflongpulse",           Command_GPIO_LongPulse,              3), // GPIO.h
+  COMMAND_ENTRY_A("pcflongpulse_ms",        Command_GPIO_LongPulse_Ms,           3), // GPIO.h
+  COMMAND_ENTRY_A("pcfmode",                Command_GPIO_Mode,                   2), // Gpio.h
+  COMMAND_ENTRY_A("pcfmoderange",           Command_GPIO_ModeRange,              3), // Gpio.h   ************
+  COMMAND_ENTRY_A("pcfpulse",               Command_GPIO_Pulse,                  3), // GPIO.h
+  COMMAND_ENTRY_R("password",               Command_Settings_Password,           1), // Settings.h
+  #ifdef USE_CUSTOM_PROVISIONING
+  COMMAND_ENTRY_A("provisionconfig",        Command_Provisioning_Config,         0), // Provisioning.h
+  COMMAND_ENTRY_A("provisionsecurity",      Command_Provisioning_Security,       0), // Provisioning.h
+  COMMAND_ENTRY_A("provisionnotification",  Command_Provisioning_Notification,   0), // Provisioning.h
+  COMMAND_ENTRY_A("provisionprovision",     Command_Provisioning_Provision,      0), // Provisioning.h
+  COMMAND_ENTRY_A("provisionrules",         Command_Provisioning_Rules,          1), // Provisioning.h
+  #endif
+  COMMAND_ENTRY_A("pulse",                  Command_GPIO_Pulse,                  3), // GPIO.h
+  #ifdef USES_MQTT
+  COMMAND_ENTRY_A("publish",                Command_MQTT_Publish,                2), // MQTT.h
+  #endif // USES_MQTT
+  COMMAND_ENTRY_A("pwm",                    Command_GPIO_PWM,                    4), // GPIO.h
+  COMMAND_ENTRY_A("reboot",                 Command_System_Reboot,               0), // System.h
+  COMMAND_ENTRY_R("reset",                  Command_Settings_Reset,              0), // Settings.h
+  COMMAND_ENTRY_A("resetflashwritecounter", Command_RTC_resetFlashWriteCounter,  0), // RTC.h
+  COMMAND_ENTRY_A("restart",                Command_System_Reboot,               0), // System.h
+  COMMAND_ENTRY_A("rtttl",                  Command_GPIO_RTTTL,                 -1), // GPIO.h
+  COMMAND_ENTRY_A("rules",                  Command_Rules_UseRules,              1), // Rule.h
+  COMMAND_ENTRY_R("save",                   Command_Settings_Save,               0), // Settings.h
+  #ifdef FEATURE_SD
+  COMMAND_ENTRY_R("sdcard",                 Command_SD_LS,                       0), // SDCARDS.h
+  COMMAND_ENTRY_R("sdremove",               Command_SD_Remove,                   1), // SDCARDS.h
+  #endif // ifdef FEATURE_SD
+  COMMAND_ENTRY_A("sendto",                 Command_UPD_SendTo,                  2), // UDP.h    // FIXME TD-er: These send commands, can we determine the nr of arguments?
+  COMMAND_ENTRY_A("sendtohttp",             Command_HTTP_SendToHTTP,             3), // HTTP.h
+  COMMAND_ENTRY_A("sendtoudp",              Command_UDP_SendToUPD,               3), // UDP.h
+  #ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
+  COMMAND_ENTRY_R("serialfloat",            Command_SerialFloat,                 0), // Diagnostic.h
+  #endif // ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
+  COMMAND_ENTRY_R("settings",               Command_Settings_Print,              0), // Settings.h
+  COMMAND_ENTRY_A("servo",                  Command_Servo,                       3), // Servo.h
+  COMMAND_ENTRY_A("status",                 Command_GPIO_Status,                 2), // GPIO.h
+  COMMAND_ENTRY_R("subnet",                 Command_Subnet,                      1), // Network Command
+  #ifdef USES_MQTT
+  COMMAND_ENTRY_A("subscribe",              Command_MQTT_Subscribe,              1), // MQTT.h
+  #endif // USES_MQTT
+  #ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
+  COMMAND_ENTRY_A("sysload",                Command_SysLoad,                     0), // Diagnostic.h
+  #endif // ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
+  COMMAND_ENTRY_R("taskclear",              Command_Task_Clear,                  1), // Tasks.h
+  COMMAND_ENTRY_R("taskclearall",           Command_Task_ClearAll,               0), // Tasks.h
+  COMMAND_ENTRY_R("taskdisable",            Command_Task_Disable,                1), // Tasks.h
+  COMMAND_ENTRY_R("taskenable",             Command_Task_Enable,                 1), // Tasks.h
+  COMMAND_ENTRY_A("taskrun",                Command_Task_Run,                    1), // Tasks.h
+  COMMAND_ENTRY_A("taskvalueset",           Command_Task_ValueSet,               3), // Tasks.h
+  COMMAND_ENTRY_A("taskvaluetoggle",        Command_Task_ValueToggle,            2), // Tasks.h
+  COMMAND_ENTRY_A("taskvaluesetandrun",     Command_Task_ValueSetAndRun,         3), // Tasks.h
+  COMMAND_ENTRY_A("timerpause",             Command_Timer_Pause,                 1), // Timers.h
+  COMMAND_ENTRY_A("timerresume",            Command_Timer_Resume,                1), // Timers.h
+  COMMAND_ENTRY_A("timerset",               Command_Timer_Set,                   2), // Timers.h
+  COMMAND_ENTRY_A("timerset_ms",            Command_Timer_Set_ms,                2), // Timers.h
+  COMMAND_ENTRY_R("timezone",               Command_TimeZone,                    1), // Time.h
+  COMMAND_ENTRY_A("tone",                   Command_GPIO_Tone,                   3), // GPIO.h
+  COMMAND_ENTRY_R("udpport",                Command_UDP_Port,                    1), // UDP.h
+  COMMAND_ENTRY_R("udptest",                Command_UDP_Test,                    2), // UDP.h
+  COMMAND_ENTRY_R("unit",                   Command_Settings_Unit,               1), // Settings.h
+  COMMAND_ENTRY_A("unmonitor",              Command_GPIO_UnMonitor,              2), // GPIO.h
+  COMMAND_ENTRY_A("unmonitorrange",         Command_GPIO_UnMonitorRange,         3), // GPIO.h
+  COMMAND_ENTRY_R("usentp",                 Command_useNTP,                      1), // Time.h
+  #ifndef LIMIT_BUILD_SIZE
+  COMMAND_ENTRY_R("wdconfig",               Command_WD_Config,                   3), // WD.h
+  COMMAND_ENTRY_R("wdread",                 Command_WD_Read,                     2), // WD.h
+  #endif
+  COMMAND_ENTRY_R("wifiallowap",            Command_Wifi_AllowAP,                0), // WiFi.h
+  COMMAND_ENTRY_R("wifiapmode",             Command_Wifi_APMode,                 0), // WiFi.h
+  COMMAND_ENTRY_A("wificonnect",            Command_Wifi_Connect,                0), // WiFi.h
+  COMMAND_ENTRY_A("wifidisconnect",         Command_Wifi_Disconnect,             0), // WiFi.h
+  COMMAND_ENTRY_R("wifikey",                Command_Wifi_Key,                    1), // WiFi.h
+  COMMAND_ENTRY_R("wifikey2",               Command_Wifi_Key2,                   1), // WiFi.h
+  COMMAND_ENTRY_R("wifimode",               Command_Wifi_Mode,                   1), // WiFi.h
+  COMMAND_ENTRY_R("wifiscan",               Command_Wifi_Scan,                   0), // WiFi.h
+  COMMAND_ENTRY_R("wifissid",               Command_Wifi_SSID,                   1), // WiFi.h
+  COMMAND_ENTRY_R("wifissid2",              Command_Wifi_SSID2,                  1), // WiFi.h
+  COMMAND_ENTRY_R("wifistamode",            Command_Wifi_STAMode,                0), // WiFi.h
+};
+
+#undef COMMAND_ENTRY_R
+#undef COMMAND_ENTRY_A
+#undef COMMAND_ENTRY
+
+#define NR_INTERNAL_COMMANDS  (sizeof(internal_commands) / sizeof(internal_commands[0]))
+
+// Must be a power of 2 and well above the number of commands to keep the probe sequences short.
+#define COMMAND_HASH_INDEX_SIZE  256
+#define COMMAND_HASH_INDEX_EMPTY 0xFF
+
+static_assert(NR_INTERNAL_COMMANDS < COMMAND_HASH_INDEX_EMPTY, "Too many internal commands for command hash index");
+static_assert((NR_INTERNAL_COMMANDS * 3) / 2 < COMMAND_HASH_INDEX_SIZE, "Command hash index too small");
+
+uint8_t command_hash_index[COMMAND_HASH_INDEX_SIZE];
+bool    command_hash_index_initialized = false;
+
+uint32_t get_command_table_hash(uint8_t commandIndex) {
+  return pgm_read_dword(&(internal_commands[commandIndex].hash));
+}
+
+void init_command_hash_index() {
+  memset(command_hash_index, COMMAND_HASH_INDEX_EMPTY, sizeof(command_hash_index));
+
+  for (uint8_t i = 0; i < NR_INTERNAL_COMMANDS; ++i) {
+    // Open addressing with linear probing.
+    size_t slot = get_command_table_hash(i) & (COMMAND_HASH_INDEX_SIZE - 1);
+
+    while (command_hash_index[slot] != COMMAND_HASH_INDEX_EMPTY) {
+      slot = (slot + 1) & (COMMAND_HASH_INDEX_SIZE - 1);
+    }
+    command_hash_index[slot] = i;
   }
-  return false;
+  command_hash_index_initialized = true;
 }
 
+// Find the command in the internal command table and copy its entry from flash.
+bool find_internal_command(const String& cmd_lc, command_table_entry& entry) {
+  if (cmd_lc.length() >= COMMAND_TABLE_NAME_LENGTH) { return false; }
 
-bool do_command_case(command_case_data         & data,
-                     const __FlashStringHelper * cmd_test,
-                     command_function            pFunc,
-                     int                         nrArguments,
-                     EventValueSourceGroup::Enum group)
-{
-  if (do_command_case_check(data, cmd_test, nrArguments, group)) {
-    // It has been handled, check if we need to execute it.
-    // FIXME TD-er: Must change command function signature to use const String&
-    data.status = pFunc(data.event, data.line.c_str());
-    return true;
+  if (!command_hash_index_initialized) {
+    init_command_hash_index();
+  }
+  const uint32_t hash = calc_FNV1a_hash_runtime(cmd_lc.c_str());
+  size_t slot         = hash & (COMMAND_HASH_INDEX_SIZE - 1);
+
+  while (command_hash_index[slot] != COMMAND_HASH_INDEX_EMPTY) {
+    const uint8_t commandIndex = command_hash_index[slot];
+
+    if (get_command_table_hash(commandIndex) == hash) {
+      memcpy_P(&entry, &internal_commands[commandIndex], sizeof(command_table_entry));
+
+      if (cmd_lc.equals(entry.name)) {
+        return true;
+      }
+    }
+    slot = (slot + 1) & (COMMAND_HASH_INDEX_SIZE - 1);
   }
   return false;
 }
@@ -237,263 +431,30 @@ bool executeInternalCommand(command_case_data & data)
 {
   const size_t cmd_lc_length = data.cmd_lc.length();
   if (cmd_lc_length < 2) return false; // No commands less than 2 characters
-  // Simple macro to match command to function call.
 
-  // EventValueSourceGroup::Enum::ALL
-  #define COMMAND_CASE_A(S, C, NARGS) \
-  if (do_command_case_all(data, F(S), &C, NARGS)) { return data.retval; }
+  START_TIMER;
+  command_table_entry entry;
+  const bool found = find_internal_command(data.cmd_lc, entry);
+  STOP_TIMER(COMMAND_LOOKUP_INTERNAL);
 
-  // EventValueSourceGroup::Enum::RESTRICTED
-  #define COMMAND_CASE_R(S, C, NARGS) \
-  if (do_command_case_all_restricted(data, F(S), &C, NARGS)) { return data.retval; }
+  if (!found) {
+    return false;
+  }
 
-  // FIXME TD-er: Should we execute command when number of arguments is wrong?
+  data.retval = false;
+  data.status = String();
 
-  // FIXME TD-er: must determine nr arguments where NARGS is set to -1
-  switch (data.cmd_lc[0]) {
-    case 'a': {
-      COMMAND_CASE_A("accessinfo", Command_AccessInfo_Ls,       0); // Network Command
-      COMMAND_CASE_A("asyncevent", Command_Rules_Async_Events, -1); // Rule.h
-      break;
-    }
-    case 'b': {
-    #ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
-      COMMAND_CASE_R("background", Command_Background, 1); // Diagnostic.h
-    #endif // ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
-    #ifdef USES_C012
-      COMMAND_CASE_A("blynkget", Command_Blynk_Get, -1);
-    #endif // ifdef USES_C012
-    #ifdef USES_C015
-      COMMAND_CASE_R("blynkset", Command_Blynk_Set, -1);
-    #endif // ifdef USES_C015
-      COMMAND_CASE_A("build", Command_Settings_Build, 1);      // Settings.h
-      break;
-    }
-    case 'c': {
-      COMMAND_CASE_R( "clearaccessblock", Command_AccessInfo_Clear,   0); // Network Command
-      COMMAND_CASE_R(    "clearpassword", Command_Settings_Password_Clear,     1); // Settings.h
-      COMMAND_CASE_R(      "clearrtcram", Command_RTC_Clear,          0); // RTC.h
-      COMMAND_CASE_R(           "config", Command_Task_RemoteConfig, -1); // Tasks.h
-      COMMAND_CASE_R("controllerdisable", Command_Controller_Disable, 1); // Controller.h
-      COMMAND_CASE_R( "controllerenable", Command_Controller_Enable,  1); // Controller.h
-
-      break;
-    }
-    case 'd': {
-      COMMAND_CASE_R( "datetime", Command_DateTime,         2); // Time.h
-      COMMAND_CASE_R(    "debug", Command_Debug,            1); // Diagnostic.h
-      COMMAND_CASE_R("deepsleep", Command_System_deepSleep, 1); // System.h
-      COMMAND_CASE_R(    "delay", Command_Delay,            1); // Timers.h
-      COMMAND_CASE_R(      "dns", Command_DNS,              1); // Network Command
-      COMMAND_CASE_R(      "dst", Command_DST,              1); // Time.h
-      break;
-    }
-    case 'e': {
-    #ifdef HAS_ETHERNET
-      COMMAND_CASE_R(   "ethphyadr", Command_ETH_Phy_Addr,   1); // Network Command
-      COMMAND_CASE_R(   "ethpinmdc", Command_ETH_Pin_mdc,    1); // Network Command
-      COMMAND_CASE_R(  "ethpinmdio", Command_ETH_Pin_mdio,   1); // Network Command
-      COMMAND_CASE_R( "ethpinpower", Command_ETH_Pin_power,  1); // Network Command
-      COMMAND_CASE_R(  "ethphytype", Command_ETH_Phy_Type,   1); // Network Command
-      COMMAND_CASE_R("ethclockmode", Command_ETH_Clock_Mode, 1); // Network Command
-      COMMAND_CASE_R(       "ethip", Command_ETH_IP,         1); // Network Command
-      COMMAND_CASE_R(  "ethgateway", Command_ETH_Gateway,    1); // Network Command
-      COMMAND_CASE_R(   "ethsubnet", Command_ETH_Subnet,     1); // Network Command  
-      COMMAND_CASE_R(      "ethdns", Command_ETH_DNS,        1); // Network Command
-      COMMAND_CASE_A("ethdisconnect", Command_ETH_Disconnect, 0); // Network Command
-      COMMAND_CASE_R( "ethwifimode", Command_ETH_Wifi_Mode,  1); // Network Command
-    #endif // HAS_ETHERNET
-      COMMAND_CASE_R("erasesdkwifi", Command_WiFi_Erase,     0); // WiFi.h
-      COMMAND_CASE_A(       "event", Command_Rules_Events,  -1); // Rule.h
-      COMMAND_CASE_A("executerules", Command_Rules_Execute, -1); // Rule.h
-      break;
-    }
-    case 'g': {
-      COMMAND_CASE_R(   "gateway", Command_Gateway,     1); // Network Command
-      COMMAND_CASE_A(      "gpio", Command_GPIO,        2); // Gpio.h
-      COMMAND_CASE_A("gpiotoggle", Command_GPIO_Toggle, 1); // Gpio.h
-      break;
-    }
-    case 'i': {
-      COMMAND_CASE_R("i2cscanner", Command_i2c_Scanner, -1); // i2c.h
-      COMMAND_CASE_R(        "ip", Command_IP,           1); // Network Command
-      break;
-    }
-    case 'j': {
-      #ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
-      COMMAND_CASE_A("jsonportstatus", Command_JSONPortStatus, -1); // Diagnostic.h
-      #endif // ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
-      break;
-    }
-    case 'l': {
-      COMMAND_CASE_A(            "let", Command_Rules_Let,         2); // Rules.h
-      COMMAND_CASE_A(           "load", Command_Settings_Load,     0); // Settings.h
-      COMMAND_CASE_A(       "logentry", Command_logentry,         -1); // Diagnostic.h
-      COMMAND_CASE_A(   "looptimerset", Command_Loop_Timer_Set,    3); // Timers.h
-      COMMAND_CASE_A("looptimerset_ms", Command_Loop_Timer_Set_ms, 3); // Timers.h
-      COMMAND_CASE_A(      "longpulse", Command_GPIO_LongPulse,    3);    // GPIO.h
-      COMMAND_CASE_A(   "longpulse_ms", Command_GPIO_LongPulse_Ms, 3);    // GPIO.h
-    #ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
-      COMMAND_CASE_A(  "logportstatus", Command_logPortStatus,     0); // Diagnostic.h
-      COMMAND_CASE_A(         "lowmem", Command_Lowmem,            0); // Diagnostic.h
-    #endif // ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
-      break;
-    }
-    case 'm': {
-      if (cmd_lc_length > 3 && data.cmd_lc[3] == 'g') {
-        COMMAND_CASE_A(        "mcpgpio", Command_GPIO,              2); // Gpio.h
-        COMMAND_CASE_A(   "mcpgpiorange", Command_GPIO_McpGPIORange, -1); // Gpio.h
-        COMMAND_CASE_A( "mcpgpiopattern", Command_GPIO_McpGPIOPattern, -1); // Gpio.h
-        COMMAND_CASE_A(  "mcpgpiotoggle", Command_GPIO_Toggle,       1); // Gpio.h
-      } else if (data.cmd_lc[1] == 'c') {
-        COMMAND_CASE_A(   "mcplongpulse", Command_GPIO_LongPulse,    3); // GPIO.h
-        COMMAND_CASE_A("mcplongpulse_ms", Command_GPIO_LongPulse_Ms, 3); // GPIO.h
-        COMMAND_CASE_A(        "mcpmode", Command_GPIO_Mode,         2); // Gpio.h   
-        COMMAND_CASE_A(   "mcpmoderange", Command_GPIO_ModeRange,    3); // Gpio.h   
-        COMMAND_CASE_A(       "mcppulse", Command_GPIO_Pulse,        3); // GPIO.h
-      }
-      COMMAND_CASE_A(          "monitor", Command_GPIO_Monitor,      2); // GPIO.h
-      COMMAND_CASE_A(     "monitorrange", Command_GPIO_MonitorRange, 3); // GPIO.h   
-    #ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
-      COMMAND_CASE_A(          "malloc", Command_Malloc,         1);        // Diagnostic.h
-      COMMAND_CASE_A(         "meminfo", Command_MemInfo,        0);        // Diagnostic.h
-      COMMAND_CASE_A(   "meminfodetail", Command_MemInfo_detail, 0);        // Diagnostic.h
-    #endif // ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
-
-      break;
-    }
-    case 'n': {
-      COMMAND_CASE_R(   "name", Command_Settings_Name,        1); // Settings.h
-      COMMAND_CASE_R("nosleep", Command_System_NoSleep,       1); // System.h
-#ifdef USES_NOTIFIER
-      COMMAND_CASE_R( "notify", Command_Notifications_Notify, 2); // Notifications.h
-#endif
-      COMMAND_CASE_R("ntphost", Command_NTPHost,              1); // Time.h
-      break;
-    }
-    case 'p': {
-      if (cmd_lc_length > 3 && data.cmd_lc[3] == 'g') {
-        COMMAND_CASE_A(        "pcfgpio", Command_GPIO,                 2); // Gpio.h
-        COMMAND_CASE_A(   "pcfgpiorange", Command_GPIO_PcfGPIORange,   -1); // Gpio.h
-        COMMAND_CASE_A( "pcfgpiopattern", Command_GPIO_PcfGPIOPattern, -1); // Gpio.h
-        COMMAND_CASE_A(  "pcfgpiotoggle", Command_GPIO_Toggle,          1); // Gpio.h
-      } else if (data.cmd_lc[1] == 'c') {
-        COMMAND_CASE_A(   "pcflongpulse", Command_GPIO_LongPulse,       3); // GPIO.h
-        COMMAND_CASE_A("pcflongpulse_ms", Command_GPIO_LongPulse_Ms,    3); // GPIO.h
-        COMMAND_CASE_A(        "pcfmode", Command_GPIO_Mode,            2); // Gpio.h   
-        COMMAND_CASE_A(   "pcfmoderange", Command_GPIO_ModeRange,       3); // Gpio.h   ************
-        COMMAND_CASE_A(       "pcfpulse", Command_GPIO_Pulse,           3); // GPIO.h
-      }
-      COMMAND_CASE_R("password", Command_Settings_Password, 1); // Settings.h
-#ifdef USE_CUSTOM_PROVISIONING
-      COMMAND_CASE_A(       "provisionconfig", Command_Provisioning_Config,       0); // Provisioning.h
-      COMMAND_CASE_A(     "provisionsecurity", Command_Provisioning_Security,     0); // Provisioning.h
-      COMMAND_CASE_A( "provisionnotification", Command_Provisioning_Notification, 0); // Provisioning.h
-      COMMAND_CASE_A(    "provisionprovision", Command_Provisioning_Provision,    0); // Provisioning.h
-      COMMAND_CASE_A(        "provisionrules", Command_Provisioning_Rules,        1); // Provisioning.h
-#endif
-      COMMAND_CASE_A(   "pulse", Command_GPIO_Pulse,        3); // GPIO.h
-#ifdef USES_MQTT
-      COMMAND_CASE_A( "publish", Command_MQTT_Publish,      2); // MQTT.h
-#endif // USES_MQTT
-      COMMAND_CASE_A(     "pwm", Command_GPIO_PWM,          4); // GPIO.h
-      break;
-    }
-    case 'r': {
-      COMMAND_CASE_A(                "reboot", Command_System_Reboot,              0); // System.h
-      COMMAND_CASE_R(                 "reset", Command_Settings_Reset,             0); // Settings.h
-      COMMAND_CASE_A("resetflashwritecounter", Command_RTC_resetFlashWriteCounter, 0); // RTC.h
-      COMMAND_CASE_A(               "restart", Command_System_Reboot,              0); // System.h
-      COMMAND_CASE_A(                 "rtttl", Command_GPIO_RTTTL,                -1); // GPIO.h
-      COMMAND_CASE_A(                 "rules", Command_Rules_UseRules,             1); // Rule.h
-      break;
-    }
-    case 's': {
-      COMMAND_CASE_R(    "save", Command_Settings_Save, 0); // Settings.h
-    #ifdef FEATURE_SD
-      COMMAND_CASE_R(  "sdcard", Command_SD_LS,         0); // SDCARDS.h
-      COMMAND_CASE_R("sdremove", Command_SD_Remove,     1); // SDCARDS.h
-    #endif // ifdef FEATURE_SD
-
-      if (data.cmd_lc[1] == 'e') {
-        COMMAND_CASE_A(    "sendto", Command_UPD_SendTo,      2); // UDP.h    // FIXME TD-er: These send commands, can we determine the nr
-                                                                  // of
-                                                                  // arguments?
-        COMMAND_CASE_A("sendtohttp", Command_HTTP_SendToHTTP, 3); // HTTP.h
-        COMMAND_CASE_A( "sendtoudp", Command_UDP_SendToUPD,   3); // UDP.h
-    #ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
-        COMMAND_CASE_R("serialfloat", Command_SerialFloat,    0); // Diagnostic.h
-    #endif // ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
-        COMMAND_CASE_R(   "settings", Command_Settings_Print, 0); // Settings.h
-        COMMAND_CASE_A(      "servo", Command_Servo,          3); // Servo.h
-      }
-      COMMAND_CASE_A("status", Command_GPIO_Status,          2); // GPIO.h
-      COMMAND_CASE_R("subnet", Command_Subnet, 1);                // Network Command
-    #ifdef USES_MQTT
-      COMMAND_CASE_A("subscribe", Command_MQTT_Subscribe, 1);     // MQTT.h
-    #endif // USES_MQTT
-    #ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
-      COMMAND_CASE_A(  "sysload", Command_SysLoad,        0);     // Diagnostic.h
-    #endif // ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
-      break;
-    }
-    case 't': {
-      if (data.cmd_lc[1] == 'a') {
-        COMMAND_CASE_R(   "taskclear", Command_Task_Clear,    1);             // Tasks.h
-        COMMAND_CASE_R("taskclearall", Command_Task_ClearAll, 0);             // Tasks.h
-        COMMAND_CASE_R( "taskdisable", Command_Task_Disable,  1);             // Tasks.h
-        COMMAND_CASE_R(  "taskenable", Command_Task_Enable,   1);             // Tasks.h
-        COMMAND_CASE_A(           "taskrun", Command_Task_Run,            1); // Tasks.h
-        COMMAND_CASE_A(      "taskvalueset", Command_Task_ValueSet,       3); // Tasks.h
-        COMMAND_CASE_A(   "taskvaluetoggle", Command_Task_ValueToggle,    2); // Tasks.h
-        COMMAND_CASE_A("taskvaluesetandrun", Command_Task_ValueSetAndRun, 3); // Tasks.h
-      } else if (data.cmd_lc[1] == 'i') {
-        COMMAND_CASE_A( "timerpause", Command_Timer_Pause,  1);               // Timers.h
-        COMMAND_CASE_A("timerresume", Command_Timer_Resume, 1);               // Timers.h
-        COMMAND_CASE_A(   "timerset", Command_Timer_Set,    2);               // Timers.h
-        COMMAND_CASE_A("timerset_ms", Command_Timer_Set_ms, 2); // Timers.h
-        COMMAND_CASE_R("timezone", Command_TimeZone, 1);                      // Time.h
-      }
-      COMMAND_CASE_A(      "tone", Command_GPIO_Tone, 3); // GPIO.h
-      break;
-    }
-    case 'u': {
-      COMMAND_CASE_R("udpport", Command_UDP_Port,      1);    // UDP.h
-      COMMAND_CASE_R("udptest", Command_UDP_Test,      2);    // UDP.h
-      COMMAND_CASE_R(   "unit", Command_Settings_Unit, 1);    // Settings.h
-      COMMAND_CASE_A("unmonitor", Command_GPIO_UnMonitor, 2); // GPIO.h
-      COMMAND_CASE_A("unmonitorrange", Command_GPIO_UnMonitorRange, 3); // GPIO.h
-      COMMAND_CASE_R("usentp", Command_useNTP, 1);            // Time.h
-      break;
-    }
-    case 'w': {
-      #ifndef LIMIT_BUILD_SIZE
-      COMMAND_CASE_R("wdconfig", Command_WD_Config, 3);               // WD.h
-      COMMAND_CASE_R(  "wdread", Command_WD_Read,   2);               // WD.h
-      #endif
-
-      if (data.cmd_lc[1] == 'i') {
-        COMMAND_CASE_R(   "wifiallowap", Command_Wifi_AllowAP,    0); // WiFi.h
-        COMMAND_CASE_R(    "wifiapmode", Command_Wifi_APMode,     0); // WiFi.h
-        COMMAND_CASE_A(   "wificonnect", Command_Wifi_Connect,    0); // WiFi.h
-        COMMAND_CASE_A("wifidisconnect", Command_Wifi_Disconnect, 0); // WiFi.h
-        COMMAND_CASE_R(       "wifikey", Command_Wifi_Key,        1); // WiFi.h
-        COMMAND_CASE_R(      "wifikey2", Command_Wifi_Key2,       1); // WiFi.h
-        COMMAND_CASE_R(      "wifimode", Command_Wifi_Mode,       1); // WiFi.h
-        COMMAND_CASE_R(      "wifiscan", Command_Wifi_Scan,       0); // WiFi.h
-        COMMAND_CASE_R(      "wifissid", Command_Wifi_SSID,       1); // WiFi.h
-        COMMAND_CASE_R(     "wifissid2", Command_Wifi_SSID2,      1); // WiFi.h
-        COMMAND_CASE_R(   "wifistamode", Command_Wifi_STAMode,    0); // WiFi.h
-      }
-      break;
+  // FIXME TD-er: Should we execute command when number of arguments is wrong?
+  if (do_command_case_check(data, entry.nrArguments, entry.group)) {
+    // It has been handled, check if we need to execute it.
+    // FIXME TD-er: Must change command function signature to use const String&
+    if (entry.pFunc_fs != nullptr) {
+      data.status = entry.pFunc_fs(data.event, data.line.c_str());
+    } else if (entry.pFunc != nullptr) {
+      data.status = entry.pFunc(data.event, data.line.c_str());
     }
-    default:
-      break;
   }
-
-  #undef COMMAND_CASE_R
-  #undef COMMAND_CASE_A
-  return false;
+  return data.retval;
 }
 
 // Execute command which may be plugin or internal commands
@@ -563,7 +524,6 @@ bool ExecuteCommand(taskIndex_t            taskIndex,
 
   if (tryInternal) {
     // Small optimization for events, which happen frequently
-    // FIXME TD-er: Make quick check to see if a command is an internal command, so we don't need to try all
     if (cmd.equalsIgnoreCase(F("event"))) {
       tryPlugin       = false;
       tryRemoteConfig = false;
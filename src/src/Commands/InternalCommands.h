@@ -16,8 +16,8 @@ bool checkNrArguments(const char *cmd, const String& Line, int nrArguments);
 typedef String (*command_function)(struct EventStruct *, const char *);
 typedef const __FlashStringHelper * (*command_function_fs)(struct EventStruct *, const char *);
 // Simple struct to be used in handling commands.
-// By packing all into a struct, the macro calling do_command_case generates a lot less code
-// resulting in a smaller binary.
+// The command is looked up in the table of internal commands (see InternalCommands.cpp),
+// which holds the handler, the expected nr. of arguments and the allowed sources per command.
 struct command_case_data {
 
     command_case_data(const char *cmd, struct EventStruct *event, const char *line);
@@ -32,10 +32,6 @@ struct command_case_data {
 
 };
 
-bool do_command_case(command_case_data& data, const __FlashStringHelper * cmd_test, command_function_fs pFunc, int nrArguments, EventValueSourceGroup::Enum group);
-bool do_command_case(command_case_data& data, const __FlashStringHelper * cmd_test, command_function pFunc, int nrArguments, EventValueSourceGroup::Enum group);
-
-
 /*********************************************************************************************\
 * Registers command
 \*********************************************************************************************/
@@ -12,11 +12,13 @@
 #include "../Helpers/ESPEasy_Storage.h"
 #include "../Helpers/ESPEasy_time_calc.h"
 #include "../Helpers/Memory.h"
+#include "../Helpers/ControllerWorker.h"
 #include "../Helpers/Networking.h"
 #include "../Helpers/Scheduler.h"
 #include "../Helpers/StringConverter.h"
 
 #include <Arduino.h>
+#include <iterator>
 #include <list>
 #include <memory> // For std::shared_ptr
 #include <new>    // std::nothrow
@@ -130,8 +132,10 @@ struct ControllerDelayHandlerStruct {
     // the setting 'deduplicate' does look at the content of the message and only compares it to messages in the queue.
     if (deduplicate && !sendQueue.empty()) {
       // Use reverse iterator here, as it is more likely a duplicate is added shortly after another.
+      // The element in flight is not compared, as the controller worker may change it.
+      const typename std::list<T>::const_reverse_iterator rend(firstIdle());
       auto it = sendQueue.rbegin(); // Same as back()
-      for (; it != sendQueue.rend(); ++it) {
+      for (; it != rend; ++it) {
         if (element.isDuplicate(*it)) {
 #ifndef BUILD_NO_DEBUG
           if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
@@ -159,8 +163,14 @@ struct ControllerDelayHandlerStruct {
       // Force add to the queue.
       // If max buffer is reached, the oldest in the queue (first to be served) will be removed.
       while (queueFull(element)) {
-        sendQueue.pop_front();
-        attempt = 0;
+        if (inFlight) {
+          // The front element is being sent by the controller worker, remove the next one.
+          if (sendQueue.size() <= 1) { break; }
+          sendQueue.erase(std::next(sendQueue.begin()));
+        } else {
+          sendQueue.pop_front();
+          attempt = 0;
+        }
       }
     }
 
@@ -248,10 +258,21 @@ struct ControllerDelayHandlerStruct {
     lastSend = millis() + msecFromNow;
   }
 
+  // First element which is not being processed by the controller worker.
+  // While inFlight is set, the front element is owned by the worker and must not be read or changed
+  // by the loop task. It is only removed or changed again via markProcessed() in the 'done' callback.
+  typename std::list<T>::const_iterator firstIdle() const {
+    auto it = sendQueue.begin();
+
+    if (inFlight && (it != sendQueue.end())) { ++it; }
+    return it;
+  }
+
+  // Does not include the element in flight.
   size_t getQueueMemorySize() const {
     size_t totalSize = 0;
 
-    for (auto it = sendQueue.begin(); it != sendQueue.end(); ++it) {
+    for (auto it = firstIdle(); it != sendQueue.end(); ++it) {
       totalSize += it->getSize();
     }
     return totalSize;
@@ -269,6 +290,7 @@ struct ControllerDelayHandlerStruct {
   bool          must_check_reply;
   bool          deduplicate;
   bool          useLocalSystemTime;
+  bool          inFlight = false; // Front element is being processed by the controller worker
 };
 
 
@@ -349,6 +371,84 @@ struct ControllerDelayHandlerStruct {
 
 
 
+#ifdef USES_CONTROLLER_WORKER
+
+// Same as DEFINE_Cxxx_DELAY_QUEUE_MACRO_CPP, but do_process_cNNN_delay_queue is run on the controller worker task.
+// Only use this for controllers whose do_process function does its own blocking network I/O and
+// does not touch global state (task settings, shared clients, serial ports).
+// Loading the controller settings and credentials, marking the element processed and rescheduling remain on the loop task.
+// While the element is in flight, it stays at the front of the queue and is owned by the worker,
+// which may change it (checkDone() of C008/C010). See firstIdle().
+#define DEFINE_Cxxx_DELAY_QUEUE_MACRO_CPP_WORKER(NNN, M)                                                               \
+  C##NNN####M##_DelayHandler_t *C##NNN####M##_DelayHandler = nullptr;                                                  \
+  void process_c##NNN####M##_delay_queue() {                                                                           \
+    if (C##NNN####M##_DelayHandler == nullptr) return;                                                                 \
+    if (C##NNN####M##_DelayHandler->inFlight) return;                                                                  \
+    C##NNN####M##_queue_element *element(C##NNN####M##_DelayHandler->getNext());                                       \
+    if (element == nullptr) return;                                                                                    \
+    MakeControllerSettings(ControllerSettings);                                                                        \
+    bool ready = true;                                                                                                 \
+    if (!AllocatedControllerSettings()) {                                                                              \
+      ready = false;                                                                                                   \
+    } else {                                                                                                           \
+      LoadControllerSettings(element->controller_idx, ControllerSettings);                                             \
+      C##NNN####M##_DelayHandler->configureControllerSettings(ControllerSettings);                                     \
+      if (!C##NNN####M##_DelayHandler->readyToProcess(*element)) { ready = false; }                                    \
+    }                                                                                                                  \
+    if (ready) {                                                                                                       \
+      ControllerSettingsStruct_ptr_type settings(ControllerSettingsStruct_ptr);                                        \
+      const ControllerCredentials_t credentials(element->controller_idx, ControllerSettings);                          \
+      C##NNN####M##_DelayHandler->inFlight = true;                                                                     \
+      if (ControllerWorker_post(                                                                                       \
+            [element, settings, credentials]() {                                                                       \
+              setWorkerControllerCredentials(&credentials);                                                            \
+              const bool result = do_process_c##NNN####M##_delay_queue(M, *element, *settings);                        \
+              setWorkerControllerCredentials(nullptr);                                                                 \
+              return result;                                                                                           \
+            },                                                                                                         \
+            [](bool result, uint64_t usec) {                                                                           \
+              if (C##NNN####M##_DelayHandler == nullptr) return;                                                       \
+              C##NNN####M##_DelayHandler->inFlight = false;                                                            \
+              C##NNN####M##_DelayHandler->markProcessed(result);                                                       \
+              ADD_TIMER_STAT(C##NNN####M##_DELAY_QUEUE, usec);                                                         \
+              Scheduler.scheduleNextDelayQueue(ESPEasy_Scheduler::IntervalTimer_e::TIMER_C##NNN####M##_DELAY_QUEUE, C##NNN####M##_DelayHandler->getNextScheduleTime()); \
+            })) {                                                                                                      \
+        return;                                                                                                        \
+      }                                                                                                                \
+      C##NNN####M##_DelayHandler->inFlight = false;                                                                    \
+      START_TIMER;                                                                                                     \
+      C##NNN####M##_DelayHandler->markProcessed(do_process_c##NNN####M##_delay_queue(M, *element, ControllerSettings)); \
+      STOP_TIMER(C##NNN####M##_DELAY_QUEUE);                                                                           \
+    }                                                                                                                  \
+    Scheduler.scheduleNextDelayQueue(ESPEasy_Scheduler::IntervalTimer_e::TIMER_C##NNN####M##_DELAY_QUEUE, C##NNN####M##_DelayHandler->getNextScheduleTime());         \
+  }                                                                                                                    \
+  bool init_c##NNN####M##_delay_queue(controllerIndex_t ControllerIndex) {                                             \
+    if (C##NNN####M##_DelayHandler == nullptr) {                                                                       \
+      C##NNN####M##_DelayHandler = new (std::nothrow) (C##NNN####M##_DelayHandler_t);                                  \
+    }                                                                                                                  \
+    if (C##NNN####M##_DelayHandler == nullptr) { return false; }                                                       \
+    MakeControllerSettings(ControllerSettings);                                                                        \
+    if (!AllocatedControllerSettings()) {                                                                              \
+      return false;                                                                                                    \
+    }                                                                                                                  \
+    LoadControllerSettings(ControllerIndex, ControllerSettings);                                                       \
+    C##NNN####M##_DelayHandler->configureControllerSettings(ControllerSettings);                                       \
+    return true;                                                                                                       \
+  }                                                                                                                    \
+  void exit_c##NNN####M##_delay_queue() {                                                                              \
+    if (C##NNN####M##_DelayHandler != nullptr) {                                                                       \
+      ControllerWorker_waitIdle();                                                                                     \
+      delete C##NNN####M##_DelayHandler;                                                                               \
+      C##NNN####M##_DelayHandler = nullptr;                                                                            \
+    }                                                                                                                  \
+  }                                                                                                                    \
+
+#else // ifdef USES_CONTROLLER_WORKER
+
+#define DEFINE_Cxxx_DELAY_QUEUE_MACRO_CPP_WORKER(NNN, M) DEFINE_Cxxx_DELAY_QUEUE_MACRO_CPP(NNN, M)
+
+#endif // ifdef USES_CONTROLLER_WORKER
+
 
 // Uncrustify must not be used on macros, but we're now done, so turn Uncrustify on again.
 // *INDENT-ON*
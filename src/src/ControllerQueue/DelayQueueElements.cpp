@@ -41,13 +41,19 @@ void exit_mqtt_delay_queue() {
 
 #endif // USES_MQTT
 
+// Controllers defined using DEFINE_Cxxx_DELAY_QUEUE_MACRO_CPP_WORKER send their data from
+// the controller worker task, when USES_CONTROLLER_WORKER is defined.
+// Their do_process_cNNN_delay_queue function must not use global state.
+// Controller settings and credentials are captured into the job, connection results,
+// log lines and the status LED are handed back to the loop task.
+
 
 /*********************************************************************************************\
 * C001_queue_element for queueing requests for C001.
 \*********************************************************************************************/
 #ifdef USES_C001
 # define C001_queue_element simple_queue_element_string_only
-DEFINE_Cxxx_DELAY_QUEUE_MACRO_CPP(00,  1)  // -V522
+DEFINE_Cxxx_DELAY_QUEUE_MACRO_CPP_WORKER(00,  1)  // -V522
 #endif // ifdef USES_C001
 
 /*********************************************************************************************\
@@ -55,11 +61,11 @@ DEFINE_Cxxx_DELAY_QUEUE_MACRO_CPP(00,  1)  // -V522
 \*********************************************************************************************/
 #ifdef USES_C003
 # define C003_queue_element simple_queue_element_string_only
-DEFINE_Cxxx_DELAY_QUEUE_MACRO_CPP(00,  3)  // -V522
+DEFINE_Cxxx_DELAY_QUEUE_MACRO_CPP_WORKER(00,  3)  // -V522
 #endif // ifdef USES_C003
 
 #ifdef USES_C004
-DEFINE_Cxxx_DELAY_QUEUE_MACRO_CPP(00,  4)  // -V522
+DEFINE_Cxxx_DELAY_QUEUE_MACRO_CPP_WORKER(00,  4)  // -V522
 #endif // ifdef USES_C004
 
 #ifdef USES_C007
@@ -75,7 +81,7 @@ DEFINE_Cxxx_DELAY_QUEUE_MACRO_CPP(00,  7)  // -V522
 \*********************************************************************************************/
 #ifdef USES_C008
 # define C008_queue_element queue_element_single_value_base
-DEFINE_Cxxx_DELAY_QUEUE_MACRO_CPP(00,  8)  // -V522
+DEFINE_Cxxx_DELAY_QUEUE_MACRO_CPP_WORKER(00,  8)  // -V522
 #endif // ifdef USES_C008
 
 #ifdef USES_C009
@@ -90,7 +96,7 @@ DEFINE_Cxxx_DELAY_QUEUE_MACRO_CPP(00,  9)  // -V522
 \*********************************************************************************************/
 #ifdef USES_C010
 # define C010_queue_element queue_element_single_value_base
-DEFINE_Cxxx_DELAY_QUEUE_MACRO_CPP( 0, 10)  // -V522
+DEFINE_Cxxx_DELAY_QUEUE_MACRO_CPP_WORKER( 0, 10)  // -V522
 #endif // ifdef USES_C010
 
 
@@ -99,7 +105,7 @@ DEFINE_Cxxx_DELAY_QUEUE_MACRO_CPP( 0, 10)  // -V522
 * C011_queue_element for queueing requests for 011: Generic HTTP Advanced
 \*********************************************************************************************/
 #ifdef USES_C011
-DEFINE_Cxxx_DELAY_QUEUE_MACRO_CPP( 0, 11)  // -V522
+DEFINE_Cxxx_DELAY_QUEUE_MACRO_CPP_WORKER( 0, 11)  // -V522
 #endif // ifdef USES_C011
 
 
@@ -1619,6 +1619,12 @@ To create/register a plugin, you have to :
   #endif
 #endif
 
+#if defined(USES_P120) || defined(USES_P125)
+  #ifndef PLUGIN_USES_VIBRATION_FEATURES
+    #define PLUGIN_USES_VIBRATION_FEATURES // RMS, peak, crest factor and FFT band energy of sample bursts
+  #endif
+#endif
+
 /*
 #if defined(USES_P00x) || defined(USES_P00y)
 #include <the_required_lib.h>
@@ -1771,6 +1777,26 @@ To create/register a plugin, you have to :
   #undef USES_TIMING_STATS
 #endif
 
+// Sampling profiler (/profile) is part of the timing stats diagnostics
+#if defined(USES_TIMING_STATS) && !defined(USES_SAMPLING_PROFILER) && !defined(NO_SAMPLING_PROFILER)
+  #define USES_SAMPLING_PROFILER
+#endif
+
+// Aggregation of task values (min, max, mean, percentiles, ...) before sending to controllers
+#if !defined(LIMIT_BUILD_SIZE) && !defined(USES_TASK_VALUE_AGGREGATION) && !defined(NO_TASK_VALUE_AGGREGATION)
+  #define USES_TASK_VALUE_AGGREGATION
+#endif
+
+// Report by exception: only send task values to controllers when changed more than a deadband
+#if !defined(LIMIT_BUILD_SIZE) && !defined(USES_TASK_VALUE_DEADBAND) && !defined(NO_TASK_VALUE_DEADBAND)
+  #define USES_TASK_VALUE_DEADBAND
+#endif
+
+// Controller worker task needs a second core
+#if defined(USES_CONTROLLER_WORKER) && !defined(ESP32)
+  #undef USES_CONTROLLER_WORKER
+#endif
+
 
 #ifdef BUILD_NO_DEBUG
   #ifndef BUILD_NO_DIAGNOSTIC_COMMANDS
@@ -1796,6 +1822,13 @@ To create/register a plugin, you have to :
   #endif
 #endif
 
+  // Serve embedded CSS/JS as separate gzip compressed files with content hash in the URL
+#if defined(WEBSERVER_CSS) || defined(WEBSERVER_INCLUDE_JS)
+  #ifndef WEBSERVER_STATIC_ASSETS
+    #define WEBSERVER_STATIC_ASSETS
+  #endif
+#endif
+
 #if defined(USES_C002) || defined (USES_C005) || defined(USES_C006) || defined(USES_C014) || defined(USES_P037)
   #define USES_MQTT
 #endif
@@ -42,3 +42,146 @@ bool C013_SensorDataStruct::isValid() const
   }
   return true;
 }
+
+void C013_DeltaSender::queueTask(taskIndex_t sourceTaskIndex, taskIndex_t destTaskIndex, const float *values)
+{
+  if (!validTaskIndex(sourceTaskIndex) || !validTaskIndex(destTaskIndex) || (values == nullptr)) { return; }
+  C013_DeltaSendTaskState& state = tasks[sourceTaskIndex];
+
+  for (uint8_t i = 0; i < VARS_PER_TASK; ++i) {
+    state.values[i] = values[i];
+  }
+
+  if (state.destTaskIndex != destTaskIndex) {
+    state.destTaskIndex = destTaskIndex;
+    state.fullUpdate    = true;
+  }
+  state.pending = true;
+}
+
+void C013_DeltaSender::markFullUpdate(taskIndex_t sourceTaskIndex)
+{
+  if (!validTaskIndex(sourceTaskIndex)) { return; }
+  tasks[sourceTaskIndex].fullUpdate = true;
+
+  if (validTaskIndex(tasks[sourceTaskIndex].destTaskIndex)) {
+    tasks[sourceTaskIndex].pending = true;
+  }
+}
+
+bool C013_DeltaSender::hasPending() const
+{
+  for (taskIndex_t x = 0; x < TASKS_MAX; ++x) {
+    if (tasks[x].pending) { return true; }
+  }
+  return false;
+}
+
+size_t C013_DeltaSender::buildPacket(uint8_t sourceUnit, uint8_t destUnit, uint8_t *buffer, size_t maxSize)
+{
+  if ((buffer == nullptr) || (maxSize < C013_DELTA_HEADER_SIZE)) { return 0; }
+  buffer[0] = 255;
+  buffer[1] = C013_MSG_ID_DELTA_DATA;
+  buffer[2] = sourceUnit;
+  buffer[3] = destUnit;
+  buffer[4] = 0;
+  size_t pos = C013_DELTA_HEADER_SIZE;
+
+  for (taskIndex_t x = 0; x < TASKS_MAX; ++x) {
+    C013_DeltaSendTaskState& state = tasks[x];
+
+    if (!state.pending) { continue; }
+
+    const uint8_t nextSequence = state.sequence + 1;
+
+    if ((nextSequence % C013_DELTA_FULL_INTERVAL) == 0) {
+      state.fullUpdate = true;
+    }
+
+    uint8_t      valueMask = 0;
+    const float *values    = state.values;
+
+    for (uint8_t i = 0; i < VARS_PER_TASK; ++i) {
+      // Compare bit patterns, so NaN values are also detected as unchanged.
+      if (state.fullUpdate || (memcmp(&values[i], &state.lastValues[i], sizeof(float)) != 0)) {
+        valueMask |= (1 << i);
+      }
+    }
+
+    if (valueMask == 0) {
+      // Nothing changed since last sent, no need to waste a sequence number.
+      state.pending = false;
+      continue;
+    }
+
+    uint8_t nrValues = 0;
+
+    for (uint8_t i = 0; i < VARS_PER_TASK; ++i) {
+      if (valueMask & (1 << i)) { ++nrValues; }
+    }
+    const size_t entrySize = C013_DELTA_ENTRY_HEADER_SIZE + nrValues * sizeof(float);
+
+    if ((pos + entrySize) > maxSize) {
+      // Leave it pending for the next packet.
+      break;
+    }
+
+    if (state.fullUpdate) {
+      valueMask |= C013_DELTA_FLAG_FULL;
+    }
+
+    buffer[pos++] = x;
+    buffer[pos++] = state.destTaskIndex;
+    buffer[pos++] = nextSequence;
+    buffer[pos++] = valueMask;
+
+    for (uint8_t i = 0; i < VARS_PER_TASK; ++i) {
+      if (valueMask & (1 << i)) {
+        memcpy(&buffer[pos], &values[i], sizeof(float));
+        pos                += sizeof(float);
+        state.lastValues[i] = values[i];
+      }
+    }
+    state.sequence   = nextSequence;
+    state.pending    = false;
+    state.fullUpdate = false;
+    ++buffer[4];
+  }
+
+  if (buffer[4] == 0) { return 0; }
+  return pos;
+}
+
+bool C013_DeltaReceiver::applyEntry(taskIndex_t  destTaskIndex,
+                                    uint8_t      sequence,
+                                    uint8_t      valueMask,
+                                    const uint8_t *entryValues,
+                                    float       *values)
+{
+  if (!validTaskIndex(destTaskIndex) || (entryValues == nullptr) || (values == nullptr)) { return false; }
+  C013_DeltaReceiveTaskState& state = tasks[destTaskIndex];
+
+  const bool fullUpdate = (valueMask & C013_DELTA_FLAG_FULL) != 0;
+
+  if (!fullUpdate) {
+    const uint8_t expected = state.sequence + 1;
+
+    if (state.synced && (sequence != expected)) {
+      state.synced = false;
+    }
+  } else {
+    state.synced = true;
+  }
+  state.sequence = sequence;
+
+  // Always apply the received values as they are the most recent ones.
+  uint8_t valuePos = 0;
+
+  for (uint8_t i = 0; i < VARS_PER_TASK; ++i) {
+    if (valueMask & (1 << i)) {
+      memcpy(&values[i], &entryValues[valuePos], sizeof(float));
+      valuePos += sizeof(float);
+    }
+  }
+  return state.synced;
+}
@@ -42,4 +42,85 @@ struct C013_SensorDataStruct
 };
 
 
+// Capability flags announced in byte 43 of the sysinfo message.
+// Nodes running older builds send 0 there, so they only receive C013_SensorDataStruct.
+#define C013_P2P_CAP_DELTA_DATA      0x01
+
+#define C013_MSG_ID_DATA_PULL        4
+#define C013_MSG_ID_DELTA_DATA       6
+
+// Keep well below UDP_PACKETSIZE_MAX of the receiving end.
+#define C013_DELTA_MAX_PACKET_SIZE   240
+#define C013_DELTA_HEADER_SIZE       5
+#define C013_DELTA_ENTRY_HEADER_SIZE 4
+#define C013_DELTA_FLAG_FULL         0x80
+
+// Send a full update every N sequence numbers, so nodes which missed a resync request still recover.
+#define C013_DELTA_FULL_INTERVAL     32
+
+// Batched delta sensor data (ID 6), sent as broadcast to all nodes announcing C013_P2P_CAP_DELTA_DATA.
+//
+// Header:
+//   uint8_t header (255), ID (6), sourceUnit, destUnit (255 = all), entryCount
+// Per entry:
+//   uint8_t sourceTaskIndex, destTaskIndex, sequence, valueMask
+//   float   value for each bit 0 .. (VARS_PER_TASK - 1) set in valueMask
+//   Bit 7 (C013_DELTA_FLAG_FULL) in valueMask marks a full update.
+//
+// The sequence number is kept per task. A receiver detecting a gap sends
+// a data pull request (ID 4) to get a full update of that task.
+struct C013_DeltaSendTaskState
+{
+  float   values[VARS_PER_TASK]     = { 0 }; // Values to send, taken when queued
+  float   lastValues[VARS_PER_TASK] = { 0 };
+  uint8_t destTaskIndex             = INVALID_TASK_INDEX;
+  uint8_t sequence                  = 0;
+  bool    pending                   = false;
+  bool    fullUpdate                = true;
+};
+
+struct C013_DeltaSender
+{
+  // The values are copied, as the task values may have changed when the packet is built.
+  // (e.g. aggregated values are only set while sending to the controllers)
+  void   queueTask(taskIndex_t  sourceTaskIndex,
+                   taskIndex_t  destTaskIndex,
+                   const float *values);
+
+  void   markFullUpdate(taskIndex_t sourceTaskIndex);
+
+  bool   hasPending() const;
+
+  // Fill buffer with as many pending entries as fit.
+  // The included tasks are no longer pending and their values are considered sent.
+  // Return the packet size, or 0 when nothing was pending.
+  size_t buildPacket(uint8_t  sourceUnit,
+                     uint8_t  destUnit,
+                     uint8_t *buffer,
+                     size_t   maxSize);
+
+  C013_DeltaSendTaskState tasks[TASKS_MAX];
+};
+
+struct C013_DeltaReceiveTaskState
+{
+  uint8_t sequence = 0;
+  bool    synced   = false;
+};
+
+struct C013_DeltaReceiver
+{
+  // Apply a single entry to the values array (VARS_PER_TASK floats).
+  // entryValues points to the (possibly unaligned) packed floats of the entry.
+  // Return false when the entry could not be applied in sequence and a full update is needed.
+  bool applyEntry(taskIndex_t  destTaskIndex,
+                  uint8_t      sequence,
+                  uint8_t      valueMask,
+                  const uint8_t *entryValues,
+                  float       *values);
+
+  C013_DeltaReceiveTaskState tasks[TASKS_MAX];
+};
+
+
 #endif // DATASTRUCTS_C013_P2P_DATASTRUCTS_H
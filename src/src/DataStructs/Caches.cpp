@@ -19,6 +19,27 @@ void Caches::updateTaskCaches() {
   taskIndexName.clear();
   taskIndexValueName.clear();
   updateActiveTaskUseSerial0();
+  updateTaskTickSubscriptions();
+}
+
+void Caches::updateTaskTickSubscriptions() {
+  tasksTenPerSecond.clear();
+  tasksFiftyPerSecond.clear();
+
+  for (taskIndex_t task = 0; validTaskIndex(task); ++task)
+  {
+    const deviceIndex_t DeviceIndex = getDeviceIndex_from_TaskIndex(task);
+
+    if (Settings.TaskDeviceEnabled[task] && validDeviceIndex(DeviceIndex)) {
+      if (Device[DeviceIndex].TenPerSecond) {
+        tasksTenPerSecond.push_back(task);
+      }
+
+      if (Device[DeviceIndex].FiftyPerSecond) {
+        tasksFiftyPerSecond.push_back(task);
+      }
+    }
+  }
 }
 
 void Caches::updateActiveTaskUseSerial0() {
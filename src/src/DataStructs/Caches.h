@@ -2,9 +2,11 @@
 #define DATASTRUCTS_CACHES_H
 
 #include <map>
+#include <vector>
 #include "../../ESPEasy_common.h"
 #include "../Globals/Plugins.h"
 
+#include "../Helpers/AssetPack.h"
 #include "../Helpers/RulesHelper.h"
 
 typedef std::map<String, taskIndex_t>TaskIndexNameMap;
@@ -18,10 +20,18 @@ struct Caches {
 
   void updateActiveTaskUseSerial0();
 
+  // Collect the enabled tasks whose plugin needs the 10x or 50x per second calls.
+  void updateTaskTickSubscriptions();
+
   TaskIndexNameMap      taskIndexName;
   TaskIndexValueNameMap taskIndexValueName;
   FilePresenceMap       fileExistsMap;
   RulesHelperClass      rulesHelper;
+#ifdef USE_ASSET_PACK
+  AssetPackClass        assetPack;
+#endif // ifdef USE_ASSET_PACK
+  std::vector<taskIndex_t> tasksTenPerSecond;
+  std::vector<taskIndex_t> tasksFiftyPerSecond;
   bool                  activeTaskUseSerial0 = false;
 };
 
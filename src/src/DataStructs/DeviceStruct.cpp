@@ -6,7 +6,7 @@ DeviceStruct::DeviceStruct() :
   PullUpOption(false), InverseLogicOption(false), FormulaOption(false),
   Custom(false), SendDataOption(false), GlobalSyncOption(false),
   TimerOption(false), TimerOptional(false), DecimalsOnly(false),
-  ExitTaskBeforeSave(true) {}
+  ExitTaskBeforeSave(true), TenPerSecond(false), FiftyPerSecond(false) {}
 
 bool DeviceStruct::connectedToGPIOpins() const {
   switch(Type) {
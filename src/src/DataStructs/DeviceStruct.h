@@ -94,6 +94,8 @@ struct DeviceStruct
   bool TimerOptional      : 1;       // When taskdevice timer is not set and not optional, use default "Interval" delay (Settings.Delay)
   bool DecimalsOnly       : 1;       // Allow to set the number of decimals (otherwise treated a 0 decimals)
   bool ExitTaskBeforeSave : 1;       // Optimization in memory usage, Do not exit when task data is needed during save.
+  bool TenPerSecond       : 1;       // Call PLUGIN_TEN_PER_SECOND on tasks using this plugin
+  bool FiftyPerSecond     : 1;       // Call PLUGIN_FIFTY_PER_SECOND on tasks using this plugin
 };
 typedef std::vector<DeviceStruct> DeviceVector;
 
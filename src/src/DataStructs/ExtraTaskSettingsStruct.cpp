@@ -2,6 +2,10 @@
 
 #include "../../ESPEasy_common.h"
 
+#include "../DataTypes/TaskValueAggregate.h"
+
+#include "../Helpers/Numerical.h"
+
 ExtraTaskSettingsStruct::ExtraTaskSettingsStruct() : TaskIndex(INVALID_TASK_INDEX) {
   clear();
 }
@@ -11,7 +15,10 @@ void ExtraTaskSettingsStruct::clear() {
   ZERO_FILL(TaskDeviceName);
 
   for (uint8_t i = 0; i < VARS_PER_TASK; ++i) {
-    TaskDeviceValueDecimals[i] = 2;
+    TaskDeviceValueDecimals[i]  = 2;
+    TaskDeviceValueAggregate[i] = static_cast<uint8_t>(TaskValueAggregate_e::None);
+    TaskDeviceValueDeadband[i]        = 0.0f;
+    TaskDeviceValueDeadbandPercent[i] = 0.0f;
     ZERO_FILL(TaskDeviceFormula[i]);
     ZERO_FILL(TaskDeviceValueNames[i]);
   }
@@ -20,6 +27,11 @@ void ExtraTaskSettingsStruct::clear() {
     TaskDevicePluginConfigLong[i] = 0;
     TaskDevicePluginConfig[i]     = 0;
   }
+  AggregateWindowCount = 0;
+  AggregateWindowTime  = 0;
+  AggregateFlags       = 0;
+  unused1              = 0;
+  DeadbandHeartbeat    = 0;
 }
 
 void ExtraTaskSettingsStruct::validate() {
@@ -28,7 +40,28 @@ void ExtraTaskSettingsStruct::validate() {
   for (uint8_t i = 0; i < VARS_PER_TASK; ++i) {
     ZERO_TERMINATE(TaskDeviceFormula[i]);
     ZERO_TERMINATE(TaskDeviceValueNames[i]);
+
+    if (TaskDeviceValueAggregate[i] >= static_cast<uint8_t>(TaskValueAggregate_e::MAX_TYPE)) {
+      // Settings stored before aggregation was added may contain anything here.
+      TaskDeviceValueAggregate[i] = static_cast<uint8_t>(TaskValueAggregate_e::None);
+    }
+
+    if (!isValidFloat(TaskDeviceValueDeadband[i]) || (TaskDeviceValueDeadband[i] < 0.0f)) {
+      TaskDeviceValueDeadband[i] = 0.0f;
+    }
+
+    if (!isValidFloat(TaskDeviceValueDeadbandPercent[i]) || (TaskDeviceValueDeadbandPercent[i] < 0.0f)) {
+      TaskDeviceValueDeadbandPercent[i] = 0.0f;
+    }
+  }
+
+  if (!valueAggregationSet()) {
+    // Window settings are only used with an aggregate set.
+    AggregateWindowCount = 0;
+    AggregateWindowTime  = 0;
+    AggregateFlags       = 0;
   }
+  AggregateFlags &= 0x01; // Only bit 0 is used
 }
 
 bool ExtraTaskSettingsStruct::checkUniqueValueNames() const {
@@ -46,7 +79,10 @@ bool ExtraTaskSettingsStruct::checkUniqueValueNames() const {
 
 void ExtraTaskSettingsStruct::clearUnusedValueNames(uint8_t usedVars) {
   for (uint8_t i = usedVars; i < VARS_PER_TASK; ++i) {
-    TaskDeviceValueDecimals[i] = 2;
+    TaskDeviceValueDecimals[i]  = 2;
+    TaskDeviceValueAggregate[i] = static_cast<uint8_t>(TaskValueAggregate_e::None);
+    TaskDeviceValueDeadband[i]        = 0.0f;
+    TaskDeviceValueDeadbandPercent[i] = 0.0f;
     ZERO_FILL(TaskDeviceFormula[i]);
     ZERO_FILL(TaskDeviceValueNames[i]);
   }
@@ -97,4 +133,34 @@ bool ExtraTaskSettingsStruct::validCharForNames(char c) {
     (c == '}'))
       return false;
   return true;
-}
\ No newline at end of file
+}
+
+bool ExtraTaskSettingsStruct::valueAggregationSet() const {
+  for (uint8_t i = 0; i < VARS_PER_TASK; ++i) {
+    if (TaskDeviceValueAggregate[i] != static_cast<uint8_t>(TaskValueAggregate_e::None)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool ExtraTaskSettingsStruct::aggregateRawRuleEvents() const {
+  return bitRead(AggregateFlags, 0);
+}
+
+void ExtraTaskSettingsStruct::aggregateRawRuleEvents(bool value) {
+  bitWrite(AggregateFlags, 0, value);
+}
+
+bool ExtraTaskSettingsStruct::valueDeadbandSet() const {
+  if (DeadbandHeartbeat != 0) {
+    return true;
+  }
+
+  for (uint8_t i = 0; i < VARS_PER_TASK; ++i) {
+    if ((TaskDeviceValueDeadband[i] > 0.0f) || (TaskDeviceValueDeadbandPercent[i] > 0.0f)) {
+      return true;
+    }
+  }
+  return false;
+}
@@ -32,6 +32,15 @@ struct ExtraTaskSettingsStruct
 
   static bool validCharForNames(char character);
 
+  // Returns true when at least one value has an aggregate set.
+  bool valueAggregationSet() const;
+
+  bool aggregateRawRuleEvents() const;
+  void aggregateRawRuleEvents(bool value);
+
+  // Returns true when report by exception is set: a deadband for at least one value or a max. silent interval.
+  bool valueDeadbandSet() const;
+
   taskIndex_t  TaskIndex;  // Always < TASKS_MAX or INVALID_TASK_INDEX
   char    TaskDeviceName[NAME_FORMULA_LENGTH_MAX + 1];
   char    TaskDeviceFormula[VARS_PER_TASK][NAME_FORMULA_LENGTH_MAX + 1];
@@ -39,6 +48,18 @@ struct ExtraTaskSettingsStruct
   long    TaskDevicePluginConfigLong[PLUGIN_EXTRACONFIGVAR_MAX];
   uint8_t    TaskDeviceValueDecimals[VARS_PER_TASK];
   int16_t TaskDevicePluginConfig[PLUGIN_EXTRACONFIGVAR_MAX];
+
+  // Aggregation of values over a window before sending to controllers.
+  uint8_t  TaskDeviceValueAggregate[VARS_PER_TASK]; // TaskValueAggregate_e
+  uint16_t AggregateWindowCount;                     // Max. nr. of samples per window, 0 = not used
+  uint16_t AggregateWindowTime;                      // Max. seconds per window, 0 = task interval
+  uint8_t  AggregateFlags;                           // Bit 0: Rules events use raw values
+  uint8_t  unused1;                                  // Force alignment of DeadbandHeartbeat
+
+  // Report by exception: only send to controllers when a value has changed more than its deadband.
+  uint16_t DeadbandHeartbeat;                             // Max. seconds without sending, 0 = not used
+  float    TaskDeviceValueDeadband[VARS_PER_TASK];        // Absolute, 0 = not used
+  float    TaskDeviceValueDeadbandPercent[VARS_PER_TASK]; // Percentage of the last sent value, 0 = not used
 };
 
 
@@ -16,7 +16,7 @@ const __FlashStringHelper * getNodeTypeDisplayString(uint8_t nodeType) {
 }
 
   NodeStruct::NodeStruct() :
-    build(0), age(0), nodeType(0), webgui_portnumber(0)
+    build(0), age(0), nodeType(0), webgui_portnumber(0), p2p_capabilities(0)
   {
     for (uint8_t i = 0; i < 4; ++i) { ip[i] = 0; }
   }
@@ -30,6 +30,7 @@ struct NodeStruct
   uint8_t   age;
   uint8_t   nodeType;
   uint16_t  webgui_portnumber;
+  uint8_t   p2p_capabilities;
 };
 typedef std::map<uint8_t, NodeStruct> NodesMap;
 
@@ -0,0 +1,50 @@
+#include "../DataStructs/PluginCommandRouting.h"
+
+#include "../Globals/Plugins.h"
+#include "../Helpers/CRC_functions.h"
+
+void PluginCommandRouting::clear(taskIndex_t taskIndex)
+{
+  _taskCommands.erase(taskIndex);
+}
+
+void PluginCommandRouting::addCommand(taskIndex_t taskIndex, const __FlashStringHelper *command)
+{
+  addCommand(taskIndex, String(command));
+}
+
+void PluginCommandRouting::addCommand(taskIndex_t taskIndex, const String& command)
+{
+  if (!validTaskIndex(taskIndex) || command.isEmpty()) { return; }
+  String command_lc(command);
+
+  command_lc.toLowerCase();
+  const uint32_t hash = getCommandHash(command_lc);
+
+  CommandHashes& hashes = _taskCommands[taskIndex];
+
+  for (auto it = hashes.begin(); it != hashes.end(); ++it) {
+    if (*it == hash) { return; }
+  }
+  hashes.push_back(hash);
+}
+
+bool PluginCommandRouting::mayHandleCommand(taskIndex_t taskIndex, uint32_t commandHash) const
+{
+  auto it = _taskCommands.find(taskIndex);
+
+  if (it == _taskCommands.end()) {
+    // Task did not declare its commands, so it may handle any command.
+    return true;
+  }
+
+  for (auto hash_it = it->second.begin(); hash_it != it->second.end(); ++hash_it) {
+    if (*hash_it == commandHash) { return true; }
+  }
+  return false;
+}
+
+uint32_t PluginCommandRouting::getCommandHash(const String& command_lc)
+{
+  return calc_FNV1a_hash_runtime(command_lc.c_str());
+}
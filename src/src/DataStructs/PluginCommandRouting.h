@@ -0,0 +1,44 @@
+#ifndef DATASTRUCTS_PLUGINCOMMANDROUTING_H
+#define DATASTRUCTS_PLUGINCOMMANDROUTING_H
+
+#include "../../ESPEasy_common.h"
+
+#include "../DataTypes/TaskIndex.h"
+
+#include <map>
+#include <vector>
+
+/*********************************************************************************************\
+* PluginCommandRouting
+*
+* Keep track of the command keywords a task handles via PLUGIN_WRITE.
+* Plugins declare their commands during PLUGIN_INIT.
+* Tasks which did not declare any command are still offered all commands,
+* so plugins not (yet) declaring their commands keep working as before.
+\*********************************************************************************************/
+struct PluginCommandRouting {
+  // Remove all declared commands of a task. Called before PLUGIN_INIT and at PLUGIN_EXIT.
+  void     clear(taskIndex_t taskIndex);
+
+  void     addCommand(taskIndex_t                taskIndex,
+                      const __FlashStringHelper *command);
+
+  void     addCommand(taskIndex_t   taskIndex,
+                      const String& command);
+
+  // Check whether the task may handle a command with the given hash.
+  bool     mayHandleCommand(taskIndex_t taskIndex,
+                            uint32_t    commandHash) const;
+
+  // Hash of the lower case command keyword (first argument of the command line)
+  static uint32_t getCommandHash(const String& command_lc);
+
+private:
+
+  typedef std::vector<uint32_t> CommandHashes;
+
+  std::map<taskIndex_t, CommandHashes> _taskCommands;
+};
+
+
+#endif // DATASTRUCTS_PLUGINCOMMANDROUTING_H
@@ -15,6 +15,8 @@
     unused1 = 0;
     unused2 = 0;
     lastSysTime = 0;
+    lastBootSetup_ms = 0;
+    lastBootFirstRead_ms = 0;
   }
 
   void RTCStruct::clearLastWiFi() {
@@ -7,6 +7,7 @@
 #define RTC_BASE_STRUCT 64
 #define RTC_BASE_USERVAR 74
 #define RTC_BASE_CACHE 124
+#define RTC_BASE_WIFI_LEASE 188
 
 #ifdef ESP8266
 #define RTC_CACHE_DATA_SIZE 240  // 10 elements
@@ -53,6 +54,8 @@ struct RTCStruct
   uint8_t unused1 = 0;  // Force alignment to 4 bytes
   uint8_t unused2 = 0;
   unsigned long lastSysTime = 0;
+  uint16_t lastBootSetup_ms = 0;     // Duration of ESPEasy_setup() in the last boot
+  uint16_t lastBootFirstRead_ms = 0; // Time since boot of the first sensor read in the last boot
 };
 
 
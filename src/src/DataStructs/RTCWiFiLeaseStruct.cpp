@@ -0,0 +1,29 @@
+#include "../DataStructs/RTCWiFiLeaseStruct.h"
+
+#include "../Helpers/CRC_functions.h"
+
+
+void RTCWiFiLeaseStruct::clear() {
+  ip                 = 0;
+  gateway            = 0;
+  dns                = 0;
+  leaseRemaining_min = 0;
+  subnetPrefix       = 0;
+  checksum           = 0;
+}
+
+bool RTCWiFiLeaseStruct::isValid() const {
+  return ip != 0 &&
+         leaseRemaining_min != 0 &&
+         subnetPrefix != 0 && subnetPrefix <= 32 &&
+         checksum == computeChecksum();
+}
+
+void RTCWiFiLeaseStruct::updateChecksum() {
+  checksum = computeChecksum();
+}
+
+uint8_t RTCWiFiLeaseStruct::computeChecksum() const {
+  // All members except the checksum itself.
+  return static_cast<uint8_t>(calc_CRC32(reinterpret_cast<const uint8_t *>(this), sizeof(RTCWiFiLeaseStruct) - sizeof(checksum)));
+}
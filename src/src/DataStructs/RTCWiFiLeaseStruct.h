@@ -0,0 +1,34 @@
+#ifndef DATASTRUCTS_RTCWIFILEASESTRUCT_H
+#define DATASTRUCTS_RTCWIFILEASESTRUCT_H
+
+#include "../../ESPEasy_common.h"
+
+/*********************************************************************************************\
+* RTCWiFiLeaseStruct
+* IP config obtained via DHCP, kept in RTC memory so a node waking from deep sleep
+* can apply it directly instead of waiting for a new DHCP lease.
+* The lease is stored as remaining minutes, as the system time is not known right after wake-up.
+\*********************************************************************************************/
+// max 16 bytes: ( 192 - 188 ) * 4
+struct RTCWiFiLeaseStruct
+{
+  void clear();
+
+  bool isValid() const;
+
+  void updateChecksum();
+
+  uint32_t ip                 = 0;
+  uint32_t gateway            = 0;
+  uint32_t dns                = 0;
+  uint16_t leaseRemaining_min = 0;
+  uint8_t  subnetPrefix       = 0;
+  uint8_t  checksum           = 0;
+
+private:
+
+  uint8_t computeChecksum() const;
+};
+
+
+#endif // DATASTRUCTS_RTCWIFILEASESTRUCT_H
@@ -149,6 +149,10 @@ class SettingsStruct_tmpl
   bool UseLastWiFiFromRTC() const;
   void UseLastWiFiFromRTC(bool value);
 
+  // Keep the DHCP lease in RTC memory during deep sleep and apply it on wake-up.
+  bool UseLastWiFiLeaseFromRTC() const;
+  void UseLastWiFiLeaseFromRTC(bool value);
+
   ExtTimeSource_e ExtTimeSource() const;
   void ExtTimeSource(ExtTimeSource_e value);
 
@@ -0,0 +1,230 @@
+#include "../DataStructs/TaskValueAggregator.h"
+
+#ifdef USES_TASK_VALUE_AGGREGATION
+
+# include "../Helpers/ESPEasy_time_calc.h"
+# include "../Helpers/Numerical.h"
+
+# include <math.h>
+
+
+void QuantileEstimatorP2::reset(float quantile) {
+  _quantile = quantile;
+  _count    = 0;
+}
+
+void QuantileEstimatorP2::add(float value) {
+  if (_count < 5) {
+    // Keep the first samples sorted
+    int i = _count;
+
+    while ((i > 0) && (_q[i - 1] > value)) {
+      _q[i] = _q[i - 1];
+      --i;
+    }
+    _q[i] = value;
+    ++_count;
+
+    if (_count == 5) {
+      for (int m = 0; m < 5; ++m) {
+        _n[m] = m;
+      }
+      _np[0] = 0.0f;
+      _np[1] = 2.0f * _quantile;
+      _np[2] = 4.0f * _quantile;
+      _np[3] = 2.0f + 2.0f * _quantile;
+      _np[4] = 4.0f;
+    }
+    return;
+  }
+  ++_count;
+
+  // Find the cell k in which the value falls, adjust extreme markers if needed.
+  int k;
+
+  if (value < _q[0]) {
+    _q[0] = value;
+    k     = 0;
+  } else if (value >= _q[4]) {
+    _q[4] = value;
+    k     = 3;
+  } else {
+    k = 0;
+
+    while (value >= _q[k + 1]) {
+      ++k;
+    }
+  }
+
+  for (int i = k + 1; i < 5; ++i) {
+    ++_n[i];
+  }
+
+  // Increments of the desired positions
+  const float dn[5] = { 0.0f, _quantile / 2.0f, _quantile, (1.0f + _quantile) / 2.0f, 1.0f };
+
+  for (int i = 0; i < 5; ++i) {
+    _np[i] += dn[i];
+  }
+
+  // Adjust the heights of the middle markers
+  for (int i = 1; i < 4; ++i) {
+    const float d = _np[i] - _n[i];
+
+    if (((d >= 1.0f) && ((_n[i + 1] - _n[i]) > 1)) ||
+        ((d <= -1.0f) && ((_n[i - 1] - _n[i]) < -1))) {
+      const int   ds = (d > 0.0f) ? 1 : -1;
+      const float qp = parabolic(i, ds);
+
+      if ((_q[i - 1] < qp) && (qp < _q[i + 1])) {
+        _q[i] = qp;
+      } else {
+        _q[i] = linear(i, ds);
+      }
+      _n[i] += ds;
+    }
+  }
+}
+
+float QuantileEstimatorP2::get() const {
+  if (_count == 0) {
+    return 0.0f;
+  }
+
+  if (_count < 5) {
+    // Exact, nearest rank
+    return _q[static_cast<int>(lroundf(_quantile * (_count - 1)))];
+  }
+  return _q[2];
+}
+
+float QuantileEstimatorP2::parabolic(int i, int d) const {
+  return _q[i] + static_cast<float>(d) / (_n[i + 1] - _n[i - 1]) *
+         ((_n[i] - _n[i - 1] + d) * (_q[i + 1] - _q[i]) / (_n[i + 1] - _n[i]) +
+          (_n[i + 1] - _n[i] - d) * (_q[i] - _q[i - 1]) / (_n[i] - _n[i - 1]));
+}
+
+float QuantileEstimatorP2::linear(int i, int d) const {
+  return _q[i] + d * (_q[i + d] - _q[i]) / (_n[i + d] - _n[i]);
+}
+
+void TaskValueStats::reset(TaskValueAggregate_e aggregate) {
+  _aggregate = aggregate;
+  _count     = 0;
+  _mean      = 0.0;
+  _M2        = 0.0;
+  _min       = 0.0f;
+  _max       = 0.0f;
+  _last      = 0.0f;
+
+  const float quantile = getQuantile(aggregate);
+
+  if (quantile >= 0.0f) {
+    _quantile.reset(quantile);
+  }
+}
+
+void TaskValueStats::add(float value) {
+  if (!isValidFloat(value)) {
+    return;
+  }
+  ++_count;
+  _last = value;
+
+  if (_count == 1) {
+    _min = value;
+    _max = value;
+  } else {
+    if (value < _min) { _min = value; }
+
+    if (value > _max) { _max = value; }
+  }
+
+  const double delta = value - _mean;
+
+  _mean += delta / _count;
+  _M2   += delta * (value - _mean);
+
+  if (getQuantile(_aggregate) >= 0.0f) {
+    _quantile.add(value);
+  }
+}
+
+float TaskValueStats::get() const {
+  switch (_aggregate) {
+    case TaskValueAggregate_e::None:
+    case TaskValueAggregate_e::Last:   return _last;
+    case TaskValueAggregate_e::Min:    return _min;
+    case TaskValueAggregate_e::Max:    return _max;
+    case TaskValueAggregate_e::Mean:   return _mean;
+    case TaskValueAggregate_e::StdDev: return (_count > 1) ? sqrt(_M2 / (_count - 1)) : 0.0f;
+    case TaskValueAggregate_e::Count:  return _count;
+    case TaskValueAggregate_e::Median:
+    case TaskValueAggregate_e::Percentile_90:
+    case TaskValueAggregate_e::Percentile_95:
+    case TaskValueAggregate_e::Percentile_99:
+      return _quantile.get();
+    case TaskValueAggregate_e::MAX_TYPE:
+      break;
+  }
+  return _last;
+}
+
+void TaskValueAggregator::reset(const TaskValueAggregate_e aggregates[VARS_PER_TASK],
+                                uint16_t                   windowCount,
+                                uint32_t                   windowTime_ms) {
+  for (uint8_t i = 0; i < VARS_PER_TASK; ++i) {
+    _aggregates[i] = aggregates[i];
+  }
+  _windowCount   = windowCount;
+  _windowTime_ms = windowTime_ms;
+  nextWindow();
+}
+
+bool TaskValueAggregator::configChanged(const TaskValueAggregate_e aggregates[VARS_PER_TASK],
+                                        uint16_t                   windowCount,
+                                        uint32_t                   windowTime_ms) const {
+  if ((windowCount != _windowCount) || (windowTime_ms != _windowTime_ms)) {
+    return true;
+  }
+
+  for (uint8_t i = 0; i < VARS_PER_TASK; ++i) {
+    if (_aggregates[i] != aggregates[i]) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool TaskValueAggregator::add(const float values[VARS_PER_TASK]) {
+  if (_samples == 0) {
+    _windowStart = millis();
+  }
+  ++_samples;
+
+  for (uint8_t i = 0; i < VARS_PER_TASK; ++i) {
+    _stats[i].add(values[i]);
+  }
+
+  if ((_windowCount != 0) && (_samples >= _windowCount)) {
+    return true;
+  }
+  return (_windowTime_ms != 0) && (timePassedSince(_windowStart) >= static_cast<long>(_windowTime_ms));
+}
+
+float TaskValueAggregator::get(uint8_t valueIndex) const {
+  if (valueIndex < VARS_PER_TASK) {
+    return _stats[valueIndex].get();
+  }
+  return 0.0f;
+}
+
+void TaskValueAggregator::nextWindow() {
+  for (uint8_t i = 0; i < VARS_PER_TASK; ++i) {
+    _stats[i].reset(_aggregates[i]);
+  }
+  _samples     = 0;
+  _windowStart = millis();
+}
+
+#endif // ifdef USES_TASK_VALUE_AGGREGATION
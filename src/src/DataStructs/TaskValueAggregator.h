@@ -0,0 +1,103 @@
+#ifndef DATASTRUCTS_TASKVALUEAGGREGATOR_H
+#define DATASTRUCTS_TASKVALUEAGGREGATOR_H
+
+#include "../../ESPEasy_common.h"
+
+#ifdef USES_TASK_VALUE_AGGREGATION
+
+# include "../CustomBuild/ESPEasyLimits.h"
+# include "../DataTypes/TaskValueAggregate.h"
+
+
+/*********************************************************************************************\
+* P² quantile estimator (Jain & Chlamtac, 1985)
+* Estimates a single quantile using 5 markers, so constant memory and O(1) per sample.
+* The first 5 samples are kept as-is, so small windows give the exact quantile.
+\*********************************************************************************************/
+struct QuantileEstimatorP2 {
+  void  reset(float quantile);
+
+  void  add(float value);
+
+  float get() const;
+
+private:
+
+  float parabolic(int i,
+                  int d) const;
+
+  float linear(int i,
+               int d) const;
+
+  float    _quantile = 0.5f;
+  float    _q[5]     = { 0 };  // Marker heights
+  float    _np[5]    = { 0 };  // Desired marker positions
+  int32_t  _n[5]     = { 0 };  // Actual marker positions
+  uint32_t _count    = 0;
+};
+
+
+/*********************************************************************************************\
+* Running statistics of a single task value.
+* Mean and variance use Welford's algorithm, which is numerically stable.
+\*********************************************************************************************/
+struct TaskValueStats {
+  void  reset(TaskValueAggregate_e aggregate);
+
+  void  add(float value);
+
+  float get() const;
+
+  uint32_t count() const {
+    return _count;
+  }
+
+private:
+
+  QuantileEstimatorP2  _quantile;
+  double               _mean      = 0.0;
+  double               _M2        = 0.0;
+  float                _min       = 0.0f;
+  float                _max       = 0.0f;
+  float                _last      = 0.0f;
+  uint32_t             _count     = 0;
+  TaskValueAggregate_e _aggregate = TaskValueAggregate_e::None;
+};
+
+
+/*********************************************************************************************\
+* Tumbling window of samples of all values of a task.
+\*********************************************************************************************/
+struct TaskValueAggregator {
+  // @param windowCount  Max. nr of samples in a window, 0 = not used
+  // @param windowTime_ms  Max. duration of a window, 0 = not used
+  void reset(const TaskValueAggregate_e aggregates[VARS_PER_TASK],
+             uint16_t                   windowCount,
+             uint32_t                   windowTime_ms);
+
+  // Returns true when the configuration differs from the one used in reset()
+  bool configChanged(const TaskValueAggregate_e aggregates[VARS_PER_TASK],
+                     uint16_t                   windowCount,
+                     uint32_t                   windowTime_ms) const;
+
+  // Add a sample of all task values.
+  // @retval true when the window is complete
+  bool  add(const float values[VARS_PER_TASK]);
+
+  float get(uint8_t valueIndex) const;
+
+  // Start a new window
+  void  nextWindow();
+
+private:
+
+  TaskValueStats       _stats[VARS_PER_TASK];
+  TaskValueAggregate_e _aggregates[VARS_PER_TASK] = {};
+  unsigned long        _windowStart               = 0;
+  uint32_t             _samples                   = 0;
+  uint32_t             _windowTime_ms             = 0;
+  uint16_t             _windowCount               = 0;
+};
+
+#endif // ifdef USES_TASK_VALUE_AGGREGATION
+#endif // ifndef DATASTRUCTS_TASKVALUEAGGREGATOR_H
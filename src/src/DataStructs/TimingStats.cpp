@@ -10,23 +10,46 @@
 #ifdef USES_TIMING_STATS
 
 
-std::map<int, TimingStats> pluginStats;
-std::map<int, TimingStats> controllerStats;
-std::map<int, TimingStats> miscStats;
+TimingStatsSlots<TIMING_STATS_PLUGIN_SLOTS> pluginStats;
+TimingStatsSlots<TIMING_STATS_CONTROLLER_SLOTS> controllerStats;
+TimingStatsSlots<TIMING_STATS_MISC_SLOTS> miscStats;
 unsigned long timingstats_last_reset(0);
 
 
-
-
-TimingStats::TimingStats() : _timeTotal(0.0f), _count(0), _maxVal(0), _minVal(4294967295) {}
+TimingStats::TimingStats() {
+  clear();
+}
 
 void TimingStats::add(int64_t time) {
-  _timeTotal += static_cast<float>(time);
+  if (time < 0) { time = 0; }
+  const uint32_t usec = time > 0xFFFFFFFFll ? 0xFFFFFFFF : static_cast<uint32_t>(time);
+
+  _timeTotal += static_cast<float>(usec);
   ++_count;
+  _totalUsec += usec;
+  ++_totalCount;
+
+  if (usec > _maxVal) { _maxVal = usec; }
+
+  if (usec < _minVal) { _minVal = usec; }
+
+  uint8_t bucket = 0;
+
+  if (usec >= 16) {
+    bucket = 28 - __builtin_clz(usec);
 
-  if (time > static_cast<int64_t>(_maxVal)) { _maxVal = time; }
+    if (bucket >= TIMING_STATS_NR_BUCKETS) {
+      bucket = TIMING_STATS_NR_BUCKETS - 1;
+    }
+  }
 
-  if (time < static_cast<int64_t>(_minVal)) { _minVal = time; }
+  if (_histogram[bucket] == 0xFFFF) {
+    // Halve all counts to keep the distribution without overflowing.
+    for (uint8_t i = 0; i < TIMING_STATS_NR_BUCKETS; ++i) {
+      _histogram[i] >>= 1;
+    }
+  }
+  ++_histogram[bucket];
 }
 
 void TimingStats::reset() {
@@ -34,6 +57,16 @@ void TimingStats::reset() {
   _count     = 0;
   _maxVal    = 0;
   _minVal    = 4294967295;
+
+  for (uint8_t i = 0; i < TIMING_STATS_NR_BUCKETS; ++i) {
+    _histogram[i] = 0;
+  }
+}
+
+void TimingStats::clear() {
+  reset();
+  _totalUsec  = 0;
+  _totalCount = 0;
 }
 
 bool TimingStats::isEmpty() const {
@@ -45,6 +78,10 @@ float TimingStats::getAvg() const {
   return _timeTotal / static_cast<float>(_count);
 }
 
+float TimingStats::getTotal() const {
+  return _timeTotal;
+}
+
 uint32_t TimingStats::getMinMax(uint64_t& minVal, uint64_t& maxVal) const {
   if (_count == 0) {
     minVal = 0;
@@ -63,6 +100,45 @@ bool TimingStats::thresholdExceeded(const uint64_t& threshold) const {
   return _maxVal > threshold;
 }
 
+uint32_t TimingStats::getPercentile(uint8_t percentile) const {
+  if (_count == 0) {
+    return 0;
+  }
+  uint32_t total = 0;
+
+  for (uint8_t i = 0; i < TIMING_STATS_NR_BUCKETS; ++i) {
+    total += _histogram[i];
+  }
+
+  // Number of samples which should be at or below the requested percentile, rounded up.
+  const uint32_t target = (total * percentile + 99) / 100;
+  uint32_t cumulative   = 0;
+
+  for (uint8_t i = 0; i < TIMING_STATS_NR_BUCKETS; ++i) {
+    if ((cumulative + _histogram[i]) >= target && (_histogram[i] > 0)) {
+      // Interpolate within the bucket, clipped to the actual min/max seen.
+      uint32_t lower = (i == 0) ? 0 : (1ul << (i + 3));
+      uint32_t upper = (i == (TIMING_STATS_NR_BUCKETS - 1)) ? _maxVal : (1ul << (i + 4));
+
+      if (lower < _minVal) { lower = _minVal; }
+
+      if (upper > _maxVal) { upper = _maxVal; }
+
+      if (upper <= lower) { return lower; }
+      const float fraction = static_cast<float>(target - cumulative) / static_cast<float>(_histogram[i]);
+      return lower + static_cast<uint32_t>(fraction * (upper - lower));
+    }
+    cumulative += _histogram[i];
+  }
+  return _maxVal;
+}
+
+void releaseUnusedTimingStats() {
+  pluginStats.releaseUnused();
+  controllerStats.releaseUnused();
+  miscStats.releaseUnused();
+}
+
 /********************************************************************************************\
    Functions used for displaying timing stats
  \*********************************************************************************************/
@@ -240,6 +316,10 @@ const __FlashStringHelper * getMiscStatsName_F(int stat) {
     case HANDLE_SERVING_WEBPAGE:  return F("handle webpage");
     case WIFI_SCAN_ASYNC:         return F("WiFi Scan Async");
     case WIFI_SCAN_SYNC:          return F("WiFi Scan Sync (blocking)");
+    case COMMAND_LOOKUP_INTERNAL: return F("Internal command lookup");
+    case PLUGIN_CALL_WRITE:       return F("Plugin call write (command dispatch)");
+    case I2C_MUX_SWITCH:          return F("I2C multiplexer switch");
+    case I2C_CLOCK_CHANGE:        return F("I2C clock speed change");
     case C018_AIR_TIME:           return F("C018 LoRa TTN - Air Time");
   }
   return F("Unknown");
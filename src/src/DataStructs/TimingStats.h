@@ -11,8 +11,12 @@
 
 #include "../Globals/Settings.h"
 
+# ifdef USES_CONTROLLER_WORKER
+#  include "../Helpers/ControllerWorker.h"
+# endif // ifdef USES_CONTROLLER_WORKER
+
 # include <Arduino.h>
-# include <map>
+# include <new> // std::nothrow
 
 
 /*********************************************************************************************\
@@ -89,6 +93,26 @@
 # define HANDLE_SERVING_WEBPAGE  66
 # define WIFI_SCAN_ASYNC         67
 # define WIFI_SCAN_SYNC          68
+# define COMMAND_LOOKUP_INTERNAL 69
+# define PLUGIN_CALL_WRITE       70
+# define I2C_MUX_SWITCH          71
+# define I2C_CLOCK_CHANGE        72
+
+
+// Log-scale latency histogram.
+// Bucket 0: < 16 usec, bucket n: [2^(n+3) ... 2^(n+4)) usec, last bucket: everything slower.
+# define TIMING_STATS_NR_BUCKETS 16
+
+// Fixed number of stats slots, allocated at once on first use. (about 66 bytes per slot)
+# ifdef ESP8266
+#  define TIMING_STATS_MISC_SLOTS        40
+#  define TIMING_STATS_PLUGIN_SLOTS      32
+#  define TIMING_STATS_CONTROLLER_SLOTS  8
+# else // ifdef ESP8266
+#  define TIMING_STATS_MISC_SLOTS        80
+#  define TIMING_STATS_PLUGIN_SLOTS      64
+#  define TIMING_STATS_CONTROLLER_SLOTS  16
+# endif // ifdef ESP8266
 
 
 class TimingStats {
@@ -97,19 +121,169 @@ public:
   TimingStats();
 
   void         add(int64_t time);
+
+  // Reset the statistics since the last reset, the totals are kept.
   void         reset();
+
+  // Reset everything, including the totals.
+  void         clear();
   bool         isEmpty() const;
   float        getAvg() const;
+  float        getTotal() const;
   uint32_t     getMinMax(uint64_t& minVal,
                          uint64_t& maxVal) const;
   bool         thresholdExceeded(const uint64_t& threshold) const;
 
+  // Estimate of the given percentile (0 ... 100) in usec, based on the histogram.
+  uint32_t     getPercentile(uint8_t percentile) const;
+
+  // Monotonic totals since the slot was taken, not affected by reset().
+  uint32_t     getTotalCount() const {
+    return _totalCount;
+  }
+
+  uint64_t     getTotalUsec() const {
+    return _totalUsec;
+  }
+
 private:
 
+  uint64_t _totalUsec;
+  uint32_t _totalCount;
   float _timeTotal;
   uint32_t _count;
-  uint64_t _maxVal;
-  uint64_t _minVal;
+  uint32_t _maxVal;
+  uint32_t _minVal;
+  uint16_t _histogram[TIMING_STATS_NR_BUCKETS];
+};
+
+
+// Fixed set of TimingStats slots, kept sorted on key.
+// Lookup is a binary search and a new key is inserted without further heap allocation.
+// Iteration order is the same as with the std::map which was used before.
+// The slots are only allocated on the first measurement, so no memory is used while timing stats are disabled.
+// Slots without measurements since the last reset are released by releaseUnused().
+// Measurements for a new key while all slots are in use are counted as dropped.
+template<uint8_t N>
+class TimingStatsSlots {
+public:
+
+  TimingStatsSlots() = default;
+
+  TimingStatsSlots(const TimingStatsSlots& other) = delete;
+
+  TimingStatsSlots& operator=(const TimingStatsSlots& other) = delete;
+
+  ~TimingStatsSlots() {
+    delete _slots;
+  }
+
+  TimingStats& operator[](uint16_t key) {
+    if (_slots == nullptr) {
+      # ifdef USE_SECOND_HEAP
+      HeapSelectIram ephemeral;
+      # endif // ifdef USE_SECOND_HEAP
+
+      _slots = new (std::nothrow) Slots();
+
+      if (_slots == nullptr) {
+        ++_dropped;
+        return _overflow;
+      }
+    }
+    uint16_t    *keys  = _slots->keys;
+    TimingStats *stats = _slots->stats;
+
+    uint8_t low  = 0;
+    uint8_t high = _nrUsed;
+
+    while (low < high) {
+      const uint8_t mid = (low + high) / 2;
+
+      if (keys[mid] < key) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+
+    if ((low < _nrUsed) && (keys[low] == key)) {
+      return stats[low];
+    }
+
+    if (_nrUsed >= N) {
+      // All slots taken, this one will not be reported.
+      ++_dropped;
+      return _overflow;
+    }
+
+    for (uint8_t i = _nrUsed; i > low; --i) {
+      keys[i]  = keys[i - 1];
+      stats[i] = stats[i - 1];
+    }
+    ++_nrUsed;
+    keys[low] = key;
+    stats[low].clear();
+    return stats[low];
+  }
+
+  // Release the slots without measurements since the last reset, keeping the order.
+  // Must be called before resetting the stats. The overflow entry is reset too.
+  // When no slot is in use anymore, the memory is freed.
+  void releaseUnused() {
+    _overflow.clear();
+
+    if (_slots == nullptr) { return; }
+    uint16_t    *keys  = _slots->keys;
+    TimingStats *stats = _slots->stats;
+    uint8_t used = 0;
+
+    for (uint8_t i = 0; i < _nrUsed; ++i) {
+      if (!stats[i].isEmpty()) {
+        if (used != i) {
+          keys[used]  = keys[i];
+          stats[used] = stats[i];
+        }
+        ++used;
+      }
+    }
+    _nrUsed = used;
+
+    if (_nrUsed == 0) {
+      delete _slots;
+      _slots = nullptr;
+    }
+  }
+
+  // Nr. of measurements not recorded since boot, as all slots were in use or could not be allocated.
+  uint32_t getDropped() const {
+    return _dropped;
+  }
+
+  uint8_t size() const {
+    return _nrUsed;
+  }
+
+  // Only valid for slot < size()
+  uint16_t getKey(uint8_t slot) const {
+    return _slots->keys[slot];
+  }
+
+  TimingStats& getStats(uint8_t slot) {
+    return _slots->stats[slot];
+  }
+
+private:
+
+  struct Slots {
+    uint16_t    keys[N];
+    TimingStats stats[N];
+  };
+
+  Slots      *_slots = nullptr;
+  TimingStats _overflow;
+  uint32_t    _dropped = 0;
+  uint8_t     _nrUsed  = 0;
 };
 
 
@@ -119,10 +293,13 @@ const __FlashStringHelper * getCPluginCFunctionName(CPlugin::Function function);
 bool   mustLogCFunction(CPlugin::Function function);
 String getMiscStatsName(int stat);
 
+// Release the slots of all stats without measurements since the last reset.
+void releaseUnusedTimingStats();
+
 
-extern std::map<int, TimingStats> pluginStats;
-extern std::map<int, TimingStats> controllerStats;
-extern std::map<int, TimingStats> miscStats;
+extern TimingStatsSlots<TIMING_STATS_PLUGIN_SLOTS> pluginStats;
+extern TimingStatsSlots<TIMING_STATS_CONTROLLER_SLOTS> controllerStats;
+extern TimingStatsSlots<TIMING_STATS_MISC_SLOTS> miscStats;
 extern unsigned long timingstats_last_reset;
 
 # define START_TIMER const uint64_t statisticsTimerStart(getMicros64());
@@ -132,7 +309,12 @@ extern unsigned long timingstats_last_reset;
   if (mustLogCFunction(F)) controllerStats[(T) * 256 + static_cast<int>(F)].add(usecPassedSince(statisticsTimerStart));
 
 // #define STOP_TIMER_LOADFILE miscStats[LOADFILE_STATS].add(usecPassedSince(statisticsTimerStart));
-# define STOP_TIMER(L) if (Settings.EnableTimingStats()) { miscStats[L].add(usecPassedSince(statisticsTimerStart)); }
+# ifdef USES_CONTROLLER_WORKER
+// The stats are not thread safe, skip measurements made on the controller worker task.
+#  define STOP_TIMER(L) if (Settings.EnableTimingStats() && !ControllerWorker_inWorker()) { miscStats[L].add(usecPassedSince(statisticsTimerStart)); }
+# else // ifdef USES_CONTROLLER_WORKER
+#  define STOP_TIMER(L) if (Settings.EnableTimingStats()) { miscStats[L].add(usecPassedSince(statisticsTimerStart)); }
+# endif // ifdef USES_CONTROLLER_WORKER
 
 // Add a timer statistic value in usec.
 # define ADD_TIMER_STAT(L, T) if (Settings.EnableTimingStats()) { miscStats[L].add(T); }
@@ -112,6 +112,9 @@ struct WiFiEventData_t {
 
   bool performedClearWiFiCredentials = false;
 
+  // IP config of the current connection attempt is taken from the DHCP lease kept in RTC.
+  bool usingCachedLease = false;
+
   unsigned long connectionFailures = 0;
 
 
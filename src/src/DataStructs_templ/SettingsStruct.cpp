@@ -295,6 +295,16 @@ void SettingsStruct_tmpl<N_TASKS>::AllowOTAUnlimited(bool value) {
   bitWrite(VariousBits1, 26, value);
 }
 
+template<unsigned int N_TASKS>
+bool SettingsStruct_tmpl<N_TASKS>::UseLastWiFiLeaseFromRTC() const {
+  return bitRead(VariousBits1, 27);
+}
+
+template<unsigned int N_TASKS>
+void SettingsStruct_tmpl<N_TASKS>::UseLastWiFiLeaseFromRTC(bool value) {
+  bitWrite(VariousBits1, 27, value);
+}
+
 template<unsigned int N_TASKS>
 ExtTimeSource_e SettingsStruct_tmpl<N_TASKS>::ExtTimeSource() const {
   return static_cast<ExtTimeSource_e>(ExternalTimeSource >> 1);
@@ -0,0 +1,31 @@
+#include "../DataTypes/TaskValueAggregate.h"
+
+const __FlashStringHelper* toString(TaskValueAggregate_e aggregate) {
+  switch (aggregate) {
+    case TaskValueAggregate_e::None:          return F("-");
+    case TaskValueAggregate_e::Last:          return F("Last");
+    case TaskValueAggregate_e::Min:           return F("Min");
+    case TaskValueAggregate_e::Max:           return F("Max");
+    case TaskValueAggregate_e::Mean:          return F("Mean");
+    case TaskValueAggregate_e::StdDev:        return F("Std. Dev.");
+    case TaskValueAggregate_e::Count:         return F("Count");
+    case TaskValueAggregate_e::Median:        return F("Median");
+    case TaskValueAggregate_e::Percentile_90: return F("90th Perc.");
+    case TaskValueAggregate_e::Percentile_95: return F("95th Perc.");
+    case TaskValueAggregate_e::Percentile_99: return F("99th Perc.");
+    case TaskValueAggregate_e::MAX_TYPE:      break;
+  }
+  return F("");
+}
+
+float getQuantile(TaskValueAggregate_e aggregate) {
+  switch (aggregate) {
+    case TaskValueAggregate_e::Median:        return 0.5f;
+    case TaskValueAggregate_e::Percentile_90: return 0.9f;
+    case TaskValueAggregate_e::Percentile_95: return 0.95f;
+    case TaskValueAggregate_e::Percentile_99: return 0.99f;
+    default:
+      break;
+  }
+  return -1.0f;
+}
@@ -0,0 +1,28 @@
+#ifndef DATATYPES_TASKVALUEAGGREGATE_H
+#define DATATYPES_TASKVALUEAGGREGATE_H
+
+#include <Arduino.h>
+
+// Aggregate of a task value sent to controllers, computed over a window of samples.
+enum class TaskValueAggregate_e : uint8_t { // Do not change values as this is stored in the settings!
+  None          = 0,                        // No aggregation, send last value
+  Last          = 1,
+  Min           = 2,
+  Max           = 3,
+  Mean          = 4,
+  StdDev        = 5,
+  Count         = 6,
+  Median        = 7,
+  Percentile_90 = 8,
+  Percentile_95 = 9,
+  Percentile_99 = 10,
+
+  MAX_TYPE // Keep as last
+};
+
+const __FlashStringHelper* toString(TaskValueAggregate_e aggregate);
+
+// Quantile (0 ... 1) to estimate for the aggregate, or -1 when it is not a percentile.
+float                      getQuantile(TaskValueAggregate_e aggregate);
+
+#endif // ifndef DATATYPES_TASKVALUEAGGREGATE_H
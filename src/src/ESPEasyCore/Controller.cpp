@@ -25,11 +25,14 @@
 #include "../Globals/Protocol.h"
 
 #include "../Helpers/_CPlugin_Helper.h"
+#include "../Helpers/BootTimeline.h"
 #include "../Helpers/Misc.h"
 #include "../Helpers/Network.h"
 #include "../Helpers/PeriodicalActions.h"
 #include "../Helpers/PortStatus.h"
 #include "../Helpers/Rules_calculate.h"
+#include "../Helpers/TaskValueAggregation.h"
+#include "../Helpers/TaskValueDeadband.h"
 
 
 #define PLUGIN_ID_MQTT_IMPORT         37
@@ -45,9 +48,32 @@ void sendData(struct EventStruct *event)
   #endif // ifndef BUILD_NO_RAM_TRACKER
   LoadTaskSettings(event->TaskIndex);
 
+#ifdef USES_TASK_VALUE_AGGREGATION
+  TaskValueAggregation aggregation(event);
+
+  if (aggregation.isActive()) {
+    if (Settings.UseRules && aggregation.rawRuleEvents()) {
+      createRuleEvents(event);
+    }
+
+    if (!aggregation.windowComplete()) {
+      STOP_TIMER(SEND_DATA_STATS);
+      return;
+    }
+
+    // Task values are restored when 'aggregation' goes out of scope.
+    aggregation.setAggregateValues();
+  }
+
+  if (Settings.UseRules && !aggregation.rawRuleEvents()) {
+    createRuleEvents(event);
+  }
+#else // ifdef USES_TASK_VALUE_AGGREGATION
+
   if (Settings.UseRules) {
     createRuleEvents(event);
   }
+#endif // ifdef USES_TASK_VALUE_AGGREGATION
 
   if (Settings.UseValueLogger && (Settings.InitSPI > static_cast<int>(SPI_Options_e::None)) && (Settings.Pin_sd_cs >= 0)) {
     SendValueLogger(event->TaskIndex);
@@ -55,6 +81,10 @@ void sendData(struct EventStruct *event)
 
   LoadTaskSettings(event->TaskIndex); // could have changed during background tasks.
 
+#ifdef USES_TASK_VALUE_DEADBAND
+  TaskValueDeadband deadband(event);
+#endif // ifdef USES_TASK_VALUE_DEADBAND
+
   for (controllerIndex_t x = 0; x < CONTROLLER_MAX; x++)
   {
     event->ControllerIndex = x;
@@ -67,8 +97,19 @@ void sendData(struct EventStruct *event)
       protocolIndex_t ProtocolIndex = getProtocolIndex_from_ControllerIndex(event->ControllerIndex);
 
       if (validUserVar(event)) {
+#ifdef USES_TASK_VALUE_DEADBAND
+
+        if (deadband.mustSend(event->ControllerIndex)) {
+          String dummy;
+
+          if (CPluginCall(ProtocolIndex, CPlugin::Function::CPLUGIN_PROTOCOL_SEND, event, dummy)) {
+            deadband.setSent(event->ControllerIndex);
+          }
+        }
+#else // ifdef USES_TASK_VALUE_DEADBAND
         String dummy;
         CPluginCall(ProtocolIndex, CPlugin::Function::CPLUGIN_PROTOCOL_SEND, event, dummy);
+#endif // ifdef USES_TASK_VALUE_DEADBAND
       }
 #ifndef BUILD_NO_DEBUG
       else {
@@ -639,6 +680,8 @@ void SensorSendTask(taskIndex_t TaskIndex)
 
     if (success)
     {
+      markBootFirstSensorRead(TaskIndex);
+
       if (Device[DeviceIndex].FormulaOption) {
         START_TIMER;
 
@@ -20,6 +20,7 @@
 #include "../Helpers/Rules_calculate.h"
 #include "../Helpers/RulesHelper.h"
 #include "../Helpers/RulesMatcher.h"
+#include "../Helpers/SamplingProfiler.h"
 #include "../Helpers/StringConverter.h"
 #include "../Helpers/StringParser.h"
 
@@ -91,6 +92,7 @@ void rulesProcessing(const String& event) {
   if (!Settings.UseRules) {
     return;
   }
+  PROFILER_SCOPE(Rules, 0);
   START_TIMER
   #ifndef BUILD_NO_RAM_TRACKER
   checkRAM(F("rulesProcessing"));
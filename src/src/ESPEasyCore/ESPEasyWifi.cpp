@@ -14,7 +14,9 @@
 #include "../Globals/SecuritySettings.h"
 #include "../Globals/Services.h"
 #include "../Globals/Settings.h"
+#include "../Globals/Statistics.h"
 #include "../Globals/WiFi_AP_Candidates.h"
+#include "../Helpers/ESPEasyRTC.h"
 #include "../Helpers/ESPEasy_time_calc.h"
 #include "../Helpers/Misc.h"
 #include "../Helpers/Networking.h"
@@ -25,6 +27,9 @@
 #include <WiFiGeneric.h>
 #endif
 
+#include <lwip/dhcp.h>
+#include <lwip/netif.h>
+
 // FIXME TD-er: Cleanup of WiFi code
 #ifdef ESPEASY_WIFI_CLEANUP_WORK_IN_PROGRESS
 bool ESPEasyWiFi_t::begin() {
@@ -401,6 +406,7 @@ void AttemptWiFiConnect() {
       log += WiFiEventData.wifi_connect_attempt;
       addLogMove(LOG_LEVEL_INFO, log);
     }
+    WiFiEventData.usingCachedLease = useWiFiLeaseFromRTC(candidate);
     WiFiEventData.markWiFiBegin();
     if (prepareWiFi()) {
       RTC.clearLastWiFi();
@@ -1242,7 +1248,7 @@ bool WifiIsSTA(WiFiMode_t wifimode)
 }
 
 bool useStaticIP() {
-  return Settings.IP[0] != 0 && Settings.IP[0] != 255;
+  return (Settings.IP[0] != 0 && Settings.IP[0] != 255) || WiFiEventData.usingCachedLease;
 }
 
 bool wifiConnectTimeoutReached() {
@@ -1319,17 +1325,48 @@ void setConnectionSpeed() {
   #endif // ifdef ESP32
 }
 
+// Set when the IP config from the cached DHCP lease was applied, so DHCP must be started again when no longer used.
+static bool cachedWiFiLeaseApplied = false;
+
+// Moment (millis) at which RTC_WiFiLease.leaseRemaining_min was determined.
+// A lease read from RTC after deep sleep was determined right before going to sleep, thus at boot.
+static unsigned long wifiLeaseMoment = 0;
+
 void setupStaticIPconfig() {
   setUseStaticIP(useStaticIP());
 
-  if (!useStaticIP()) { return; }
-  const IPAddress ip     = Settings.IP;
-  const IPAddress gw     = Settings.Gateway;
-  const IPAddress subnet = Settings.Subnet;
-  const IPAddress dns    = Settings.DNS;
+  if (!useStaticIP()) {
+    if (cachedWiFiLeaseApplied) {
+      // Start DHCP client again
+      cachedWiFiLeaseApplied = false;
+      #ifdef ESP8266
+      WiFi.config(0u, 0u, 0u);
+      #endif // ifdef ESP8266
+      #ifdef ESP32
+      WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);
+      #endif // ifdef ESP32
+    }
+    return;
+  }
+  IPAddress ip     = Settings.IP;
+  IPAddress gw     = Settings.Gateway;
+  IPAddress subnet = Settings.Subnet;
+  IPAddress dns    = Settings.DNS;
+
+  if (WiFiEventData.usingCachedLease && (ip[0] == 0 || ip[0] == 255)) {
+    ip  = RTC_WiFiLease.ip;
+    gw  = RTC_WiFiLease.gateway;
+    dns = RTC_WiFiLease.dns;
+
+    for (uint8_t i = 0; i < 4; ++i) {
+      const int bits = static_cast<int>(RTC_WiFiLease.subnetPrefix) - 8 * i;
+      subnet[i] = (bits >= 8) ? 0xFF : (bits <= 0) ? 0 : static_cast<uint8_t>(0xFF << (8 - bits));
+    }
+    cachedWiFiLeaseApplied = true;
+  }
 
   if (loglevelActiveFor(LOG_LEVEL_INFO)) {
-    String log = F("IP   : Static IP : ");
+    String log = cachedWiFiLeaseApplied ? F("IP   : Cached DHCP lease : ") : F("IP   : Static IP : ");
     log += formatIP(ip);
     log += F(" GW: ");
     log += formatIP(gw);
@@ -1342,6 +1379,144 @@ void setupStaticIPconfig() {
   WiFi.config(ip, gw, subnet, dns);
 }
 
+// ********************************************************************************
+// DHCP lease kept in RTC memory for nodes using deep sleep
+// ********************************************************************************
+static uint32_t getWiFiLeaseRemaining_min() {
+  const uint32_t passed_min = timePassedSince(wifiLeaseMoment) / 60000;
+
+  if (RTC_WiFiLease.leaseRemaining_min <= passed_min) {
+    return 0;
+  }
+  return RTC_WiFiLease.leaseRemaining_min - passed_min;
+}
+
+bool useWiFiLeaseFromRTC(const WiFi_AP_Candidate& candidate) {
+  if (!Settings.UseLastWiFiLeaseFromRTC() ||
+      (lastBootCause != BOOT_CAUSE_DEEP_SLEEP) ||
+      (Settings.IP[0] != 0 && Settings.IP[0] != 255)) {
+    return false;
+  }
+
+  // Only valid when reconnecting to the same AP as before going to sleep.
+  // RTC.lastBSSID is cleared at the first connect attempt, so any retry will use DHCP.
+  if (!RTC.lastWiFi_set() ||
+      !candidate.allowQuickConnect() ||
+      candidate.isHidden ||
+      !candidate.bssid_match(RTC.lastBSSID) ||
+      (candidate.channel != RTC.lastWiFiChannel)) {
+    return false;
+  }
+  return RTC_WiFiLease.isValid() && getWiFiLeaseRemaining_min() >= WIFI_LEASE_MIN_REMAINING;
+}
+
+static uint32_t getDHCPleaseTime_sec(const IPAddress& ip) {
+  for (netif *n = netif_list; n != nullptr; n = n->next) {
+    if (netif_ip4_addr(n)->addr == static_cast<uint32_t>(ip)) {
+      const struct dhcp *dhcp = netif_dhcp_data(n);
+
+      if (dhcp != nullptr) {
+        return dhcp->offered_t0_lease;
+      }
+    }
+  }
+  return 0;
+}
+
+void storeWiFiLease() {
+  if (!Settings.UseLastWiFiLeaseFromRTC() || useStaticIP()) {
+    return;
+  }
+  const IPAddress ip     = NetworkLocalIP();
+  const IPAddress subnet = NetworkSubnetMask();
+
+  RTC_WiFiLease.ip      = static_cast<uint32_t>(ip);
+  RTC_WiFiLease.gateway = static_cast<uint32_t>(NetworkGatewayIP());
+  RTC_WiFiLease.dns     = static_cast<uint32_t>(NetworkDnsIP(0));
+
+  uint8_t prefix = 0;
+
+  for (uint8_t i = 0; i < 4; ++i) {
+    for (uint8_t mask = 0x80; mask != 0 && (subnet[i] & mask); mask >>= 1) {
+      ++prefix;
+    }
+  }
+  RTC_WiFiLease.subnetPrefix = prefix;
+
+  uint32_t lease_min = getDHCPleaseTime_sec(ip) / 60;
+
+  if (lease_min == 0) {
+    lease_min = WIFI_LEASE_DEFAULT_DURATION;
+  }
+  RTC_WiFiLease.leaseRemaining_min = (lease_min > 0xFFFF) ? 0xFFFF : lease_min;
+  RTC_WiFiLease.updateChecksum();
+  wifiLeaseMoment = millis();
+}
+
+void invalidateWiFiLease() {
+  if (WiFiEventData.usingCachedLease) {
+    addLog(LOG_LEVEL_INFO, F("WIFI : Cached DHCP lease not used, fall back to DHCP"));
+  }
+  WiFiEventData.usingCachedLease = false;
+  RTC_WiFiLease.clear();
+}
+
+void checkWiFiLeaseExpired() {
+  if (!WiFiEventData.usingCachedLease || (getWiFiLeaseRemaining_min() != 0)) {
+    return;
+  }
+
+  // Node stayed awake longer than the cached lease is valid, let DHCP take over.
+  invalidateWiFiLease();
+  setupStaticIPconfig();
+}
+
+void storeWiFiLeaseBeforeDeepSleep(int sleep_sec) {
+  if (Settings.UseLastWiFiLeaseFromRTC() && RTC_WiFiLease.isValid()) {
+    const uint32_t sleep_min = (static_cast<uint32_t>(sleep_sec) + 59) / 60;
+    uint32_t remaining_min   = getWiFiLeaseRemaining_min();
+
+    remaining_min = (remaining_min > sleep_min) ? remaining_min - sleep_min : 0;
+
+    if (remaining_min < WIFI_LEASE_MIN_REMAINING) {
+      RTC_WiFiLease.clear();
+    } else {
+      RTC_WiFiLease.leaseRemaining_min = remaining_min;
+    }
+  } else {
+    RTC_WiFiLease.clear();
+  }
+  saveWiFiLeaseToRTC();
+}
+
+void logWiFiWakeUpTiming() {
+  if ((lastBootCause != BOOT_CAUSE_DEEP_SLEEP) ||
+      (WiFiEventData.wifi_reconnects > 0) ||
+      !loglevelActiveFor(LOG_LEVEL_INFO)) {
+    return;
+  }
+
+  // All moments are in usec since boot.
+  const LongTermTimer::Duration begin_ms   = WiFiEventData.last_wifi_connect_attempt_moment.get() / 1000ll;
+  const LongTermTimer::Duration connect_ms = WiFiEventData.last_wifi_connect_attempt_moment.timeDiff(WiFiEventData.lastConnectMoment) / 1000ll;
+  const LongTermTimer::Duration ip_ms      = WiFiEventData.lastConnectMoment.timeDiff(WiFiEventData.lastGetIPmoment) / 1000ll;
+
+  String log = F("WIFI : Wake-up timing: WiFi.begin: ");
+  log += static_cast<int32_t>(begin_ms);
+  log += F(" ms, associate: ");
+  log += static_cast<int32_t>(connect_ms);
+  log += F(" ms, IP: ");
+  log += static_cast<int32_t>(ip_ms);
+  log += F(" ms, total: ");
+  log += static_cast<int32_t>(WiFiEventData.lastGetIPmoment.get() / 1000ll);
+  log += F(" ms");
+
+  if (WiFiEventData.usingCachedLease) {
+    log += F(" (cached DHCP lease)");
+  }
+  addLogMove(LOG_LEVEL_INFO, log);
+}
+
 // ********************************************************************************
 // Formatting WiFi related strings
 // ********************************************************************************
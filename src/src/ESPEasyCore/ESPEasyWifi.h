@@ -21,6 +21,8 @@
 #define WIFI_ALLOW_AP_AFTERBOOT_PERIOD     5      // in minutes
 #define WIFI_SCAN_INTERVAL_AP_USED         125000 // in milliSeconds
 #define WIFI_SCAN_INTERVAL_MINIMAL          60000 // in milliSeconds
+#define WIFI_LEASE_MIN_REMAINING           5      // in minutes, do not use a cached DHCP lease about to expire
+#define WIFI_LEASE_DEFAULT_DURATION        60     // in minutes, when the DHCP lease time is unknown
 
 
 #ifdef ESPEASY_WIFI_CLEANUP_WORK_IN_PROGRESS
@@ -135,6 +137,14 @@ bool wifiConnectTimeoutReached();
 bool wifiAPmodeActivelyUsed();
 void setConnectionSpeed();
 void setupStaticIPconfig();
+
+// DHCP lease kept in RTC to skip DHCP when waking from deep sleep.
+bool useWiFiLeaseFromRTC(const WiFi_AP_Candidate& candidate);
+void storeWiFiLease();
+void invalidateWiFiLease();
+void checkWiFiLeaseExpired();
+void storeWiFiLeaseBeforeDeepSleep(int sleep_sec);
+void logWiFiWakeUpTiming();
 String formatScanResult(int i, const String& separator);
 String formatScanResult(int i, const String& separator, int32_t& rssi);
 
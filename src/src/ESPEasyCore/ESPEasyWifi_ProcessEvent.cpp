@@ -27,6 +27,7 @@
 #include "../Helpers/Network.h"
 #include "../Helpers/Networking.h"
 #include "../Helpers/PeriodicalActions.h"
+#include "../Helpers/SamplingProfiler.h"
 #include "../Helpers/Scheduler.h"
 #include "../Helpers/StringConverter.h"
 #include "../Helpers/StringGenerator_WiFi.h"
@@ -38,6 +39,8 @@
 // ********************************************************************************
 void handle_unprocessedNetworkEvents()
 {
+  PROFILER_SCOPE(NetworkEvents, 0);
+
 #ifdef HAS_ETHERNET
   if (EthEventData.unprocessedEthEvents()) {
     // Process disconnect events before connect events.
@@ -240,6 +243,11 @@ void processDisconnect() {
       WiFiEventData.processingDisconnect.isSet()) { return; }
   WiFiEventData.processingDisconnect.setNow();
   WiFiEventData.setWiFiDisconnected();
+
+  if (WiFiEventData.usingCachedLease) {
+    // Next attempt will use DHCP
+    invalidateWiFiLease();
+  }
   WiFiEventData.wifiConnectAttemptNeeded = true;
   delay(100); // FIXME TD-er: See https://github.com/letscontrolit/ESPEasy/issues/1987#issuecomment-451644424
 
@@ -386,7 +394,9 @@ void processGotIP() {
   if (loglevelActiveFor(LOG_LEVEL_INFO)) {
     String log = F("WIFI : ");
 
-    if (useStaticIP()) {
+    if (WiFiEventData.usingCachedLease) {
+      log += F("Cached DHCP IP: ");
+    } else if (useStaticIP()) {
       log += F("Static IP: ");
     } else {
       log += F("DHCP IP: ");
@@ -407,6 +417,8 @@ void processGotIP() {
     }
     addLogMove(LOG_LEVEL_INFO, log);
   }
+  storeWiFiLease();
+  logWiFiWakeUpTiming();
 
   // Might not work in core 2.5.0
   // See https://github.com/esp8266/Arduino/issues/5839
@@ -6,6 +6,7 @@
 #include "../Globals/ESPEasyWiFiEvent.h"
 #include "../Globals/Logging.h"
 #include "../Globals/Settings.h"
+#include "../Helpers/ControllerWorker.h"
 #include "../Helpers/Networking.h"
 
 #include <FS.h>
@@ -281,6 +282,13 @@ void addToSDLog(uint8_t logLevel, const String& string)
 
 void addLog(uint8_t logLevel, const String& string)
 {
+  #ifdef USES_CONTROLLER_WORKER
+  if (ControllerWorker_inWorker()) {
+    // Log buffers are not thread safe, let the loop task add the line.
+    ControllerWorker_runOnLoop([logLevel, string]() { addLog(logLevel, string); });
+    return;
+  }
+  #endif
   addToSerialLog(logLevel, string);
   addToSysLog(logLevel, string);
   addToSDLog(logLevel, string);
@@ -291,6 +299,13 @@ void addLog(uint8_t logLevel, const String& string)
 
 void addToLogMove(uint8_t logLevel, String&& string)
 {
+  #ifdef USES_CONTROLLER_WORKER
+  if (ControllerWorker_inWorker()) {
+    addLog(logLevel, string);
+    string = String();
+    return;
+  }
+  #endif
   addToSerialLog(logLevel, string);
   addToSysLog(logLevel, string);
   addToSDLog(logLevel, string);
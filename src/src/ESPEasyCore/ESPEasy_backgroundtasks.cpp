@@ -4,6 +4,7 @@
 #include "../../ESPEasy-Globals.h"
 #include "../../ESPEasy_common.h"
 #include "../DataStructs/TimingStats.h"
+#include "../Helpers/ControllerWorker.h"
 #include "../ESPEasyCore/ESPEasyNetwork.h"
 #include "../ESPEasyCore/Serial.h"
 #include "../Globals/NetworkState.h"
@@ -12,6 +13,7 @@
 #include "../Helpers/ESPEasy_time_calc.h"
 #include "../Helpers/Network.h"
 #include "../Helpers/Networking.h"
+#include "../Helpers/SamplingProfiler.h"
 
 
 #ifdef FEATURE_ARDUINO_OTA
@@ -41,6 +43,13 @@ void backgroundtasks()
    #endif
    */
 
+  #ifdef USES_CONTROLLER_WORKER
+  // Controllers waiting for a reply on the worker task must not run the loop task's background tasks.
+  if (ControllerWorker_inWorker()) {
+    return;
+  }
+  #endif // ifdef USES_CONTROLLER_WORKER
+
   // prevent recursion!
   if (runningBackgroundTasks)
   {
@@ -72,10 +81,16 @@ void backgroundtasks()
 
   process_serialWriteBuffer();
 
+  #ifdef USES_CONTROLLER_WORKER
+  // Handle finished controller sends and log lines from the worker task.
+  ControllerWorker_loop();
+  #endif // ifdef USES_CONTROLLER_WORKER
+
   if (!UseRTOSMultitasking) {
     serial();
 
     if (webserverRunning) {
+      PROFILER_SCOPE(WebServer, 0);
       web_server.handleClient();
     }
 
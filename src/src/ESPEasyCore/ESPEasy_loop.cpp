@@ -32,7 +32,9 @@ void updateLoopStats() {
   const int64_t usecSince = usecPassedSince(lastLoopStart);
 
   #ifdef USES_TIMING_STATS
-  miscStats[LOOP_STATS].add(usecSince);
+  if (Settings.EnableTimingStats()) {
+    miscStats[LOOP_STATS].add(usecSince);
+  }
   #endif // ifdef USES_TIMING_STATS
 
   loop_usec_duration_total += usecSince;
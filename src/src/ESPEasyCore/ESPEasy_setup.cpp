@@ -18,6 +18,8 @@
 #include "../Helpers/_CPlugin_init.h"
 #include "../Helpers/_NPlugin_init.h"
 #include "../Helpers/_Plugin_init.h"
+#include "../Helpers/BootTimeline.h"
+#include "../Helpers/ControllerWorker.h"
 #include "../Helpers/DeepSleep.h"
 #include "../Helpers/ESPEasyRTC.h"
 #include "../Helpers/ESPEasy_FactoryDefault.h"
@@ -211,6 +213,10 @@ void ESPEasy_setup()
       lastMixedSchedulerId_beforereboot = RTC.lastMixedSchedulerId;
       readUserVarFromRTC();
 
+      if (lastBootCause == BOOT_CAUSE_DEEP_SLEEP) {
+        readWiFiLeaseFromRTC();
+      }
+
       log += F(" #");
       log += RTC.bootCounter;
 
@@ -237,6 +243,7 @@ void ESPEasy_setup()
     log += F(" - Restart Reason: ");
     log += getResetReasonString();
 
+    initBootTimeline();
     RTC.deepSleepState = 0;
     saveToRTC();
 
@@ -245,17 +252,20 @@ void ESPEasy_setup()
   #ifndef BUILD_NO_RAM_TRACKER
   logMemUsageAfter(F("RTC init"));
   #endif
+  markBootPhase(F("RTC"));
 
   fileSystemCheck();
   #ifndef BUILD_NO_RAM_TRACKER
   logMemUsageAfter(F("fileSystemCheck()"));
   #endif
+  markBootPhase(F("FS"));
 
   //  progMemMD5check();
   LoadSettings();
   #ifndef BUILD_NO_RAM_TRACKER
   logMemUsageAfter(F("LoadSettings()"));
   #endif
+  markBootPhase(F("settings"));
 
   #ifndef BUILD_NO_RAM_TRACKER
   checkRAM(F("hardwareInit"));
@@ -264,6 +274,7 @@ void ESPEasy_setup()
   #ifndef BUILD_NO_RAM_TRACKER
   logMemUsageAfter(F("hardwareInit()"));
   #endif
+  markBootPhase(F("hardware"));
 
   node_time.restoreFromRTC();
 
@@ -308,6 +319,7 @@ void ESPEasy_setup()
   #ifndef BUILD_NO_RAM_TRACKER
   logMemUsageAfter(F("WifiScan()"));
   #endif
+  markBootPhase(F("WiFi scan"));
 
 
   //  setWifiMode(WIFI_STA);
@@ -335,6 +347,7 @@ void ESPEasy_setup()
   #ifndef BUILD_NO_RAM_TRACKER
   logMemUsageAfter(F("initSerial()"));
   #endif
+  markBootPhase(F("serial"));
 
 
   if (Settings.Build != BUILD) {
@@ -358,17 +371,20 @@ void ESPEasy_setup()
   #ifndef BUILD_NO_RAM_TRACKER
   logMemUsageAfter(F("CPluginInit()"));
   #endif
+  markBootPhase(F("controllers"));
   #ifdef USES_NOTIFIER
   NPluginInit();
   #ifndef BUILD_NO_RAM_TRACKER
   logMemUsageAfter(F("NPluginInit()"));
   #endif
+  markBootPhase(F("notifications"));
   #endif // ifdef USES_NOTIFIER
 
   PluginInit();
   #ifndef BUILD_NO_RAM_TRACKER
   logMemUsageAfter(F("PluginInit()"));
   #endif
+  markBootPhase(F("plugins"));
   if (loglevelActiveFor(LOG_LEVEL_INFO)) {
     String log  = F("INFO : Plugins: ");
     log += deviceCount + 1;
@@ -388,6 +404,7 @@ void ESPEasy_setup()
   #ifndef BUILD_NO_RAM_TRACKER
   logMemUsageAfter(F("clearAllCaches()"));
   #endif
+  markBootPhase(F("caches"));
 
   if (Settings.UseRules && isDeepSleepEnabled())
   {
@@ -424,11 +441,9 @@ void ESPEasy_setup()
   #ifndef BUILD_NO_RAM_TRACKER
   logMemUsageAfter(F("NetworkConnectRelaxed()"));
   #endif
+  markBootPhase(F("network"));
 
-  setWebserverRunning(true);
-  #ifndef BUILD_NO_RAM_TRACKER
-  logMemUsageAfter(F("setWebserverRunning()"));
-  #endif
+  // The web server is started from runOncePerSecond(), so it does not delay the first sensor reads.
 
 
   #ifdef FEATURE_REPORTING
@@ -442,12 +457,8 @@ void ESPEasy_setup()
   #endif
   #endif // ifdef FEATURE_ARDUINO_OTA
 
-  if (node_time.systemTimePresent()) {
-    node_time.initTime();
-    #ifndef BUILD_NO_RAM_TRACKER
-    logMemUsageAfter(F("node_time.initTime()"));
-    #endif
-  }
+  // No need to call node_time.initTime() here.
+  // Time restored from RTC is already applied in restoreFromRTC() and NTP is synced once the network is connected.
 
   if (Settings.UseRules)
   {
@@ -457,6 +468,7 @@ void ESPEasy_setup()
     logMemUsageAfter(F("rulesProcessing(System#Boot)"));
     #endif
   }
+  markBootPhase(F("boot rules"));
 
   writeDefaultCSS();
   #ifndef BUILD_NO_RAM_TRACKER
@@ -485,6 +497,10 @@ void ESPEasy_setup()
   }
   #endif // ifdef USE_RTOS_MULTITASKING
 
+  #ifdef USES_CONTROLLER_WORKER
+  ControllerWorker_begin();
+  #endif // ifdef USES_CONTROLLER_WORKER
+
   // Start the interval timers at N msec from now.
   // Make sure to start them at some time after eachother,
   // since they will keep running at the same interval.
@@ -497,5 +513,5 @@ void ESPEasy_setup()
   #ifndef BUILD_NO_RAM_TRACKER
   logMemUsageAfter(F("Scheduler.setIntervalTimerOverride"));
   #endif
-
+  markBootSetupDone();
 }
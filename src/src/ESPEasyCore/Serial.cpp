@@ -8,6 +8,7 @@
 #include "../Globals/Settings.h"
 
 #include "../Helpers/Memory.h"
+#include "../Helpers/SamplingProfiler.h"
 
 
 /********************************************************************************************\
@@ -35,6 +36,7 @@ void serial()
 {
   if (Serial.available())
   {
+    PROFILER_SCOPE(SerialConsole, 0);
     String dummy;
 
     if (PluginCall(PLUGIN_SERIAL_IN, 0, dummy)) {
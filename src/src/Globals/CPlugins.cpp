@@ -7,11 +7,14 @@
 #include "../ESPEasyCore/ESPEasy_Log.h"
 #include "../Globals/Protocol.h"
 #include "../Globals/Settings.h"
+#include "../Helpers/SamplingProfiler.h"
 
 
 
 // FIXME TD-er: Make these private and add functions to access its content.
-std::map<cpluginID_t, protocolIndex_t> CPlugin_id_to_ProtocolIndex;
+protocolIndex_t CPlugin_id_to_ProtocolIndex[CPLUGIN_ID_TABLE_SIZE];
+
+static_assert(sizeof(cpluginID_t) == 1, "CPlugin_id_to_ProtocolIndex must cover all CPlugin IDs");
 cpluginID_t ProtocolIndex_to_CPlugin_id[CPLUGIN_MAX + 1];
 
 bool (*CPlugin_ptr[CPLUGIN_MAX])(CPlugin::Function,
@@ -161,6 +164,7 @@ bool CPluginCall(protocolIndex_t protocolIndex, CPlugin::Function Function, stru
     const int freemem_begin = ESP.getFreeHeap();
     #endif
 
+    PROFILER_SCOPE(Controller, protocolIndex);
     START_TIMER;
     bool ret = CPlugin_ptr[protocolIndex](Function, event, str);
     STOP_TIMER_CONTROLLER(protocolIndex, Function);
@@ -227,8 +231,7 @@ bool validCPluginID(cpluginID_t cpluginID)
   if (cpluginID == INVALID_C_PLUGIN_ID) {
     return false;
   }
-  auto it = CPlugin_id_to_ProtocolIndex.find(cpluginID);
-  return it != CPlugin_id_to_ProtocolIndex.end();
+  return validProtocolIndex(CPlugin_id_to_ProtocolIndex[cpluginID]);
 }
 
 bool supportedCPluginID(cpluginID_t cpluginID)
@@ -260,22 +263,21 @@ cpluginID_t getCPluginID_from_ControllerIndex(controllerIndex_t index) {
 protocolIndex_t getProtocolIndex(cpluginID_t cpluginID)
 {
   if (cpluginID != INVALID_C_PLUGIN_ID) {
-    auto it = CPlugin_id_to_ProtocolIndex.find(cpluginID);
+    const protocolIndex_t protocolIndex = CPlugin_id_to_ProtocolIndex[cpluginID];
 
-    if (it != CPlugin_id_to_ProtocolIndex.end())
+    if (validProtocolIndex(protocolIndex))
     {
-      if (!validProtocolIndex(it->second)) { return INVALID_PROTOCOL_INDEX; }
       #ifndef BUILD_NO_DEBUG
-      if (Protocol[it->second].Number != cpluginID) {
+      if (Protocol[protocolIndex].Number != cpluginID) {
         // FIXME TD-er: Just a check for now, can be removed later when it does not occur.
         String log = F("getProtocolIndex error in Protocol Vector. CPluginID: ");
         log += String(cpluginID);
         log += F(" p_index: ");
-        log += String(it->second);
+        log += String(protocolIndex);
         addLogMove(LOG_LEVEL_ERROR, log);
       }
       #endif
-      return it->second;
+      return protocolIndex;
     }
   }
   return INVALID_PROTOCOL_INDEX;
@@ -304,8 +306,8 @@ String getCPluginNameFromCPluginID(cpluginID_t cpluginID) {
 
 
 bool addCPlugin(cpluginID_t cpluginID, protocolIndex_t x) {
-  if (x < CPLUGIN_MAX) { 
-    ProtocolIndex_to_CPlugin_id[x] = cpluginID; 
+  if ((x < CPLUGIN_MAX) && (cpluginID != INVALID_C_PLUGIN_ID)) {
+    ProtocolIndex_to_CPlugin_id[x]         = cpluginID;
     CPlugin_id_to_ProtocolIndex[cpluginID] = x;
     return true;
   }
@@ -24,7 +24,7 @@
    - Protocol   -> A CPlugin included in the build.
 
    We have the following one-to-one relations:
-   - CPlugin_id_to_ProtocolIndex - Map from CPlugin ID to Protocol Index.
+   - CPlugin_id_to_ProtocolIndex - Table from CPlugin ID to Protocol Index.
    - ProtocolIndex_to_CPlugin_id - Vector from ProtocolIndex to CPlugin ID.
    - CPlugin_ptr - Array of function pointers to call Cplugins.
    - Protocol    - Vector of ProtocolStruct containing Cplugin specific information.
@@ -48,8 +48,11 @@ bool CPluginCall(protocolIndex_t     protocolIndex,
 bool              anyControllerEnabled();
 controllerIndex_t findFirstEnabledControllerWithId(cpluginID_t cpluginid);
 
-// Map to match a controller ID to a "ProtocolIndex"
-extern std::map<cpluginID_t, protocolIndex_t> CPlugin_id_to_ProtocolIndex;
+// Table to match a controller ID to a "ProtocolIndex".
+// Indexed by controller ID, so it covers the full range of cpluginID_t.
+// CPlugins not included in the build have INVALID_PROTOCOL_INDEX.
+#define CPLUGIN_ID_TABLE_SIZE 256
+extern protocolIndex_t CPlugin_id_to_ProtocolIndex[CPLUGIN_ID_TABLE_SIZE];
 
 // Vector to match a "ProtocolIndex" to a controller ID.
 // INVALID_CONTROLLER_INDEX may be used as index for this array.
@@ -0,0 +1,14 @@
+#include "../Globals/PluginCommandRouting.h"
+
+
+PluginCommandRouting pluginCommandRouting;
+
+void addTaskCommand(taskIndex_t taskIndex, const __FlashStringHelper *command)
+{
+  pluginCommandRouting.addCommand(taskIndex, command);
+}
+
+void addTaskCommand(taskIndex_t taskIndex, const String& command)
+{
+  pluginCommandRouting.addCommand(taskIndex, command);
+}
@@ -0,0 +1,18 @@
+#ifndef GLOBALS_PLUGINCOMMANDROUTING_H
+#define GLOBALS_PLUGINCOMMANDROUTING_H
+
+#include "../DataStructs/PluginCommandRouting.h"
+
+extern PluginCommandRouting pluginCommandRouting;
+
+// Declare a command keyword handled by the task in PLUGIN_WRITE.
+// Must be called during PLUGIN_INIT.
+// Once a task declared a command, PLUGIN_WRITE is only called for the declared commands.
+void addTaskCommand(taskIndex_t                taskIndex,
+                    const __FlashStringHelper *command);
+
+void addTaskCommand(taskIndex_t   taskIndex,
+                    const String& command);
+
+
+#endif // GLOBALS_PLUGINCOMMANDROUTING_H
@@ -18,17 +18,21 @@
 #include "../Globals/ExtraTaskSettings.h"
 #include "../Globals/EventQueue.h"
 #include "../Globals/GlobalMapPortStatus.h"
+#include "../Globals/PluginCommandRouting.h"
 #include "../Globals/Settings.h"
 #include "../Globals/Statistics.h"
 
 #include "../Helpers/ESPEasyRTC.h"
 #include "../Helpers/ESPEasy_Storage.h"
 #include "../Helpers/Hardware.h"
+#include "../Helpers/I2C_async.h"
 #include "../Helpers/Misc.h"
 #include "../Helpers/PortStatus.h"
+#include "../Helpers/SamplingProfiler.h"
 #include "../Helpers/StringConverter.h"
 #include "../Helpers/StringParser.h"
 
+#include <algorithm>
 #include <vector>
 
 int deviceCount = -1;
@@ -38,9 +42,11 @@ boolean (*Plugin_ptr[PLUGIN_MAX])(uint8_t,
                                   String&);
 
 pluginID_t DeviceIndex_to_Plugin_id[PLUGIN_MAX + 1];
-std::map<pluginID_t, deviceIndex_t> Plugin_id_to_DeviceIndex;
+deviceIndex_t Plugin_id_to_DeviceIndex[PLUGIN_ID_TABLE_SIZE];
 std::vector<deviceIndex_t> DeviceIndex_sorted;
 
+static_assert(sizeof(pluginID_t) == 1, "Plugin_id_to_DeviceIndex must cover all plugin IDs");
+
 
 bool validDeviceIndex(deviceIndex_t index) {
   if (index < PLUGIN_MAX) {
@@ -62,8 +68,7 @@ bool validPluginID_fullcheck(pluginID_t pluginID) {
   if (!validPluginID(pluginID)) {
     return false;
   }
-  auto it = Plugin_id_to_DeviceIndex.find(pluginID);
-  return (it != Plugin_id_to_DeviceIndex.end());
+  return validDeviceIndex(Plugin_id_to_DeviceIndex[pluginID]);
 }
 
 bool validUserVarIndex(userVarIndex_t index) {
@@ -102,16 +107,15 @@ pluginID_t getPluginID_from_TaskIndex(taskIndex_t taskIndex) {
 deviceIndex_t getDeviceIndex(pluginID_t pluginID)
 {
   if (pluginID != INVALID_PLUGIN_ID) {
-    auto it = Plugin_id_to_DeviceIndex.find(pluginID);
+    const deviceIndex_t deviceIndex = Plugin_id_to_DeviceIndex[pluginID];
 
-    if (it != Plugin_id_to_DeviceIndex.end())
+    if (validDeviceIndex(deviceIndex))
     {
-      if (!validDeviceIndex(it->second)) { return INVALID_DEVICE_INDEX; }
-      if (Device[it->second].Number != pluginID) {
+      if (Device[deviceIndex].Number != pluginID) {
         // FIXME TD-er: Just a check for now, can be removed later when it does not occur.
         addLog(LOG_LEVEL_ERROR, F("getDeviceIndex error in Device Vector"));
       }
-      return it->second;
+      return deviceIndex;
     }
   }
   return INVALID_DEVICE_INDEX;
@@ -162,39 +166,35 @@ bool checkPluginI2CAddressFromDeviceIndex(deviceIndex_t deviceIndex, uint8_t i2c
 // ********************************************************************************
 // Device Sort routine, actual sorting alfabetically by plugin name.
 // Sorting does happen case sensitive.
+// The set of plugins does not change at runtime, so this is only done once,
+// the first time the sorted list is needed.
+// Invalid entries are placed at the end.
 // ********************************************************************************
 void sortDeviceIndexArray() {
-  // First fill the existing number of the DeviceIndex.
-  DeviceIndex_sorted.resize(deviceCount + 1);
+  if ((deviceCount < 0) || (DeviceIndex_sorted.size() == static_cast<size_t>(deviceCount + 1))) {
+    return;
+  }
+
+  // Fetch each name only once, as it is a call to the plugin.
+  std::vector<String> names;
+  names.resize(deviceCount + 1);
+
+  DeviceIndex_sorted.clear();
+  DeviceIndex_sorted.reserve(deviceCount + 1);
 
   for (deviceIndex_t x = 0; x <= deviceCount; x++) {
     if (validPluginID(DeviceIndex_to_Plugin_id[x])) {
-      DeviceIndex_sorted[x] = x;
-    } else {
-      DeviceIndex_sorted[x] = INVALID_DEVICE_INDEX;
+      names[x] = getPluginNameFromDeviceIndex(x);
+      DeviceIndex_sorted.push_back(x);
     }
   }
 
-  // Do the sorting.
-  int innerLoop;
-  int mainLoop;
-
-  for (mainLoop = 1; mainLoop <= deviceCount; mainLoop++)
-  {
-    innerLoop = mainLoop;
+  std::sort(DeviceIndex_sorted.begin(), DeviceIndex_sorted.end(),
+            [&names](deviceIndex_t a, deviceIndex_t b) {
+    return names[a] < names[b];
+  });
 
-    while (innerLoop  >= 1)
-    {
-      const String cur(getPluginNameFromDeviceIndex(DeviceIndex_sorted[innerLoop]));
-      const String prev(getPluginNameFromDeviceIndex(DeviceIndex_sorted[innerLoop - 1]));
-      if (cur < prev) {
-        deviceIndex_t temp = DeviceIndex_sorted[innerLoop - 1];
-        DeviceIndex_sorted[innerLoop - 1] = DeviceIndex_sorted[innerLoop];
-        DeviceIndex_sorted[innerLoop]     = temp;
-      }
-      innerLoop--;
-    }
-  }
+  DeviceIndex_sorted.resize(deviceCount + 1, INVALID_DEVICE_INDEX);
 }
 
 // ********************************************************************************
@@ -202,24 +202,83 @@ void sortDeviceIndexArray() {
 // when addressing a task
 // ********************************************************************************
 
+// Both the multiplexer channel and the clock speed are cached in Hardware.cpp,
+// so selecting the state the bus is already in does not cause a bus transaction.
+static uint8_t I2C_batch_level     = 0;
+static bool    I2C_restore_pending = false;
+
+static void I2C_restore_idle_state() {
+  I2C_restore_pending = false;
+#ifdef FEATURE_I2CMULTIPLEXER
+  I2CMultiplexerOff();
+#endif
+  I2CSelectHighClockSpeed();
+}
+
+void I2C_batch_begin() {
+  ++I2C_batch_level;
+}
+
+void I2C_batch_end() {
+  if (I2C_batch_level > 0) {
+    --I2C_batch_level;
+  }
+  if ((I2C_batch_level == 0) && I2C_restore_pending) {
+    I2C_restore_idle_state();
+  }
+}
+
+uint16_t get_I2C_bus_key_by_taskIndex(taskIndex_t taskIndex) {
+  const deviceIndex_t DeviceIndex = getDeviceIndex_from_TaskIndex(taskIndex);
+
+  if (!validDeviceIndex(DeviceIndex) || (Device[DeviceIndex].Type != DEVICE_TYPE_I2C)) {
+    return 0;
+  }
+  uint16_t key = 0x8000;
+
+#ifdef FEATURE_I2CMULTIPLEXER
+  if (I2CMultiplexerPortSelectedForTask(taskIndex)) {
+    key |= 0x4000 | static_cast<uint8_t>(Settings.I2C_Multiplexer_Channel[taskIndex]);
+    if (bitRead(Settings.I2C_Flags[taskIndex], I2C_FLAGS_MUX_MULTICHANNEL)) {
+      key |= 0x2000;
+    }
+  }
+#endif
+  if (bitRead(Settings.I2C_Flags[taskIndex], I2C_FLAGS_SLOW_SPEED)) {
+    key |= 0x1000;
+  }
+  return key;
+}
+
 bool prepare_I2C_by_taskIndex(taskIndex_t taskIndex, deviceIndex_t DeviceIndex) {
   if (!validTaskIndex(taskIndex) || !validDeviceIndex(DeviceIndex)) {
     return false;
   }
   if (Device[DeviceIndex].Type != DEVICE_TYPE_I2C) {
+    if (I2C_restore_pending) {
+      // Non-I2C tasks may still access the bus, so present it as if no I2C task was called before.
+      I2C_restore_idle_state();
+    }
     return true; // No I2C task, so consider all-OK
   }
   if (I2C_state != I2C_bus_state::OK) {
     return false; // Bus state is not OK, so do not consider task runnable
   }
 #ifdef FEATURE_I2CMULTIPLEXER
-  I2CMultiplexerSelectByTaskIndex(taskIndex);
+  if (I2CMultiplexerPortSelectedForTask(taskIndex)) {
+    I2CMultiplexerSelectByTaskIndex(taskIndex);
+  } else {
+    // A previous task in the same batch may have left a channel selected.
+    I2CMultiplexerOff();
+  }
   // Output is selected after this write, so now we must make sure the
   // frequency is set before anything else is sent.
 #endif
 
   if (bitRead(Settings.I2C_Flags[taskIndex], I2C_FLAGS_SLOW_SPEED)) {
     I2CSelectLowClockSpeed(); // Set to slow
+  } else {
+    I2CSelectHighClockSpeed();
   }
   return true;
 }
@@ -232,13 +291,13 @@ void post_I2C_by_taskIndex(taskIndex_t taskIndex, deviceIndex_t DeviceIndex) {
   if (Device[DeviceIndex].Type != DEVICE_TYPE_I2C) {
     return;
   }
-#ifdef FEATURE_I2CMULTIPLEXER
-  I2CMultiplexerOff();
-#endif
 
-  if (bitRead(Settings.I2C_Flags[taskIndex], I2C_FLAGS_SLOW_SPEED)) {
-    I2CSelectHighClockSpeed();  // Reset
+  if (I2C_batch_level > 0) {
+    // Leave the bus as-is, the next task in this batch may need the same state.
+    I2C_restore_pending = true;
+    return;
   }
+  I2C_restore_idle_state();
 }
 
 // Add an event to the event queue.
@@ -302,9 +361,16 @@ bool PluginCallForTask(taskIndex_t taskIndex, uint8_t Function, EventStruct *Tem
             }
         }
         #endif
-        START_TIMER;
-        retval = (Plugin_ptr[DeviceIndex](Function, TempEvent, command));
-        STOP_TIMER_TASK(DeviceIndex, Function);
+        if (Function == PLUGIN_INIT) {
+          // Plugin will declare its commands again during PLUGIN_INIT
+          pluginCommandRouting.clear(taskIndex);
+        }
+        {
+          PROFILER_SCOPE(Plugin, taskIndex);
+          START_TIMER;
+          retval = (Plugin_ptr[DeviceIndex](Function, TempEvent, command));
+          STOP_TIMER_TASK(DeviceIndex, Function);
+        }
 
         if (Function == PLUGIN_INIT) {
           // Schedule the plugin to be read.
@@ -357,6 +423,7 @@ bool PluginCall(uint8_t Function, struct EventStruct *event, String& str)
             #endif
 
             if ((deviceCount + 2) > static_cast<int>(Device.size())) {
+              // Should not happen, as PluginInit() already allocates Device for all included plugins.
               // Increase with 16 to get some compromise between number of resizes and wasted space
               unsigned int newSize = Device.size();
               newSize = newSize + 16 - (newSize % 16);
@@ -398,6 +465,7 @@ bool PluginCall(uint8_t Function, struct EventStruct *event, String& str)
     case PLUGIN_WRITE:
 //    case PLUGIN_REQUEST: @giig1967g: replaced by new function getGPIOPluginValues()
     {
+      START_TIMER;
       taskIndex_t firstTask = 0;
       taskIndex_t lastTask = TASKS_MAX;
       String command = String(str);                           // Local copy to avoid warning in ExecuteCommand
@@ -448,15 +516,23 @@ bool PluginCall(uint8_t Function, struct EventStruct *event, String& str)
   // info += lastTask;
   // addLog(LOG_LEVEL_INFO, info);
 
+      // Only offer the command to tasks which declared to handle it, or did not declare any command.
+      const uint32_t commandHash = PluginCommandRouting::getCommandHash(parseString(command, 1));
+
       for (taskIndex_t task = firstTask; task < lastTask; task++)
       {
+        if (!pluginCommandRouting.mayHandleCommand(task, commandHash)) {
+          continue;
+        }
         bool retval = PluginCallForTask(task, Function, &TempEvent, command);
 
         if (retval) {
+          STOP_TIMER(PLUGIN_CALL_WRITE);
           CPluginCall(CPlugin::Function::CPLUGIN_ACKNOWLEDGE, &TempEvent, command);
           return true;
         }
       }
+      STOP_TIMER(PLUGIN_CALL_WRITE);
 
       if (Function == PLUGIN_REQUEST) {
         // @FIXME TD-er: work-around as long as gpio command is still performed in P001_switch.
@@ -491,10 +567,28 @@ bool PluginCall(uint8_t Function, struct EventStruct *event, String& str)
       return false;
     }
 
-    // Call to all plugins that are used in a task
-    case PLUGIN_ONCE_A_SECOND:
+    // Call to all tasks whose plugin subscribed to these calls in PLUGIN_DEVICE_ADD
     case PLUGIN_TEN_PER_SECOND:
     case PLUGIN_FIFTY_PER_SECOND:
+    {
+      const std::vector<taskIndex_t>& tasks = (Function == PLUGIN_TEN_PER_SECOND)
+                                              ? Cache.tasksTenPerSecond
+                                              : Cache.tasksFiftyPerSecond;
+
+      if (tasks.empty()) {
+        return true;
+      }
+      I2C_BatchScope i2c_batch;
+
+      // Iterate by index, as a plugin call may update the task caches.
+      for (size_t i = 0; i < tasks.size(); ++i) {
+        PluginCallForTask(tasks[i], Function, &TempEvent, str, event);
+      }
+      return true;
+    }
+
+    // Call to all plugins that are used in a task
+    case PLUGIN_ONCE_A_SECOND:
     case PLUGIN_INIT_ALL:
     case PLUGIN_CLOCK_IN:
     case PLUGIN_EVENT_OUT:
@@ -503,6 +597,7 @@ bool PluginCall(uint8_t Function, struct EventStruct *event, String& str)
       if (Function == PLUGIN_INIT_ALL) {
         Function = PLUGIN_INIT;
       }
+      I2C_BatchScope i2c_batch;
 
       for (taskIndex_t taskIndex = 0; taskIndex < TASKS_MAX; taskIndex++)
       {
@@ -587,6 +682,11 @@ bool PluginCall(uint8_t Function, struct EventStruct *event, String& str)
         if (!prepare_I2C_by_taskIndex(event->TaskIndex, DeviceIndex)) {
           return false;
         }
+        if ((Function == PLUGIN_INIT) || (Function == PLUGIN_EXIT)) {
+          // Plugin will declare its commands again during PLUGIN_INIT
+          pluginCommandRouting.clear(event->TaskIndex);
+        }
+        PROFILER_SCOPE(Plugin, event->TaskIndex);
         START_TIMER;
         bool retval =  Plugin_ptr[DeviceIndex](Function, event, str);
 
@@ -601,6 +701,7 @@ bool PluginCall(uint8_t Function, struct EventStruct *event, String& str)
         }
         if (Function == PLUGIN_EXIT) {
           clearPluginTaskData(event->TaskIndex);
+          I2C_async_cancel(event->TaskIndex);
           updateTaskCaches();
           initSerial();
           queueTaskEvent(F("TaskExit"), event->TaskIndex, retval);
@@ -667,6 +768,7 @@ bool PluginCall(uint8_t Function, struct EventStruct *event, String& str)
           event->sensorType = Device[DeviceIndex].VType;
         }
 
+        PROFILER_SCOPE(Plugin, event->TaskIndex);
         START_TIMER;
         bool retval =  Plugin_ptr[DeviceIndex](Function, event, str);
         if (Function == PLUGIN_SET_DEFAULTS) {
@@ -698,8 +800,8 @@ bool PluginCall(uint8_t Function, struct EventStruct *event, String& str)
 }
 
 bool addPlugin(pluginID_t pluginID, deviceIndex_t x) {
-  if (x < PLUGIN_MAX) { 
-    DeviceIndex_to_Plugin_id[x] = pluginID; 
+  if ((x < PLUGIN_MAX) && validPluginID(pluginID)) {
+    DeviceIndex_to_Plugin_id[x]        = pluginID;
     Plugin_id_to_DeviceIndex[pluginID] = x;
     return true;
   }
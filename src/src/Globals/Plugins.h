@@ -28,7 +28,7 @@
    
 
    We have the following one-to-one relations:
-   - Plugin_id_to_DeviceIndex  - Map from Plugin ID to Device Index.
+   - Plugin_id_to_DeviceIndex  - Table from Plugin ID to Device Index.
    - DeviceIndex_to_Plugin_id  - Vector from DeviceIndex to Plugin ID.
    - Plugin_ptr                - Array of function pointers to call plugins.
    - Device                    - Vector of DeviceStruct containing plugin specific information.
@@ -54,10 +54,14 @@ extern boolean (*Plugin_ptr[PLUGIN_MAX])(uint8_t,
 // INVALID_DEVICE_INDEX may be used as index for this array, thus one larger
 extern pluginID_t DeviceIndex_to_Plugin_id[PLUGIN_MAX + 1];
 
-// Map to match a plugin ID to a "DeviceIndex"
-extern std::map<pluginID_t, deviceIndex_t> Plugin_id_to_DeviceIndex;
+// Table to match a plugin ID to a "DeviceIndex".
+// Indexed by plugin ID, so it covers the full range of pluginID_t.
+// Plugins not included in the build have INVALID_DEVICE_INDEX.
+#define PLUGIN_ID_TABLE_SIZE 256
+extern deviceIndex_t Plugin_id_to_DeviceIndex[PLUGIN_ID_TABLE_SIZE];
 
 // Vector containing "DeviceIndex" alfabetically sorted.
+// Only filled when needed, by calling sortDeviceIndexArray()
 extern std::vector<deviceIndex_t> DeviceIndex_sorted;
 
 
@@ -91,6 +95,7 @@ bool          checkPluginI2CAddressFromDeviceIndex(deviceIndex_t deviceIndex, ui
 #endif // if USE_I2C_DEVICE_SCAN
 String        getPluginNameFromPluginID(pluginID_t pluginID);
 
+// Fill DeviceIndex_sorted, if not done already.
 void          sortDeviceIndexArray();
 
 
@@ -99,6 +104,27 @@ void          sortDeviceIndexArray();
 bool prepare_I2C_by_taskIndex(taskIndex_t taskIndex, deviceIndex_t DeviceIndex);
 void post_I2C_by_taskIndex(taskIndex_t taskIndex, deviceIndex_t DeviceIndex);
 
+// Key to group tasks needing the same I2C bus state (multiplexer channel and clock speed)
+// Returns 0 for tasks not using I2C.
+uint16_t get_I2C_bus_key_by_taskIndex(taskIndex_t taskIndex);
+
+// Within an I2C batch the multiplexer channel and clock speed are left as-is after a task call,
+// so a next task on the same channel and speed does not need any extra bus transaction.
+// The idle bus state (no channel selected, normal speed) is restored when the outermost batch ends,
+// or before calling a non-I2C task.
+void I2C_batch_begin();
+void I2C_batch_end();
+
+struct I2C_BatchScope {
+  I2C_BatchScope() {
+    I2C_batch_begin();
+  }
+
+  ~I2C_BatchScope() {
+    I2C_batch_end();
+  }
+};
+
 /*********************************************************************************************\
 * Function call to all or specific plugins
 \*********************************************************************************************/
@@ -1,7 +1,9 @@
 #include "../Globals/RTC.h"
 
 #include "../DataStructs/RTCStruct.h"
+#include "../DataStructs/RTCWiFiLeaseStruct.h"
 
 
 RTCStruct RTC;
+RTCWiFiLeaseStruct RTC_WiFiLease;
 
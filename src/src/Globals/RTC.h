@@ -2,7 +2,9 @@
 #define GLOBALS_RTC_H
 
 #include "../DataStructs/RTCStruct.h"
+#include "../DataStructs/RTCWiFiLeaseStruct.h"
 
 extern RTCStruct RTC;
+extern RTCWiFiLeaseStruct RTC_WiFiLease;
 
 #endif // GLOBALS_RTC_H
\ No newline at end of file
@@ -32,3 +32,7 @@ volatile unsigned long sw_watchdog_callback_count = 0;
 
 I2C_bus_state I2C_state = I2C_bus_state::OK;
 unsigned long I2C_bus_cleared_count = 0;
+unsigned long I2C_mux_switch_count       = 0;
+unsigned long I2C_mux_switch_skipped     = 0;
+unsigned long I2C_clock_change_count     = 0;
+unsigned long I2C_clock_change_skipped   = 0;
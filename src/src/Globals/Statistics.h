@@ -45,5 +45,12 @@ extern volatile unsigned long sw_watchdog_callback_count;
 extern I2C_bus_state I2C_state;
 extern unsigned long I2C_bus_cleared_count;
 
+// Bus transactions to select a multiplexer channel or (re)init the clock speed,
+// and those skipped because the bus was already in the requested state.
+extern unsigned long I2C_mux_switch_count;
+extern unsigned long I2C_mux_switch_skipped;
+extern unsigned long I2C_clock_change_count;
+extern unsigned long I2C_clock_change_skipped;
+
 
 #endif // GLOBALS_STATISTICS_H
@@ -1,5 +1,6 @@
 #include "../Helpers/AdafruitGFX_helper.h"
 #include "../../_Plugin_Helper.h"
+#include "../Helpers/CRC_functions.h"
 
 #ifdef PLUGIN_USES_ADAFRUITGFX
 
@@ -1162,9 +1163,48 @@ bool AdafruitGFX_helper::processCommand(const String& string) {
     success = false;
   }
 
+  if (success &&
+      !subcommand.equals(F("txp")) && !subcommand.equals(F("txc")) && !subcommand.equals(F("txs")) &&
+      !subcommand.equals(F("tpm")) && !subcommand.equals(F("font"))) {
+    // Something was drawn, which may have overwritten retained lines
+    invalidateLines();
+  }
+
   return success;
 }
 
+/****************************************************************************
+ * isLineChanged: Check a line against the retained content, and update the retained content
+ ***************************************************************************/
+static uint32_t AdaGFXhashAdd(uint32_t hash, uint32_t value) {
+  for (uint8_t i = 0; i < 4; ++i) {
+    hash   = (hash ^ (value & 0xFF)) * 16777619u;
+    value >>= 8;
+  }
+  return hash;
+}
+
+bool AdafruitGFX_helper::isLineChanged(uint8_t        line,
+                                       const String & text,
+                                       int16_t        yPos,
+                                       uint16_t       fgcolor,
+                                       uint16_t       bgcolor,
+                                       uint8_t        textSize) {
+  uint32_t hash = calc_FNV1a_hash_runtime(text.c_str());
+
+  hash = AdaGFXhashAdd(hash, (static_cast<uint32_t>(fgcolor) << 16) | bgcolor);
+  hash = AdaGFXhashAdd(hash, (static_cast<uint32_t>(static_cast<uint16_t>(yPos)) << 16) | (textSize << 8) | _fontwidth);
+  hash = AdaGFXhashAdd(hash, (static_cast<uint32_t>(_fontheight) << 8) | static_cast<uint8_t>(_heightOffset));
+
+  if (line >= _lineHashes.size()) {
+    _lineHashes.resize(line + 1, 0);
+  } else if (_lineHashes[line] == hash) {
+    return false;
+  }
+  _lineHashes[line] = hash;
+  return true;
+}
+
 /****************************************************************************
  * printText: Print text on display at a specific pixel or column/row location
  ***************************************************************************/
@@ -1227,6 +1267,10 @@ void AdafruitGFX_helper::printText(const char    *string,
 
   if (w1 == 0) { w1 = _fontwidth; } // Some fonts seem to have a 0-wide space, this is an endless loop protection
 
+  // The built-in font (no height offset) draws an opaque background, so clearing with spaces
+  // can be done with a single filled rectangle, which is sent to the display as one block of pixels.
+  const bool fillWithRect = (_heightOffset == 0) && (color != bkcolor);
+
   if (_textPrintMode == AdaGFXTextPrintMode::ClearThenTruncate) { // Clear before print
     _display->setCursor(_x, _y);
     w0 = 0;
@@ -1234,8 +1278,12 @@ void AdafruitGFX_helper::printText(const char    *string,
 
     _display->getTextBounds(newString, _x, _y, &x1, &y1, &w2, &h1); // Count length in pixels
 
-    for (; (w0 < w2); w0 += w1) {                                   // Clear previously used text with spaces
-      _display->print(' ');
+    if (fillWithRect) {
+      _display->fillRect(_x, _y, ((w2 + w1 - 1) / w1) * w1, 8 * textSize, bkcolor);
+    } else {
+      for (; (w0 < w2); w0 += w1) { // Clear previously used text with spaces
+        _display->print(' ');
+      }
     }
     delay(0);
   }
@@ -1245,8 +1293,16 @@ void AdafruitGFX_helper::printText(const char    *string,
 
   _display->getTextBounds(newString, _x, _y, &x1, &y1, &w0, &h1); // Count length in pixels
 
-  for (; ((_x + w0) < _res_x) && _textPrintMode != AdaGFXTextPrintMode::ContinueToNextLine; w0 += w1) {
-    _display->print(' ');
+  if (_textPrintMode != AdaGFXTextPrintMode::ContinueToNextLine) {
+    if (fillWithRect) {
+      if ((_x + w0) < _res_x) {
+        _display->fillRect(_x + w0, _y, _res_x - (_x + w0), 8 * textSize, bkcolor);
+      }
+    } else {
+      for (; ((_x + w0) < _res_x); w0 += w1) {
+        _display->print(' ');
+      }
+    }
   }
 
   if (_textBackFill && (color != bkcolor)) { // Draw extra lines below text
@@ -1756,6 +1812,8 @@ bool AdafruitGFX_helper::invalidCoordinates(int  X,
 void AdafruitGFX_helper::setRotation(uint8_t m) {
   uint8_t rotation = m & 3;
 
+  invalidateLines();
+
   _display->setRotation(m); // Set rotation 0/1/2/3
 
   switch (rotation) {
@@ -15,6 +15,8 @@
 # include <Adafruit_SPITFT.h>
 # include <FS.h>
 
+# include <vector>
+
 // Used for bmp support
 # define BUFPIXELS 200 ///< 200 * 5 = 1000 bytes
 
@@ -275,6 +277,19 @@ public:
                  unsigned int   textSize = 0,
                  unsigned short color    = ADAGFX_WHITE,
                  unsigned short bkcolor  = ADAGFX_BLACK);
+  // Retained display content, for plugins redrawing their configured lines on every PLUGIN_READ.
+  // Returns true when the line has to be drawn, because its text, position, colors or font
+  // differ from what was drawn last time. Any drawing command invalidates all retained lines.
+  bool isLineChanged(uint8_t        line,
+                     const String & text,
+                     int16_t        yPos,
+                     uint16_t       fgcolor,
+                     uint16_t       bgcolor,
+                     uint8_t        textSize);
+  void invalidateLines() {
+    _lineHashes.clear();
+  }
+
   void calculateTextMetrics(uint8_t fontwidth,
                             uint8_t fontheight,
                             int8_t  heightOffset   = 0,
@@ -351,6 +366,8 @@ private:
 
   uint16_t _display_x;
   uint16_t _display_y;
+
+  std::vector<uint32_t> _lineHashes; // Hash of the content of each retained line
   # ifdef ADAGFX_ENABLE_BMP_DISPLAY
   uint16_t readLE16(void);
   uint32_t readLE32(void);
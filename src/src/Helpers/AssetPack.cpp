@@ -0,0 +1,432 @@
+#include "../Helpers/AssetPack.h"
+
+#ifdef USE_ASSET_PACK
+
+# include "../DataTypes/ESPEasyFileType.h"
+# include "../ESPEasyCore/ESPEasy_Log.h"
+# include "../Globals/Cache.h"
+# include "../Helpers/CRC_functions.h"
+# include "../Helpers/ESPEasy_Storage.h"
+# include "../Helpers/ESPEasy_time_calc.h"
+# include "../Helpers/FS_Helper.h"
+
+# include <algorithm>
+# include <new>
+# include <vector>
+
+// Round up to 4-byte boundary, so all file data starts word aligned in the mapped region.
+# define ASSET_PACK_ALIGN(x)  (((x) + 3u) & ~3u)
+
+// State of a rebuild in progress.
+struct AssetPack_rebuild_t {
+  std::vector<AssetPack_entry_t> index;
+  AssetPack_header_t             hdr;
+  fs::File                       file;                 // File of the entry being written
+  unsigned long                  start        = 0;
+  uint32_t                       eraseSize    = 0;
+  uint32_t                       erased       = 0;
+  uint32_t                       written      = 0;     // Bytes written of the current entry
+  uint16_t                       entry        = 0;     // Index of the entry being written
+  bool                           indexWritten = false;
+};
+
+
+AssetPackClass::~AssetPackClass()
+{
+  abortRebuild();
+  end();
+}
+
+bool AssetPackClass::findPartition()
+{
+  if (!_partitionChecked) {
+    _partitionChecked = true;
+    _partition        = esp_partition_find_first(
+      ESP_PARTITION_TYPE_DATA,
+      static_cast<esp_partition_subtype_t>(ASSET_PACK_PARTITION_SUBTYPE),
+      nullptr);
+  }
+  return _partition != nullptr;
+}
+
+bool AssetPackClass::begin()
+{
+  abortRebuild();
+  end();
+
+  if (!findPartition()) {
+    return false;
+  }
+
+  AssetPack_header_t hdr;
+
+  if ((esp_partition_read(_partition, 0, &hdr, sizeof(hdr)) != ESP_OK) ||
+      (hdr.magic != ASSET_PACK_MAGIC) ||
+      (hdr.version != ASSET_PACK_VERSION) ||
+      (hdr.nrEntries > ASSET_PACK_MAX_ENTRIES) ||
+      (hdr.totalSize > _partition->size)) {
+    // No usable pack present, create one from the current file system content.
+    addLog(LOG_LEVEL_INFO, F("AssetPack: No valid pack found"));
+    _mustRebuild = true;
+    _lastChange  = millis();
+    return false;
+  }
+
+  const void *ptr = nullptr;
+
+  if (esp_partition_mmap(_partition, 0, hdr.totalSize, SPI_FLASH_MMAP_DATA, &ptr, &_handle) != ESP_OK) {
+    addLog(LOG_LEVEL_ERROR, F("AssetPack: Could not map partition"));
+    return false;
+  }
+  _mapped = static_cast<const uint8_t *>(ptr);
+
+  // The file system may have been replaced or formatted outside ESPEasy.
+  uint16_t nrOutdated = 0;
+  const AssetPack_entry_t *entry = entries();
+
+  for (uint16_t i = 0; i < hdr.nrEntries; ++i, ++entry) {
+    if (entry->valid == 0xFFFFFFFF) {
+      fs::File f = tryOpenFile(entry->name, "r");
+
+      if (!f || (f.size() != entry->size)) {
+        invalidateEntry(i);
+        ++nrOutdated;
+      }
+
+      if (f) {
+        f.close();
+      }
+    }
+  }
+
+  if (loglevelActiveFor(LOG_LEVEL_INFO)) {
+    String log = F("AssetPack: Mapped ");
+    log += hdr.nrEntries;
+    log += F(" files, ");
+    log += hdr.totalSize;
+    log += F(" bytes");
+
+    if (nrOutdated > 0) {
+      log += F(", outdated: ");
+      log += nrOutdated;
+    }
+    addLogMove(LOG_LEVEL_INFO, log);
+  }
+  return true;
+}
+
+void AssetPackClass::end()
+{
+  if (_mapped != nullptr) {
+    spi_flash_munmap(_handle);
+    _mapped = nullptr;
+  }
+}
+
+void AssetPackClass::erase()
+{
+  // Any pointer into the mapped region is about to become invalid.
+  Cache.rulesHelper.closeAllFiles();
+  abortRebuild();
+  end();
+  _mustRebuild = false;
+
+  if (findPartition()) {
+    // Without a valid header the rest of the partition is ignored.
+    esp_partition_erase_range(_partition, 0, SPI_FLASH_SEC_SIZE);
+  }
+}
+
+void AssetPackClass::invalidateEntry(uint16_t index)
+{
+  // Only clearing bits, so no erase needed.
+  // The flash cache of the mapped region is flushed by the write.
+  const uint32_t invalid = 0;
+  const size_t   offset  = sizeof(AssetPack_header_t) +
+                           index * sizeof(AssetPack_entry_t) +
+                           offsetof(AssetPack_entry_t, valid);
+
+  esp_partition_write(_partition, offset, &invalid, sizeof(invalid));
+  _mustRebuild = true;
+  _lastChange  = millis();
+}
+
+const AssetPack_header_t * AssetPackClass::header() const
+{
+  return reinterpret_cast<const AssetPack_header_t *>(_mapped);
+}
+
+const AssetPack_entry_t * AssetPackClass::entries() const
+{
+  return reinterpret_cast<const AssetPack_entry_t *>(_mapped + sizeof(AssetPack_header_t));
+}
+
+uint32_t AssetPackClass::getPartitionSize() const
+{
+  if (_partition == nullptr) { return 0; }
+  return _partition->size;
+}
+
+uint16_t AssetPackClass::getNrEntries() const
+{
+  if (_mapped == nullptr) { return 0; }
+  return header()->nrEntries;
+}
+
+String AssetPackClass::stripLeadingSlash(const String& fname)
+{
+  if (fname.startsWith(F("/"))) {
+    return fname.substring(1);
+  }
+  return fname;
+}
+
+bool AssetPackClass::find(const String& fname, const uint8_t *& data, size_t& size) const
+{
+  if (_mapped == nullptr) {
+    return false;
+  }
+  const String   name     = stripLeadingSlash(fname);
+  const uint32_t hash     = calc_FNV1a_hash_runtime(name.c_str());
+  const AssetPack_entry_t *entry = entries();
+
+  for (uint16_t i = 0; i < header()->nrEntries; ++i, ++entry) {
+    if ((entry->hash == hash) &&
+        (entry->valid == 0xFFFFFFFF) &&
+        (strncmp(entry->name, name.c_str(), ASSET_PACK_MAX_NAME_LENGTH) == 0)) {
+      data = _mapped + entry->offset;
+      size = entry->size;
+      return true;
+    }
+  }
+  return false;
+}
+
+void AssetPackClass::invalidate(const String& fname)
+{
+  if (_partition == nullptr) {
+    return;
+  }
+
+  if (_mapped != nullptr) {
+    const String   name     = stripLeadingSlash(fname);
+    const uint32_t hash     = calc_FNV1a_hash_runtime(name.c_str());
+    const AssetPack_entry_t *entry = entries();
+
+    for (uint16_t i = 0; i < header()->nrEntries; ++i, ++entry) {
+      if ((entry->hash == hash) &&
+          (entry->valid == 0xFFFFFFFF) &&
+          (strncmp(entry->name, name.c_str(), ASSET_PACK_MAX_NAME_LENGTH) == 0)) {
+        invalidateEntry(i);
+        return;
+      }
+    }
+  }
+
+  if (includeInPack(fname)) {
+    // New file, not yet in the pack, or changed while rebuilding.
+    abortRebuild();
+    _mustRebuild = true;
+    _lastChange  = millis();
+  }
+}
+
+void AssetPackClass::loop()
+{
+  if (_rebuild != nullptr) {
+    rebuildStep();
+  } else if (_mustRebuild && (timePassedSince(_lastChange) > ASSET_PACK_REBUILD_DELAY)) {
+    rebuild();
+  }
+}
+
+bool AssetPackClass::includeInPack(const String& fname)
+{
+  String name = stripLeadingSlash(fname);
+
+  if ((name.length() == 0) ||
+      (name.length() >= ASSET_PACK_MAX_NAME_LENGTH) ||
+      (name.indexOf('/') != -1)) {
+    return false;
+  }
+
+  for (uint8_t x = 0; x < RULESETS_MAX; ++x) {
+    if (name.equalsIgnoreCase(getRulesFileName(x))) {
+      return true;
+    }
+  }
+
+  if (name.endsWith(F(".gz"))) {
+    name = name.substring(0, name.length() - 3);
+  }
+
+  // Only static content, never settings or credentials.
+  return name.endsWith(F(".css")) ||
+         name.endsWith(F(".js")) ||
+         name.endsWith(F(".htm")) ||
+         name.endsWith(F(".html")) ||
+         name.endsWith(F(".svg")) ||
+         name.endsWith(F(".ico")) ||
+         name.endsWith(F(".png")) ||
+         name.endsWith(F(".gif")) ||
+         name.endsWith(F(".jpg"));
+}
+
+bool AssetPackClass::rebuild()
+{
+  _mustRebuild = false;
+  abortRebuild();
+
+  if (!findPartition()) {
+    return false;
+  }
+
+  _rebuild = new (std::nothrow) AssetPack_rebuild_t();
+
+  if (_rebuild == nullptr) {
+    return false;
+  }
+  _rebuild->start = millis();
+  std::vector<AssetPack_entry_t>& index = _rebuild->index;
+
+  {
+    fs::File root = ESPEASY_FS.open("/");
+
+    if (root) {
+      fs::File file = root.openNextFile();
+
+      while (file && index.size() < ASSET_PACK_MAX_ENTRIES) {
+        if (!file.isDirectory() && includeInPack(file.name())) {
+          const String name = stripLeadingSlash(file.name());
+          AssetPack_entry_t entry;
+          strncpy(entry.name, name.c_str(), ASSET_PACK_MAX_NAME_LENGTH - 1);
+          entry.size = file.size();
+          entry.hash = calc_FNV1a_hash_runtime(entry.name);
+          index.push_back(entry);
+        }
+        file = root.openNextFile();
+      }
+    }
+  }
+
+  AssetPack_header_t& hdr = _rebuild->hdr;
+  uint32_t offset = ASSET_PACK_ALIGN(sizeof(AssetPack_header_t) + index.size() * sizeof(AssetPack_entry_t));
+
+  for (auto it = index.begin(); it != index.end();) {
+    if ((offset + it->size) > _partition->size) {
+      if (loglevelActiveFor(LOG_LEVEL_ERROR)) {
+        String log = F("AssetPack: No room for ");
+        log += it->name;
+        addLogMove(LOG_LEVEL_ERROR, log);
+      }
+      it = index.erase(it);
+    } else {
+      it->offset = offset;
+      offset     = ASSET_PACK_ALIGN(offset + it->size);
+      ++it;
+    }
+  }
+
+  // Offsets were computed for the initial index size, so entries removed above just leave a gap.
+  hdr.nrEntries = index.size();
+  hdr.totalSize = offset;
+  _rebuild->eraseSize = (hdr.totalSize + SPI_FLASH_SEC_SIZE - 1) & ~(SPI_FLASH_SEC_SIZE - 1);
+
+  // Any pointer into the mapped region is about to become invalid.
+  Cache.rulesHelper.closeAllFiles();
+  end();
+  return true;
+}
+
+void AssetPackClass::rebuildStep()
+{
+  AssetPack_rebuild_t& r = *_rebuild;
+  const unsigned long stepStart = millis();
+  bool success = true;
+
+  if (r.erased < r.eraseSize) {
+    // A sector erase takes longer than a step, so erase one sector per step.
+    success   = esp_partition_erase_range(_partition, r.erased, SPI_FLASH_SEC_SIZE) == ESP_OK;
+    r.erased += SPI_FLASH_SEC_SIZE;
+  } else if (!r.indexWritten) {
+    if (!r.index.empty()) {
+      success = esp_partition_write(
+        _partition,
+        sizeof(AssetPack_header_t),
+        &r.index[0],
+        r.index.size() * sizeof(AssetPack_entry_t)) == ESP_OK;
+    }
+    r.indexWritten = true;
+  } else {
+    while (success && (r.entry < r.index.size()) && (timePassedSince(stepStart) < ASSET_PACK_REBUILD_STEP_TIME)) {
+      const AssetPack_entry_t& entry = r.index[r.entry];
+
+      if (!r.file) {
+        r.file    = tryOpenFile(entry.name, "r");
+        r.written = 0;
+
+        if (!r.file) {
+          success = false;
+          break;
+        }
+      }
+
+      if (r.written < entry.size) {
+        uint8_t buf[256];
+
+        // Never write beyond the space reserved for the entry.
+        const int chunk = std::min(static_cast<uint32_t>(sizeof(buf)), entry.size - r.written);
+
+        if (r.file.read(buf, chunk) != chunk) {
+          success = false;
+        } else {
+          success    = esp_partition_write(_partition, entry.offset + r.written, buf, chunk) == ESP_OK;
+          r.written += chunk;
+        }
+      } else {
+        r.file.close();
+        ++r.entry;
+      }
+    }
+
+    if (success && (r.entry >= r.index.size())) {
+      success = esp_partition_write(_partition, 0, &r.hdr, sizeof(r.hdr)) == ESP_OK;
+      finishRebuild(success);
+      return;
+    }
+  }
+
+  if (!success) {
+    finishRebuild(false);
+  }
+}
+
+void AssetPackClass::finishRebuild(bool success)
+{
+  if (loglevelActiveFor(success ? LOG_LEVEL_INFO : LOG_LEVEL_ERROR)) {
+    String log = F("AssetPack: ");
+    log += success ? F("Packed ") : F("Failed to pack ");
+    log += _rebuild->index.size();
+    log += F(" files, ");
+    log += _rebuild->hdr.totalSize;
+    log += F(" bytes in ");
+    log += timePassedSince(_rebuild->start);
+    log += F(" msec");
+    addLogMove(success ? LOG_LEVEL_INFO : LOG_LEVEL_ERROR, log);
+  }
+  abortRebuild();
+
+  if (success) {
+    begin();
+  }
+}
+
+void AssetPackClass::abortRebuild()
+{
+  if (_rebuild != nullptr) {
+    delete _rebuild;
+    _rebuild = nullptr;
+  }
+}
+
+#endif // ifdef USE_ASSET_PACK
@@ -0,0 +1,140 @@
+#ifndef HELPERS_ASSETPACK_H
+#define HELPERS_ASSETPACK_H
+
+#include "../../ESPEasy_common.h"
+
+#ifdef ESP32
+# ifndef LIMIT_BUILD_SIZE
+#  define USE_ASSET_PACK
+# endif // ifndef LIMIT_BUILD_SIZE
+#endif  // ifdef ESP32
+
+
+// Read-only pack of static files (rules, CSS, JS, HTML) stored in a dedicated
+// flash partition and memory mapped on ESP32.
+// The content can be parsed and served directly from flash,
+// without opening a file on the file system and without copies on the heap.
+//
+// Layout of the partition:
+// - AssetPack_header_t
+// - nrEntries x AssetPack_entry_t
+// - File data, each file starting at a 4-byte aligned offset.
+//
+// The header is written last, so an interrupted rebuild leaves no valid pack.
+// A rebuild is done in small steps from loop(): one sector erase or a few msec of writes per call.
+// When a packed file is changed on the file system, the 'valid' field of its entry
+// is cleared in flash (a 1 -> 0 bit change does not need an erase) and the pack is
+// rebuilt a few seconds later.
+// Files may also change without passing through ESPEasy (e.g. a file system image uploaded
+// via OTA), so at mount each entry is checked to still exist with the same size.
+// Formatting the file system erases the pack header.
+// The file system remains the reference; anything not (validly) packed is read from there.
+
+#ifdef USE_ASSET_PACK
+
+# include <esp_partition.h>
+# include <esp_spi_flash.h>
+
+# define ASSET_PACK_PARTITION_SUBTYPE  0x9A
+# define ASSET_PACK_MAGIC              0x50414545 // "EEAP"
+# define ASSET_PACK_VERSION            1
+# define ASSET_PACK_MAX_ENTRIES        64
+# define ASSET_PACK_MAX_NAME_LENGTH    32
+# define ASSET_PACK_REBUILD_DELAY      10000 // msec after the last change before rebuilding
+# define ASSET_PACK_REBUILD_STEP_TIME  5     // msec of writing per loop() call while rebuilding
+
+
+struct AssetPack_header_t {
+  uint32_t magic     = ASSET_PACK_MAGIC;
+  uint16_t version   = ASSET_PACK_VERSION;
+  uint16_t nrEntries = 0;
+  uint32_t totalSize = 0; // Size of header + index + data
+  uint32_t reserved  = 0xFFFFFFFF;
+};
+
+struct AssetPack_entry_t {
+  char     name[ASSET_PACK_MAX_NAME_LENGTH] = { 0 }; // Without leading slash
+  uint32_t offset                           = 0;     // From the start of the partition
+  uint32_t size                             = 0;
+  uint32_t valid                            = 0xFFFFFFFF;
+  uint32_t hash                             = 0;     // FNV-1a hash of the name
+};
+
+
+struct AssetPack_rebuild_t;
+
+class AssetPackClass {
+public:
+
+  AssetPackClass() = default;
+
+  ~AssetPackClass();
+
+  // Map the asset partition (if present) and check the pack header.
+  // Entries no longer matching the file on the file system are invalidated.
+  bool begin();
+
+  void end();
+
+  // Invalidate the whole pack, e.g. when the file system is formatted.
+  void erase();
+
+  // Get a pointer to the file content in mapped flash.
+  // Returns false when the file is not in the pack or has been changed since.
+  bool find(const String   & fname,
+            const uint8_t *& data,
+            size_t         & size) const;
+
+  // Must be called for every file changed, renamed or deleted on the file system.
+  void invalidate(const String& fname);
+
+  // Periodic check to rebuild the pack when needed, and to perform the next rebuild step.
+  void loop();
+
+  // Start rebuilding the pack. The pack is not available until the rebuild is finished.
+  bool rebuild();
+
+  bool isRebuilding() const {
+    return _rebuild != nullptr;
+  }
+
+  bool isMapped() const {
+    return _mapped != nullptr;
+  }
+
+  uint32_t getPartitionSize() const;
+
+  uint16_t getNrEntries() const;
+
+private:
+
+  const AssetPack_header_t* header() const;
+
+  const AssetPack_entry_t * entries() const;
+
+  bool findPartition();
+
+  void invalidateEntry(uint16_t index);
+
+  void rebuildStep();
+
+  void finishRebuild(bool success);
+
+  void abortRebuild();
+
+  static bool includeInPack(const String& fname);
+
+  static String stripLeadingSlash(const String& fname);
+
+  const esp_partition_t  *_partition = nullptr;
+  const uint8_t          *_mapped    = nullptr;
+  spi_flash_mmap_handle_t _handle    = 0;
+  AssetPack_rebuild_t    *_rebuild   = nullptr;
+  unsigned long           _lastChange = 0;
+  bool                    _partitionChecked = false;
+  bool                    _mustRebuild      = false;
+};
+
+#endif // ifdef USE_ASSET_PACK
+
+#endif // ifndef HELPERS_ASSETPACK_H
@@ -0,0 +1,108 @@
+#include "../Helpers/BootTimeline.h"
+
+#include "../ESPEasyCore/ESPEasy_Log.h"
+#include "../Globals/RTC.h"
+#include "../Helpers/ESPEasyRTC.h"
+
+
+static BootPhase_t bootPhases[BOOT_TIMELINE_MAX_PHASES];
+static uint8_t     bootPhaseCount          = 0;
+static uint32_t    bootSetupDone_usec      = 0;
+static uint32_t    bootFirstRead_usec      = 0;
+static uint16_t    prevBootSetupDuration   = 0;
+static uint16_t    prevBootFirstSensorRead = 0;
+
+static uint16_t toRTCvalue(uint32_t usec) {
+  const uint32_t msec = usec / 1000;
+
+  return (msec > 0xFFFF) ? 0xFFFF : msec;
+}
+
+void initBootTimeline() {
+  prevBootSetupDuration    = RTC.lastBootSetup_ms;
+  prevBootFirstSensorRead  = RTC.lastBootFirstRead_ms;
+  RTC.lastBootSetup_ms     = 0;
+  RTC.lastBootFirstRead_ms = 0;
+}
+
+void markBootPhase(const __FlashStringHelper *label) {
+  if (bootSetupDone_usec != 0) {
+    // Only record phases during setup
+    return;
+  }
+
+  if (bootPhaseCount < BOOT_TIMELINE_MAX_PHASES) {
+    bootPhases[bootPhaseCount].label    = label;
+    bootPhases[bootPhaseCount].end_usec = micros();
+    ++bootPhaseCount;
+  }
+}
+
+void markBootSetupDone() {
+  markBootPhase(F("setup done"));
+  bootSetupDone_usec   = micros();
+  RTC.lastBootSetup_ms = toRTCvalue(bootSetupDone_usec);
+  saveToRTC();
+
+  if (loglevelActiveFor(LOG_LEVEL_INFO)) {
+    String log = F("INIT : Boot setup: ");
+    log += getBootSetupDuration_ms();
+    log += F(" ms");
+
+    for (uint8_t i = 0; i < bootPhaseCount; ++i) {
+      const uint32_t start = (i == 0) ? 0 : bootPhases[i - 1].end_usec;
+      log += F(", ");
+      log += bootPhases[i].label;
+      log += ':';
+      log += (bootPhases[i].end_usec - start) / 1000;
+    }
+    addLogMove(LOG_LEVEL_INFO, log);
+  }
+}
+
+void markBootFirstSensorRead(taskIndex_t taskIndex) {
+  if (bootFirstRead_usec != 0) {
+    return;
+  }
+  bootFirstRead_usec       = micros();
+  RTC.lastBootFirstRead_ms = toRTCvalue(bootFirstRead_usec);
+  saveToRTC();
+
+  if (loglevelActiveFor(LOG_LEVEL_INFO)) {
+    String log = F("INIT : First sensor read: task ");
+    log += taskIndex + 1;
+    log += F(" at ");
+    log += getBootFirstSensorRead_ms();
+    log += F(" ms");
+    addLogMove(LOG_LEVEL_INFO, log);
+  }
+}
+
+uint8_t getBootPhaseCount() {
+  return bootPhaseCount;
+}
+
+const BootPhase_t& getBootPhase(uint8_t index) {
+  static const BootPhase_t empty;
+
+  if (index >= bootPhaseCount) {
+    return empty;
+  }
+  return bootPhases[index];
+}
+
+uint32_t getBootSetupDuration_ms() {
+  return bootSetupDone_usec / 1000;
+}
+
+uint32_t getBootFirstSensorRead_ms() {
+  return bootFirstRead_usec / 1000;
+}
+
+uint32_t getPrevBootSetupDuration_ms() {
+  return prevBootSetupDuration;
+}
+
+uint32_t getPrevBootFirstSensorRead_ms() {
+  return prevBootFirstSensorRead;
+}
@@ -0,0 +1,42 @@
+#ifndef HELPERS_BOOTTIMELINE_H
+#define HELPERS_BOOTTIMELINE_H
+
+#include "../../ESPEasy_common.h"
+
+#include "../DataTypes/TaskIndex.h"
+
+// Boot timeline, to see where time is spent between reset and the first sensor read.
+// Each phase of ESPEasy_setup() is marked when it is finished.
+// The setup duration and time to first sensor read are also kept in RTC,
+// so they can still be looked at after the next reboot (e.g. on deep sleep nodes).
+
+#define BOOT_TIMELINE_MAX_PHASES  20
+
+struct BootPhase_t {
+  const __FlashStringHelper *label    = nullptr;
+  uint32_t                   end_usec = 0; // micros() at the end of the phase
+};
+
+// Take the previous boot summary from RTC. Call right after reading the RTC struct.
+void               initBootTimeline();
+
+// Mark the end of a boot phase.
+void               markBootPhase(const __FlashStringHelper *label);
+
+// Mark the end of ESPEasy_setup()
+void               markBootSetupDone();
+
+// Call when a task read was successful. Only the first one after boot is recorded.
+void               markBootFirstSensorRead(taskIndex_t taskIndex);
+
+uint8_t            getBootPhaseCount();
+
+const BootPhase_t& getBootPhase(uint8_t index);
+
+// Durations in msec since boot, 0 when not (yet) known.
+uint32_t           getBootSetupDuration_ms();
+uint32_t           getBootFirstSensorRead_ms();
+uint32_t           getPrevBootSetupDuration_ms();
+uint32_t           getPrevBootFirstSensorRead_ms();
+
+#endif // ifndef HELPERS_BOOTTIMELINE_H
@@ -56,3 +56,15 @@ uint32_t calc_CRC32(const uint8_t *data, size_t length) {
   }
   return crc;
 }
+
+uint32_t calc_FNV1a_hash_runtime(const char *str) {
+  uint32_t hash = 2166136261u;
+
+  if (str != nullptr) {
+    while (*str != 0) {
+      hash ^= static_cast<uint8_t>(*str++);
+      hash *= 16777619u;
+    }
+  }
+  return hash;
+}
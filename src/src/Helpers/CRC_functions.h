@@ -11,5 +11,16 @@ int IRAM_ATTR calc_CRC16(const char *ptr,
 uint32_t calc_CRC32(const uint8_t *data,
                     size_t         length);
 
+// 32-bit FNV-1a hash of a zero terminated string.
+// Written as a single return statement, so it can be evaluated at compile time (C++11 constexpr)
+// to generate lookup tables in flash.
+constexpr uint32_t calc_FNV1a_hash(const char *str, uint32_t hash = 2166136261u)
+{
+  return (*str == 0) ? hash : calc_FNV1a_hash(str + 1, (hash ^ static_cast<uint8_t>(*str)) * 16777619u);
+}
+
+// Same hash as calc_FNV1a_hash, but not using recursion to be used at runtime.
+uint32_t calc_FNV1a_hash_runtime(const char *str);
+
 
 #endif // ifndef HELPERS_CRC_FUNCTIONS_H
\ No newline at end of file
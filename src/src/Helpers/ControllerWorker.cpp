@@ -0,0 +1,156 @@
+#include "../Helpers/ControllerWorker.h"
+
+#ifdef USES_CONTROLLER_WORKER
+
+# include "../ESPEasyCore/ESPEasy_Log.h"
+# include "../Helpers/ESPEasyMutex.h"
+# include "../Helpers/ESPEasy_time_calc.h"
+
+# include <list>
+# include <mutex>
+
+struct ControllerWorker_item_t {
+  ControllerWorker_job_t  job;
+  ControllerWorker_done_t done;
+};
+
+// Both lists are shared between the loop task and the worker, only access them with the mutex locked.
+static ESPEasy_Mutex                       ControllerWorker_mutex;
+static std::list<ControllerWorker_item_t>  ControllerWorker_pending;
+static std::list<std::function<void()> >   ControllerWorker_toLoop;
+
+static TaskHandle_t  ControllerWorker_handle = nullptr;
+static volatile bool ControllerWorker_busy   = false;
+
+
+static void ControllerWorker_task(void *parameter)
+{
+  for (;;) {
+    // Wait for a notification of a posted job, wake up every now and then to be sure.
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(100));
+
+    for (;;) {
+      ControllerWorker_item_t item;
+      {
+        std::lock_guard<ESPEasy_Mutex> lock(ControllerWorker_mutex);
+
+        if (ControllerWorker_pending.empty()) {
+          break;
+        }
+        item = std::move(ControllerWorker_pending.front());
+        ControllerWorker_pending.pop_front();
+        ControllerWorker_busy = true;
+      }
+
+      const uint64_t start  = getMicros64();
+      const bool     result = item.job();
+      const uint64_t usec   = usecPassedSince(start);
+
+      if (item.done) {
+        ControllerWorker_done_t done = std::move(item.done);
+        ControllerWorker_runOnLoop([done, result, usec]() {
+          done(result, usec);
+        });
+      }
+      ControllerWorker_busy = false;
+    }
+  }
+}
+
+bool ControllerWorker_begin()
+{
+  if (ControllerWorker_handle != nullptr) {
+    return true;
+  }
+
+  if (xTaskCreatePinnedToCore(
+        ControllerWorker_task,
+        "ControllerWorker",
+        CONTROLLER_WORKER_STACK_SIZE,
+        nullptr,
+        1, // Same priority as the Arduino loop task
+        &ControllerWorker_handle,
+        CONTROLLER_WORKER_CORE) != pdPASS) {
+    ControllerWorker_handle = nullptr;
+    addLog(LOG_LEVEL_ERROR, F("Ctrl : Could not start controller worker task"));
+    return false;
+  }
+  addLog(LOG_LEVEL_INFO, F("Ctrl : Controller I/O runs on worker task"));
+  return true;
+}
+
+bool ControllerWorker_post(ControllerWorker_job_t job, ControllerWorker_done_t done)
+{
+  if (ControllerWorker_handle == nullptr) {
+    return false;
+  }
+  {
+    std::lock_guard<ESPEasy_Mutex> lock(ControllerWorker_mutex);
+
+    if (ControllerWorker_pending.size() >= CONTROLLER_WORKER_MAX_PENDING) {
+      return false;
+    }
+    ControllerWorker_item_t item;
+    item.job  = std::move(job);
+    item.done = std::move(done);
+    ControllerWorker_pending.push_back(std::move(item));
+  }
+  xTaskNotifyGive(ControllerWorker_handle);
+  return true;
+}
+
+void ControllerWorker_runOnLoop(std::function<void()> fn)
+{
+  std::lock_guard<ESPEasy_Mutex> lock(ControllerWorker_mutex);
+
+  ControllerWorker_toLoop.push_back(std::move(fn));
+}
+
+void ControllerWorker_loop()
+{
+  if (ControllerWorker_inWorker()) {
+    return;
+  }
+  std::list<std::function<void()> > toRun;
+  {
+    std::lock_guard<ESPEasy_Mutex> lock(ControllerWorker_mutex);
+
+    if (ControllerWorker_toLoop.empty()) {
+      return;
+    }
+    toRun.swap(ControllerWorker_toLoop);
+  }
+
+  for (auto it = toRun.begin(); it != toRun.end(); ++it) {
+    (*it)();
+  }
+}
+
+void ControllerWorker_waitIdle()
+{
+  if ((ControllerWorker_handle == nullptr) || ControllerWorker_inWorker()) {
+    return;
+  }
+
+  for (;;) {
+    bool idle = false;
+    {
+      std::lock_guard<ESPEasy_Mutex> lock(ControllerWorker_mutex);
+      idle = ControllerWorker_pending.empty() && !ControllerWorker_busy;
+    }
+
+    if (idle) {
+      break;
+    }
+    delay(1);
+  }
+  ControllerWorker_loop();
+}
+
+bool ControllerWorker_inWorker()
+{
+  return (ControllerWorker_handle != nullptr) &&
+         (xTaskGetCurrentTaskHandle() == ControllerWorker_handle);
+}
+
+#endif // ifdef USES_CONTROLLER_WORKER
@@ -0,0 +1,55 @@
+#ifndef HELPERS_CONTROLLERWORKER_H
+#define HELPERS_CONTROLLERWORKER_H
+
+#include "../../ESPEasy_common.h"
+
+#ifdef USES_CONTROLLER_WORKER
+
+# include <functional>
+
+// Worker task on the other ESP32 core, for blocking controller I/O.
+//
+// The Arduino loop task posts a job, which runs on the worker.
+// When the job is finished, its 'done' callback is handed back and executed on the loop task
+// (via ControllerWorker_loop() in backgroundtasks()), so all state outside the job itself
+// (scheduler, delay queues, rules, plugins) is only touched by the loop task.
+//
+// A job must only use thread safe code: its own network client and data owned by the job.
+// Log lines and a few other calls made from within a job are deferred to the loop task.
+
+# ifndef CONTROLLER_WORKER_CORE
+#  define CONTROLLER_WORKER_CORE        0    // Arduino loop task runs on core 1
+# endif // ifndef CONTROLLER_WORKER_CORE
+# ifndef CONTROLLER_WORKER_STACK_SIZE
+#  define CONTROLLER_WORKER_STACK_SIZE  8192 // bytes
+# endif // ifndef CONTROLLER_WORKER_STACK_SIZE
+# define CONTROLLER_WORKER_MAX_PENDING  8
+
+typedef std::function<bool()>                             ControllerWorker_job_t;
+typedef std::function<void(bool result, uint64_t usec)> ControllerWorker_done_t;
+
+// Start the worker task. Returns false when it could not be created,
+// in which case ControllerWorker_post() will refuse all jobs.
+bool ControllerWorker_begin();
+
+// Queue a job for the worker.
+// Returns false when the worker is not running or too many jobs are pending,
+// the caller should then run the job itself.
+bool ControllerWorker_post(ControllerWorker_job_t  job,
+                           ControllerWorker_done_t done);
+
+// Run a function on the loop task. May be called from any task.
+void ControllerWorker_runOnLoop(std::function<void()> fn);
+
+// Execute all functions handed back to the loop task.
+void ControllerWorker_loop();
+
+// Block until all posted jobs are finished and their 'done' callbacks have run.
+// Must be called before deleting data a pending job may use.
+void ControllerWorker_waitIdle();
+
+bool ControllerWorker_inWorker();
+
+#endif // ifdef USES_CONTROLLER_WORKER
+
+#endif // ifndef HELPERS_CONTROLLERWORKER_H
@@ -317,6 +317,151 @@ void Dallas_startConversion(const uint8_t ROM[8], int8_t gpio_pin_rx, int8_t gpi
   Dallas_write(0x44, gpio_pin_rx, gpio_pin_tx);
 }
 
+/*********************************************************************************************\
+*  Dallas bus-wide temperature conversion
+\*********************************************************************************************/
+struct Dallas_BusData {
+  int8_t        gpio_rx               = -1;
+  int8_t        gpio_tx               = -1;
+  uint32_t      sweep                 = 0;
+  unsigned long conversionStart       = 0;
+  unsigned long conversionReady       = 0;
+  unsigned long lastActivity          = 0;
+  uint32_t      busTime_usec          = 0; // Time spent on the bus for the current sweep
+  uint32_t      lastSweepBusTime_usec = 0;
+  uint32_t      lastSweepDuration_ms  = 0; // Start of conversion till last sensor read
+  uint16_t      sensorsRead           = 0;
+  uint16_t      lastSweepSensorsRead  = 0;
+};
+
+static std::vector<Dallas_BusData> Dallas_buses;
+
+static Dallas_BusData * Dallas_getBus(int8_t gpio_pin_rx, int8_t gpio_pin_tx, bool create)
+{
+  for (auto it = Dallas_buses.begin(); it != Dallas_buses.end(); ++it) {
+    if ((it->gpio_rx == gpio_pin_rx) && (it->gpio_tx == gpio_pin_tx)) {
+      return &(*it);
+    }
+  }
+
+  if (!create) {
+    return nullptr;
+  }
+  Dallas_BusData bus;
+  bus.gpio_rx = gpio_pin_rx;
+  bus.gpio_tx = gpio_pin_tx;
+  Dallas_buses.push_back(bus);
+  return &Dallas_buses.back();
+}
+
+unsigned long Dallas_conversionTime(uint8_t res)
+{
+  /*********************************************************************************************\
+  *  Dallas Start Temperature Conversion, expected max duration:
+  *    9 bits resolution ->  93.75 ms
+  *   10 bits resolution -> 187.5 ms
+  *   11 bits resolution -> 375 ms
+  *   12 bits resolution -> 750 ms
+  \*********************************************************************************************/
+  if ((res < 9) || (res > 12)) { res = 12; }
+  return 800 / (1 << (12 - res));
+}
+
+bool Dallas_startConversionAll(int8_t gpio_pin_rx, int8_t gpio_pin_tx, uint8_t res, uint32_t& lastSweep, unsigned long& readyTime)
+{
+  Dallas_BusData *bus = Dallas_getBus(gpio_pin_rx, gpio_pin_tx, true);
+
+  if (bus == nullptr) {
+    return false;
+  }
+
+  if ((bus->sweep != 0) && (bus->sweep != lastSweep) &&
+      !timeOutReached(bus->conversionStart + DALLAS_SWEEP_SHARE_MS)) {
+    // Join the running sweep.
+    // Each sensor converts using its own resolution, so only the wait time may need to be extended.
+    const unsigned long ready = bus->conversionStart + Dallas_conversionTime(res);
+
+    if (timeDiff(bus->conversionReady, ready) > 0) {
+      bus->conversionReady = ready;
+    }
+    lastSweep = bus->sweep;
+    readyTime = bus->conversionReady;
+    return true;
+  }
+
+  if (bus->sweep != 0) {
+    bus->lastSweepBusTime_usec = bus->busTime_usec;
+    bus->lastSweepDuration_ms  = timeDiff(bus->conversionStart, bus->lastActivity);
+    bus->lastSweepSensorsRead  = bus->sensorsRead;
+
+    #ifndef BUILD_NO_DEBUG
+    if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
+      String log = F("DS   : Bus sweep GPIO-");
+      log += gpio_pin_rx;
+      log += F(": ");
+      log += bus->lastSweepSensorsRead;
+      log += F(" sensors, bus time ");
+      log += bus->lastSweepBusTime_usec;
+      log += F(" usec, duration ");
+      log += bus->lastSweepDuration_ms;
+      log += F(" ms");
+      addLogMove(LOG_LEVEL_DEBUG, log);
+    }
+    #endif // ifndef BUILD_NO_DEBUG
+  }
+
+  const uint64_t start = getMicros64();
+
+  if (!Dallas_reset(gpio_pin_rx, gpio_pin_tx)) {
+    return false;
+  }
+  Dallas_write(0xCC, gpio_pin_rx, gpio_pin_tx); // Skip ROM, address all sensors
+  Dallas_write(0x44, gpio_pin_rx, gpio_pin_tx); // Take temperature measurement
+
+  ++bus->sweep;
+
+  if (bus->sweep == 0) { bus->sweep = 1; }
+  bus->conversionStart = millis();
+  bus->conversionReady = bus->conversionStart + Dallas_conversionTime(res);
+  bus->lastActivity    = bus->conversionStart;
+  bus->busTime_usec    = usecPassedSince(start);
+  bus->sensorsRead     = 0;
+
+  lastSweep = bus->sweep;
+  readyTime = bus->conversionReady;
+  return true;
+}
+
+void Dallas_addSweepBusTime(int8_t gpio_pin_rx, int8_t gpio_pin_tx, uint32_t usec)
+{
+  Dallas_BusData *bus = Dallas_getBus(gpio_pin_rx, gpio_pin_tx, false);
+
+  if (bus != nullptr) {
+    bus->busTime_usec += usec;
+    bus->lastActivity  = millis();
+    ++bus->sensorsRead;
+  }
+}
+
+void Dallas_show_bus_stats_webform_load(int8_t gpio_pin_rx, int8_t gpio_pin_tx)
+{
+  const Dallas_BusData *bus = Dallas_getBus(gpio_pin_rx, gpio_pin_tx, false);
+
+  if ((bus == nullptr) || (bus->lastSweepSensorsRead == 0)) {
+    return;
+  }
+  addRowLabel(F("Bus Sensors Read Per Sweep"));
+  addHtmlInt(bus->lastSweepSensorsRead);
+
+  addRowLabel(F("Bus Time Per Sweep"));
+  addHtmlInt(bus->lastSweepBusTime_usec);
+  addUnit(F("usec"));
+
+  addRowLabel(F("Sweep Duration"));
+  addHtmlInt(bus->lastSweepDuration_ms);
+  addUnit(F("ms"));
+}
+
 /*********************************************************************************************\
 *  Dallas Read temperature from scratchpad
 \*********************************************************************************************/
@@ -1059,11 +1204,8 @@ void Dallas_SensorData::set_measurement_inactive() {
   valueRead         = false;
 }
 
-bool Dallas_SensorData::initiate_read(int8_t gpio_rx, int8_t gpio_tx, int8_t res) {
+bool Dallas_SensorData::prepare_read(int8_t gpio_rx, int8_t gpio_tx, int8_t res) {
   if (addr == 0) { return false; }
-  uint8_t tmpaddr[8];
-
-  Dallas_uint64_to_addr(addr, tmpaddr);
 
   if (lastReadError) {
     if (!check_sensor(gpio_rx, gpio_tx, res)) {
@@ -1071,13 +1213,6 @@ bool Dallas_SensorData::initiate_read(int8_t gpio_rx, int8_t gpio_tx, int8_t res
     }
     lastReadError = false;
   }
-
-  if (!Dallas_address_ROM(tmpaddr, gpio_rx, gpio_tx)) {
-    ++read_failed;
-    lastReadError = true;
-    return false;
-  }
-  Dallas_write(0x44, gpio_rx, gpio_tx); // Take temperature measurement
   return true;
 }
 
@@ -1086,7 +1221,11 @@ bool Dallas_SensorData::collect_value(int8_t gpio_rx, int8_t gpio_tx) {
     uint8_t tmpaddr[8];
     Dallas_uint64_to_addr(addr, tmpaddr);
 
-    if (Dallas_readTemp(tmpaddr, &value, gpio_rx, gpio_tx)) {
+    const uint64_t start   = getMicros64();
+    const bool     success = Dallas_readTemp(tmpaddr, &value, gpio_rx, gpio_tx);
+    Dallas_addSweepBusTime(gpio_rx, gpio_tx, usecPassedSince(start));
+
+    if (success) {
       ++read_success;
       lastReadError = false;
       valueRead     = true;
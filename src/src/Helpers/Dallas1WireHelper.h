@@ -19,9 +19,11 @@ struct Dallas_SensorData {
 
   void set_measurement_inactive();
 
-  bool initiate_read(int8_t gpio_rx,
-                     int8_t gpio_tx,
-                     int8_t res);
+  // Check whether the sensor can take part in the next bus-wide conversion.
+  // The conversion itself is started using Dallas_startConversionAll()
+  bool prepare_read(int8_t gpio_rx,
+                    int8_t gpio_tx,
+                    int8_t res);
 
   bool collect_value(int8_t gpio_rx, int8_t gpio_tx);
 
@@ -101,6 +103,37 @@ void Dallas_startConversion(const uint8_t ROM[8],
                             int8_t        gpio_pin_rx,
                             int8_t        gpio_pin_tx);
 
+/*********************************************************************************************\
+*  Dallas bus-wide temperature conversion
+*
+*  All sensors on a bus are started at once using "Skip ROM" + "Convert T".
+*  Tasks using the same GPIO pin share a conversion ("sweep") when they request
+*  a conversion within DALLAS_SWEEP_SHARE_MS after it was started.
+*  Only the scratchpads have to be read per sensor.
+\*********************************************************************************************/
+#define DALLAS_SWEEP_SHARE_MS  1000
+
+// Expected max conversion time for the given resolution (9 ... 12 bit)
+unsigned long Dallas_conversionTime(uint8_t res);
+
+// Start a conversion on all sensors on the bus, or join the one already started.
+// @param lastSweep  Sweep ID last used by the caller. Will be set to the sweep ID used.
+// @param readyTime  Set to the moment the conversion is done for the given resolution.
+// @retval false when no sensor responded to the bus reset.
+bool Dallas_startConversionAll(int8_t         gpio_pin_rx,
+                               int8_t         gpio_pin_tx,
+                               uint8_t        res,
+                               uint32_t     & lastSweep,
+                               unsigned long& readyTime);
+
+// Account time spent on the bus for reading a sensor of the current sweep.
+void Dallas_addSweepBusTime(int8_t   gpio_pin_rx,
+                            int8_t   gpio_pin_tx,
+                            uint32_t usec);
+
+void Dallas_show_bus_stats_webform_load(int8_t gpio_pin_rx,
+                                        int8_t gpio_pin_tx);
+
 /*********************************************************************************************\
 *  Dallas data from scratchpad
 \*********************************************************************************************/
@@ -132,6 +132,7 @@ void deepSleepStart(int dsdelay)
   }
 
   addLog(LOG_LEVEL_INFO, F("SLEEP: Powering down to deepsleep..."));
+  storeWiFiLeaseBeforeDeepSleep(((dsdelay < 0) || (dsdelay > getDeepSleepMax())) ? getDeepSleepMax() : dsdelay);
   RTC.deepSleepState = 1;
   prepareShutdown(ESPEasy_Scheduler::IntendedRebootReason_e::DeepSleep);
 
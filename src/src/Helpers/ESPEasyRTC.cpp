@@ -2,6 +2,7 @@
 
 #include "../Globals/RTC.h"
 #include "../DataStructs/RTCStruct.h"
+#include "../DataStructs/RTCWiFiLeaseStruct.h"
 #include "../DataStructs/RTCCacheStruct.h"
 #include "../DataStructs/RTC_cache_handler_struct.h"
 #include "../DataStructs/TimingStats.h"
@@ -57,8 +58,9 @@
 // 64   RTCStruct  max 40 bytes: ( 74 - 64 ) * 4
 // 74   UserVar
 // 122  UserVar checksum:  RTC_BASE_USERVAR + UserVar.getNrElements()
-// 128  Cache (C016) metadata  4 blocks
-// 132  Cache (C016) data  6 blocks per sample => max 10 samples
+// 124  Cache (C016) metadata  4 blocks
+// 128  Cache (C016) data  6 blocks per sample => max 10 samples
+// 188  WiFi DHCP lease  4 blocks
 
 
 
@@ -80,6 +82,7 @@
 // Structs stored in RTC SLOW:
 //   - RTCStruct to keep information on reboot reason, last used WiFi, etc.
 //   - UserVar   to keep task values persistent just like on ESP8266
+//   - RTCWiFiLeaseStruct to keep the last DHCP lease during deep sleep
 
 
 
@@ -98,6 +101,7 @@ constexpr size_t UserVar_nrelements = VARS_PER_TASK * TASKS_MAX;
 RTC_NOINIT_ATTR RTCStruct RTC_tmp;
 RTC_NOINIT_ATTR float UserVar_RTC[UserVar_nrelements];
 RTC_NOINIT_ATTR uint32_t UserVar_checksum;
+RTC_NOINIT_ATTR RTCWiFiLeaseStruct RTC_WiFiLease_tmp;
 #endif
 
 
@@ -224,3 +228,41 @@ bool readUserVarFromRTC()
   #endif 
 }
 
+/********************************************************************************************\
+   Save WiFi DHCP lease to RTC memory
+ \*********************************************************************************************/
+bool saveWiFiLeaseToRTC()
+{
+  RTC_WiFiLease.updateChecksum();
+  #if defined(ESP32)
+  RTC_WiFiLease_tmp = RTC_WiFiLease;
+  return true;
+  #endif
+
+  #ifdef ESP8266
+  return system_rtc_mem_write(RTC_BASE_WIFI_LEASE, reinterpret_cast<const uint8_t *>(&RTC_WiFiLease), sizeof(RTC_WiFiLease));
+  #endif
+}
+
+/********************************************************************************************\
+   Read WiFi DHCP lease from RTC memory
+ \*********************************************************************************************/
+bool readWiFiLeaseFromRTC()
+{
+  #if defined(ESP32)
+  RTC_WiFiLease = RTC_WiFiLease_tmp;
+  #endif
+
+  #ifdef ESP8266
+  if (!system_rtc_mem_read(RTC_BASE_WIFI_LEASE, reinterpret_cast<uint8_t *>(&RTC_WiFiLease), sizeof(RTC_WiFiLease))) {
+    RTC_WiFiLease.clear();
+    return false;
+  }
+  #endif
+
+  if (!RTC_WiFiLease.isValid()) {
+    RTC_WiFiLease.clear();
+    return false;
+  }
+  return true;
+}
@@ -23,5 +23,15 @@ bool saveUserVarToRTC();
  \*********************************************************************************************/
 bool readUserVarFromRTC();
 
+/********************************************************************************************\
+   Save WiFi DHCP lease to RTC memory
+ \*********************************************************************************************/
+bool saveWiFiLeaseToRTC();
+
+/********************************************************************************************\
+   Read WiFi DHCP lease from RTC memory, returns false when not present or invalid
+ \*********************************************************************************************/
+bool readWiFiLeaseFromRTC();
+
 
 #endif
\ No newline at end of file
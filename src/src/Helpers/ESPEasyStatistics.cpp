@@ -61,6 +61,9 @@ void stream_json_timing_stats(const TimingStats& stats, long timeSinceLastReset)
   json_number(F("min"),   ull2String(minVal));
   json_number(F("max"),   ull2String(maxVal));
   json_number(F("avg"),   toString(stats.getAvg(), 2));
+  json_number(F("p50"),   String(stats.getPercentile(50)));
+  json_number(F("p95"),   String(stats.getPercentile(95)));
+  json_number(F("p99"),   String(stats.getPercentile(99)));
   json_prop(F("unit"), F("usec"));
 }
 
@@ -69,12 +72,18 @@ void jsonStatistics(bool clearStats) {
   int  currentPluginId = -1;
   long timeSinceLastReset = timePassedSince(timingstats_last_reset);
 
+  if (clearStats) {
+    releaseUnusedTimingStats();
+  }
 
   json_open(true, F("plugin"));
 
-  for (auto& x: pluginStats) {
-    if (!x.second.isEmpty()) {
-      const int deviceIndex = x.first / 256;
+  for (uint8_t slot = 0; slot < pluginStats.size(); ++slot) {
+    const int    key   = pluginStats.getKey(slot);
+    TimingStats& stats = pluginStats.getStats(slot);
+
+    if (!stats.isEmpty()) {
+      const int deviceIndex = key / 256;
 
       if (currentPluginId != deviceIndex) {
         // new plugin
@@ -93,12 +102,12 @@ void jsonStatistics(bool clearStats) {
       }
 
       // Stream function timing stats
-      json_open(false, getPluginFunctionName(x.first % 256));
+      json_open(false, getPluginFunctionName(key % 256));
       {
-        stream_json_timing_stats(x.second, timeSinceLastReset);
+        stream_json_timing_stats(stats, timeSinceLastReset);
       }
       json_close(false);
-      if (clearStats) { x.second.reset(); }
+      if (clearStats) { stats.reset(); }
       firstPlugin = false;
     }
   }
@@ -114,9 +123,12 @@ void jsonStatistics(bool clearStats) {
   json_open(true, F("controller"));
   bool firstController = true;
   int  currentProtocolIndex = -1;
-  for (auto& x: controllerStats) {
-    if (!x.second.isEmpty()) {      
-      const int ProtocolIndex = x.first / 256;
+  for (uint8_t slot = 0; slot < controllerStats.size(); ++slot) {
+    const int    key   = controllerStats.getKey(slot);
+    TimingStats& stats = controllerStats.getStats(slot);
+
+    if (!stats.isEmpty()) {
+      const int ProtocolIndex = key / 256;
       if (currentProtocolIndex != ProtocolIndex) {
         // new protocol
         currentProtocolIndex = ProtocolIndex;
@@ -134,12 +146,12 @@ void jsonStatistics(bool clearStats) {
 
       }
       // Stream function timing stats
-      json_open(false, getCPluginCFunctionName(static_cast<CPlugin::Function>(x.first % 256)));
+      json_open(false, getCPluginCFunctionName(static_cast<CPlugin::Function>(key % 256)));
       {
-        stream_json_timing_stats(x.second, timeSinceLastReset);
+        stream_json_timing_stats(stats, timeSinceLastReset);
       }
       json_close(false);
-      if (clearStats) { x.second.reset(); }
+      if (clearStats) { stats.reset(); }
       firstController = false;
     }
   }
@@ -154,23 +166,26 @@ void jsonStatistics(bool clearStats) {
 
 
   json_open(true, F("misc"));
-  for (auto& x: miscStats) {
-    if (!x.second.isEmpty()) {
+  for (uint8_t slot = 0; slot < miscStats.size(); ++slot) {
+    const int    key   = miscStats.getKey(slot);
+    TimingStats& stats = miscStats.getStats(slot);
+
+    if (!stats.isEmpty()) {
       json_open(); // open new misc item
-      json_prop(F("name"), getMiscStatsName(x.first));
-      json_prop(F("id"),   String(x.first));
+      json_prop(F("name"), getMiscStatsName(key));
+      json_prop(F("id"),   String(key));
       json_open(true, F("function")); // open function
       json_open(); // open first function element
       // Stream function timing stats
-      json_open(false, to_internal_string(getMiscStatsName(x.first), '-'));
+      json_open(false, to_internal_string(getMiscStatsName(key), '-'));
       {
-        stream_json_timing_stats(x.second, timeSinceLastReset);
+        stream_json_timing_stats(stats, timeSinceLastReset);
       }
       json_close(false);
       json_close();     // close first function element
       json_close(true); // close function
       json_close();     // close misc item
-      if (clearStats) { x.second.reset(); }
+      if (clearStats) { stats.reset(); }
     }
   }
 
@@ -150,6 +150,11 @@ fs::File tryOpenFile(const String& fname, const String& mode) {
     }
     Cache.fileExistsMap.clear();
   }
+  #ifdef USE_ASSET_PACK
+  if (mode != F("r")) {
+    Cache.assetPack.invalidate(fname);
+  }
+  #endif // ifdef USE_ASSET_PACK
   f = ESPEASY_FS.open(patch_fname(fname), mode.c_str());
   STOP_TIMER(TRY_OPEN_FILE);
   return f;
@@ -159,6 +164,10 @@ bool tryRenameFile(const String& fname_old, const String& fname_new) {
   Cache.fileExistsMap.clear();
   if (fileExists(fname_old) && !fileExists(fname_new)) {
     clearAllCaches();
+    #ifdef USE_ASSET_PACK
+    Cache.assetPack.invalidate(fname_old);
+    Cache.assetPack.invalidate(fname_new);
+    #endif // ifdef USE_ASSET_PACK
     return ESPEASY_FS.rename(patch_fname(fname_old), patch_fname(fname_new));
   }
   return false;
@@ -168,6 +177,9 @@ bool tryDeleteFile(const String& fname) {
   if (fname.length() > 0)
   {
     clearAllCaches();
+    #ifdef USE_ASSET_PACK
+    Cache.assetPack.invalidate(fname);
+    #endif // ifdef USE_ASSET_PACK
     bool res = ESPEASY_FS.remove(patch_fname(fname));
 
     // A call to GarbageCollection() will at most erase a single block. (e.g. 8k block size)
@@ -341,6 +353,9 @@ void fileSystemCheck()
 #endif
   {
     clearAllCaches();
+    #ifdef USE_ASSET_PACK
+    Cache.assetPack.begin();
+    #endif // ifdef USE_ASSET_PACK
     if (loglevelActiveFor(LOG_LEVEL_INFO)) {
       String log = F("FS   : Mount successful, used ");
       log += SpiffsUsedBytes();
@@ -373,6 +388,10 @@ void fileSystemCheck()
 }
 
 bool FS_format() {
+  #ifdef USE_ASSET_PACK
+  // The packed files are no longer present after formatting.
+  Cache.assetPack.erase();
+  #endif // ifdef USE_ASSET_PACK
   #ifdef USE_LITTLEFS
     #ifdef ESP32
     const bool res = ESPEASY_FS.begin(true);
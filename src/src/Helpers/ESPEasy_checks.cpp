@@ -88,7 +88,7 @@ void run_compiletime_checks() {
   #ifdef USES_NOTIFIER
   check_size<NotificationSettingsStruct,            996u>();
   #endif
-  check_size<ExtraTaskSettingsStruct,               472u>();
+  check_size<ExtraTaskSettingsStruct,               516u>();
   #if ESP_IDF_VERSION_MAJOR > 3
   // String class has increased with 4 bytes
   check_size<EventStruct,                           116u>(); // Is not stored
@@ -119,7 +119,7 @@ void run_compiletime_checks() {
   #endif
 
   check_size<systemTimerStruct,                     24u>();
-  check_size<RTCStruct,                             32u>();
+  check_size<RTCStruct,                             36u>();
   check_size<portStatusStruct,                      6u>();
   check_size<ResetFactoryDefaultPreference_struct,  4u>();
   check_size<GpioFactorySettingsStruct,             18u>();
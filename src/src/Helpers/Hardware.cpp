@@ -1,6 +1,7 @@
 #include "../Helpers/Hardware.h"
 
 #include "../CustomBuild/ESPEasyLimits.h"
+#include "../DataStructs/TimingStats.h"
 #include "../DataTypes/SPI_options.h"
 #include "../ESPEasyCore/ESPEasyGPIO.h"
 #include "../ESPEasyCore/ESPEasy_Log.h"
@@ -241,6 +242,7 @@ void initI2C() {
   }
 
 #ifdef FEATURE_I2CMULTIPLEXER
+  I2CMultiplexerInvalidateState();
 
   if (validGpio(Settings.I2C_Multiplexer_ResetPin)) { // Initialize Reset pin to High if configured
     pinMode(Settings.I2C_Multiplexer_ResetPin, OUTPUT);
@@ -303,6 +305,10 @@ void I2CForceResetBus_swap_pins(uint8_t address) {
   delay(1);
   // Now we switch back to the correct pins
   I2CSelectClockSpeed(100000);
+  #ifdef FEATURE_I2CMULTIPLEXER
+  // Can't tell what the multiplexer made of this.
+  I2CMultiplexerInvalidateState();
+  #endif
 }
 
 void I2CBegin(int8_t sda, int8_t scl, uint32_t clockFreq) {
@@ -311,8 +317,10 @@ void I2CBegin(int8_t sda, int8_t scl, uint32_t clockFreq) {
   static int8_t last_scl = -1;
   if (clockFreq == lastI2CClockSpeed && sda == last_sda && scl == last_scl) {
     // No need to change the clock speed.
+    ++I2C_clock_change_skipped;
     return;
   }
+  START_TIMER;
   lastI2CClockSpeed = clockFreq;
   last_scl = scl;
   last_sda = sda;
@@ -323,10 +331,15 @@ void I2CBegin(int8_t sda, int8_t scl, uint32_t clockFreq) {
   Wire.begin(sda, scl);
   Wire.setClock(clockFreq);
   #endif
+  ++I2C_clock_change_count;
+  STOP_TIMER(I2C_CLOCK_CHANGE);
 }
 
 #ifdef FEATURE_I2CMULTIPLEXER
 
+// Last value written to the multiplexer control register, -1 = unknown.
+static int16_t I2C_Multiplexer_current = -1;
+
 // Check if the I2C Multiplexer is enabled
 bool isI2CMultiplexerEnabled() {
   return Settings.I2C_Multiplexer_Type != I2C_MULTIPLEXER_NONE
@@ -339,6 +352,7 @@ void I2CMultiplexerReset() {
     digitalWrite(Settings.I2C_Multiplexer_ResetPin, LOW);
     delay(1); // minimum requirement of low for a proper reset seems to be about 6 nsec, so 1 msec should be more than sufficient
     digitalWrite(Settings.I2C_Multiplexer_ResetPin, HIGH);
+    I2C_Multiplexer_current = 0; // No channel selected after reset
   }
 }
 
@@ -397,14 +411,26 @@ void I2CMultiplexerOff() {
 
 void SetI2CMultiplexer(uint8_t toWrite) {
   if (isI2CMultiplexerEnabled()) {
-    // FIXME TD-er: Must check to see if we can cache the value so only change it when needed.
+    if (I2C_Multiplexer_current == toWrite) {
+      ++I2C_mux_switch_skipped;
+      return;
+    }
+    START_TIMER;
     Wire.beginTransmission(Settings.I2C_Multiplexer_Addr);
     Wire.write(toWrite);
-    Wire.endTransmission();
+
+    // Only remember the state when the write was acknowledged, otherwise try again next time.
+    I2C_Multiplexer_current = (Wire.endTransmission() == 0) ? toWrite : -1;
+    ++I2C_mux_switch_count;
+    STOP_TIMER(I2C_MUX_SWITCH);
     // FIXME TD-er: We must check if the chip needs some time to set the output. (delay?)
   }
 }
 
+void I2CMultiplexerInvalidateState() {
+  I2C_Multiplexer_current = -1;
+}
+
 uint8_t I2CMultiplexerMaxChannels() {
   uint channels = 0;
 
@@ -38,6 +38,9 @@ void I2CMultiplexerOff();
 
 void SetI2CMultiplexer(uint8_t toWrite);
 
+// Forget the cached multiplexer state, so the next select will always write to the multiplexer.
+void I2CMultiplexerInvalidateState();
+
 uint8_t I2CMultiplexerMaxChannels();
 
 void I2CMultiplexerReset();
@@ -0,0 +1,280 @@
+#include "../Helpers/I2C_async.h"
+
+#include "../DataTypes/DeviceIndex.h"
+#include "../Globals/ESPEasy_Scheduler.h"
+#include "../Globals/I2Cdev.h"
+#include "../Globals/Plugins.h"
+#include "../Helpers/ESPEasy_time_calc.h"
+
+#include <map>
+
+
+// **************************************************************************/
+// Default bus, using the Wire library
+// **************************************************************************/
+class I2C_async_wire_bus : public I2C_async_bus {
+public:
+
+  bool write(uint8_t i2caddr, const uint8_t *data, uint8_t length) override {
+    Wire.beginTransmission(i2caddr);
+
+    if (length > 0) {
+      Wire.write(data, length);
+    }
+    return Wire.endTransmission() == 0;
+  }
+
+  bool read(uint8_t i2caddr, uint16_t reg, uint8_t *data, uint8_t length) override {
+    if (reg != I2C_ASYNC_NO_REG) {
+      Wire.beginTransmission(i2caddr);
+      Wire.write(static_cast<uint8_t>(reg));
+
+      if (Wire.endTransmission() != 0) {
+        return false;
+      }
+    }
+
+    if (Wire.requestFrom(i2caddr, length) != length) {
+      return false;
+    }
+
+    for (uint8_t i = 0; i < length; ++i) {
+      data[i] = Wire.read();
+    }
+    return true;
+  }
+};
+
+static I2C_async_wire_bus I2C_async_wire;
+static I2C_async_bus     *I2C_async_activeBus = &I2C_async_wire;
+
+void I2C_async_setBus(I2C_async_bus *bus) {
+  I2C_async_activeBus = (bus == nullptr) ? &I2C_async_wire : bus;
+}
+
+I2C_async_bus& I2C_async_getBus() {
+  return *I2C_async_activeBus;
+}
+
+// **************************************************************************/
+// Transaction state machine
+// **************************************************************************/
+bool I2C_async_transaction::set(uint8_t        i2caddr,
+                                const uint8_t *cmd,
+                                uint8_t        cmdLength,
+                                uint16_t       reg,
+                                uint8_t        readLength,
+                                unsigned long  conversionTime_ms) {
+  if ((cmdLength > I2C_ASYNC_MAX_WRITE) || (readLength == 0) || (readLength > I2C_ASYNC_MAX_READ)) {
+    _state = I2C_async_state_e::Error;
+    return false;
+  }
+  _i2caddr           = i2caddr;
+  _reg               = reg;
+  _cmdLength         = cmdLength;
+  _readLength        = readLength;
+  _conversionTime_ms = conversionTime_ms;
+
+  for (uint8_t i = 0; i < cmdLength; ++i) {
+    _cmd[i] = cmd[i];
+  }
+  return true;
+}
+
+bool I2C_async_transaction::start(I2C_async_bus& bus,
+                                  uint8_t        i2caddr,
+                                  const uint8_t *cmd,
+                                  uint8_t        cmdLength,
+                                  uint16_t       reg,
+                                  uint8_t        readLength,
+                                  unsigned long  now,
+                                  unsigned long  conversionTime_ms) {
+  if (!set(i2caddr, cmd, cmdLength, reg, readLength, conversionTime_ms)) {
+    return false;
+  }
+  return startQueued(bus, now);
+}
+
+bool I2C_async_transaction::queue(uint8_t        i2caddr,
+                                  const uint8_t *cmd,
+                                  uint8_t        cmdLength,
+                                  uint16_t       reg,
+                                  uint8_t        readLength,
+                                  unsigned long  conversionTime_ms) {
+  if (!set(i2caddr, cmd, cmdLength, reg, readLength, conversionTime_ms)) {
+    return false;
+  }
+  _state = I2C_async_state_e::Queued;
+  return true;
+}
+
+bool I2C_async_transaction::startQueued(I2C_async_bus& bus, unsigned long now) {
+  _due = now + _conversionTime_ms;
+
+  if ((_cmdLength > 0) && !bus.write(_i2caddr, _cmd, _cmdLength)) {
+    _state = I2C_async_state_e::Error;
+    return false;
+  }
+  _state = I2C_async_state_e::Waiting;
+  return true;
+}
+
+bool I2C_async_transaction::isDue(unsigned long now) const {
+  return (_state == I2C_async_state_e::Waiting) && (timeDiff(_due, now) >= 0);
+}
+
+bool I2C_async_transaction::process(I2C_async_bus& bus, unsigned long now) {
+  if (!isDue(now)) {
+    return false;
+  }
+  _state = bus.read(_i2caddr, _reg, _data, _readLength)
+           ? I2C_async_state_e::Ready
+           : I2C_async_state_e::Error;
+  return true;
+}
+
+bool I2C_async_transaction::getResult(uint8_t *data, uint8_t length) {
+  if ((_state != I2C_async_state_e::Ready) || (length > _readLength)) {
+    return false;
+  }
+
+  for (uint8_t i = 0; i < length; ++i) {
+    data[i] = _data[i];
+  }
+  _state = I2C_async_state_e::Idle;
+  return true;
+}
+
+// **************************************************************************/
+// Per task transactions
+// **************************************************************************/
+
+// Only tasks actually using async transactions get an entry.
+static std::map<taskIndex_t, I2C_async_transaction> I2C_async_transactions;
+
+// Returns true when another task is waiting for a result from the same address.
+static bool I2C_async_addressBusy(taskIndex_t taskIndex, uint8_t i2caddr) {
+  for (auto it = I2C_async_transactions.begin(); it != I2C_async_transactions.end(); ++it) {
+    if ((it->first != taskIndex) &&
+        (it->second.getState() == I2C_async_state_e::Waiting) &&
+        (it->second.getI2Caddr() == i2caddr)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Write the command of the first queued transaction for the address, after the given task.
+// Starting the search after the finished task serves the queued tasks in turn.
+static void I2C_async_startNextQueued(taskIndex_t finishedTaskIndex, uint8_t i2caddr) {
+  for (taskIndex_t i = 1; i <= TASKS_MAX; ++i) {
+    const taskIndex_t taskIndex = (finishedTaskIndex + i) % TASKS_MAX;
+    auto it                     = I2C_async_transactions.find(taskIndex);
+
+    if ((it == I2C_async_transactions.end()) ||
+        (it->second.getState() != I2C_async_state_e::Queued) ||
+        (it->second.getI2Caddr() != i2caddr)) {
+      continue;
+    }
+    const deviceIndex_t DeviceIndex = getDeviceIndex_from_TaskIndex(taskIndex);
+
+    if (!prepare_I2C_by_taskIndex(taskIndex, DeviceIndex)) {
+      it->second.cancel();
+      continue;
+    }
+    const bool started = it->second.startQueued(I2C_async_getBus(), millis());
+    post_I2C_by_taskIndex(taskIndex, DeviceIndex);
+
+    if (started) {
+      Scheduler.setPluginTaskTimer(it->second.getConversionTime(), taskIndex, I2C_ASYNC_TIMER_PAR1 + taskIndex);
+      return;
+    }
+  }
+}
+
+bool I2C_async_start(taskIndex_t    taskIndex,
+                     uint8_t        i2caddr,
+                     const uint8_t *cmd,
+                     uint8_t        cmdLength,
+                     uint16_t       reg,
+                     uint8_t        readLength,
+                     unsigned long  conversionTime_ms) {
+  if (!validTaskIndex(taskIndex)) {
+    return false;
+  }
+  I2C_async_transaction& transaction = I2C_async_transactions[taskIndex];
+
+  if (I2C_async_addressBusy(taskIndex, i2caddr)) {
+    return transaction.queue(i2caddr, cmd, cmdLength, reg, readLength, conversionTime_ms);
+  }
+
+  if (!transaction.start(I2C_async_getBus(), i2caddr, cmd, cmdLength, reg, readLength, millis(), conversionTime_ms)) {
+    return false;
+  }
+
+  // (Re)start the timer, a pending timer of this task with the same Par1 is replaced.
+  Scheduler.setPluginTaskTimer(conversionTime_ms, taskIndex, I2C_ASYNC_TIMER_PAR1 + taskIndex);
+  return true;
+}
+
+bool I2C_async_isTimer(taskIndex_t taskIndex, int Par1) {
+  return validTaskIndex(taskIndex) && (Par1 == static_cast<int>(I2C_ASYNC_TIMER_PAR1 + taskIndex));
+}
+
+void I2C_async_process(taskIndex_t taskIndex) {
+  auto it = I2C_async_transactions.find(taskIndex);
+
+  if (it == I2C_async_transactions.end()) {
+    return;
+  }
+  const unsigned long now = millis();
+
+  if (!it->second.isDue(now)) {
+    return;
+  }
+  const deviceIndex_t DeviceIndex = getDeviceIndex_from_TaskIndex(taskIndex);
+
+  if (!prepare_I2C_by_taskIndex(taskIndex, DeviceIndex)) {
+    it->second.cancel();
+  } else {
+    it->second.process(I2C_async_getBus(), now);
+    post_I2C_by_taskIndex(taskIndex, DeviceIndex);
+  }
+
+  // The result has been read (or the transaction failed), so the device is free again.
+  I2C_async_startNextQueued(taskIndex, it->second.getI2Caddr());
+}
+
+I2C_async_state_e I2C_async_getState(taskIndex_t taskIndex) {
+  auto it = I2C_async_transactions.find(taskIndex);
+
+  if (it == I2C_async_transactions.end()) {
+    return I2C_async_state_e::Idle;
+  }
+  return it->second.getState();
+}
+
+bool I2C_async_getResult(taskIndex_t taskIndex, uint8_t *data, uint8_t length) {
+  auto it = I2C_async_transactions.find(taskIndex);
+
+  if (it == I2C_async_transactions.end()) {
+    return false;
+  }
+  return it->second.getResult(data, length);
+}
+
+void I2C_async_cancel(taskIndex_t taskIndex) {
+  auto it = I2C_async_transactions.find(taskIndex);
+
+  if (it == I2C_async_transactions.end()) {
+    return;
+  }
+  const bool    wasWaiting = it->second.getState() == I2C_async_state_e::Waiting;
+  const uint8_t i2caddr    = it->second.getI2Caddr();
+
+  I2C_async_transactions.erase(it);
+
+  if (wasWaiting) {
+    I2C_async_startNextQueued(taskIndex, i2caddr);
+  }
+}
@@ -0,0 +1,168 @@
+#ifndef HELPERS_I2C_ASYNC_H
+#define HELPERS_I2C_ASYNC_H
+
+#include "../../ESPEasy_common.h"
+
+#include "../DataTypes/TaskIndex.h"
+
+// Non-blocking I2C transactions for sensors with a slow conversion.
+//
+// Instead of writing a "start conversion" command, calling delay() and then reading the result,
+// a plugin calls I2C_async_start().
+// The command is written immediately and the scheduler performs the read after the given
+// conversion time, via a plugin task timer. Meanwhile other tasks and the web server keep running.
+// When the read has been done, the plugin receives PLUGIN_TIMER_IN with
+// I2C_async_isTimer(event->TaskIndex, event->Par1) == true and can fetch the data using
+// I2C_async_getResult().
+//
+// A task can have only one pending transaction. Starting a new one cancels the pending one.
+//
+// Tasks may share a device, e.g. several channels of one ADC. Starting a new conversion would
+// then overwrite the result of a conversion still in progress for another task.
+// Therefore only one transaction per I2C address is in progress at a time. A transaction started
+// while another task is waiting for a result from the same address is queued and the command is
+// written as soon as the result of the other task has been read.
+
+#define I2C_ASYNC_MAX_WRITE   4
+#define I2C_ASYNC_MAX_READ    8
+#define I2C_ASYNC_NO_REG      0xFFFF  // Read without writing a register pointer first
+#define I2C_ASYNC_TIMER_PAR1  0xA5C00 // Par1 of the plugin task timer is this value + taskIndex
+
+
+// Access to the bus, which can be replaced by a mock implementation to run the
+// transaction state machine on a host without hardware.
+class I2C_async_bus {
+public:
+
+  virtual ~I2C_async_bus() {}
+
+  virtual bool write(uint8_t        i2caddr,
+                     const uint8_t *data,
+                     uint8_t        length) = 0;
+
+  // When reg != I2C_ASYNC_NO_REG, the register pointer is written before reading.
+  virtual bool read(uint8_t  i2caddr,
+                    uint16_t reg,
+                    uint8_t *data,
+                    uint8_t  length) = 0;
+};
+
+// Set the bus used for all asynchronous transactions. nullptr selects the Wire library.
+void I2C_async_setBus(I2C_async_bus *bus);
+
+I2C_async_bus& I2C_async_getBus();
+
+
+enum class I2C_async_state_e : uint8_t {
+  Idle,
+  Queued,  // Waiting for a transaction of another task on the same address to finish
+  Waiting, // Command written, waiting for the conversion time to pass
+  Ready,   // Result read, can be fetched
+  Error    // Writing the command or reading the result failed
+};
+
+// State machine of a single transaction.
+// Does not depend on the scheduler, all timing is based on the given 'now' (msec).
+class I2C_async_transaction {
+public:
+
+  bool start(I2C_async_bus& bus,
+             uint8_t        i2caddr,
+             const uint8_t *cmd,
+             uint8_t        cmdLength,
+             uint16_t       reg,
+             uint8_t        readLength,
+             unsigned long  now,
+             unsigned long  conversionTime_ms);
+
+  // Store the transaction, the command is written later using startQueued().
+  bool queue(uint8_t        i2caddr,
+             const uint8_t *cmd,
+             uint8_t        cmdLength,
+             uint16_t       reg,
+             uint8_t        readLength,
+             unsigned long  conversionTime_ms);
+
+  bool startQueued(I2C_async_bus& bus,
+                   unsigned long  now);
+
+  // Perform the read when due.
+  // Returns true when the transaction is finished (Ready or Error) by this call.
+  bool process(I2C_async_bus& bus,
+               unsigned long  now);
+
+  bool isDue(unsigned long now) const;
+
+  I2C_async_state_e getState() const {
+    return _state;
+  }
+
+  uint8_t getI2Caddr() const {
+    return _i2caddr;
+  }
+
+  unsigned long getConversionTime() const {
+    return _conversionTime_ms;
+  }
+
+  // Copy the result and return to Idle.
+  bool getResult(uint8_t *data,
+                 uint8_t  length);
+
+  void cancel() {
+    _state = I2C_async_state_e::Idle;
+  }
+
+private:
+
+  bool set(uint8_t        i2caddr,
+           const uint8_t *cmd,
+           uint8_t        cmdLength,
+           uint16_t       reg,
+           uint8_t        readLength,
+           unsigned long  conversionTime_ms);
+
+  unsigned long     _due                      = 0;
+  unsigned long     _conversionTime_ms        = 0;
+  uint16_t          _reg                      = I2C_ASYNC_NO_REG;
+  uint8_t           _cmd[I2C_ASYNC_MAX_WRITE] = { 0 };
+  uint8_t           _data[I2C_ASYNC_MAX_READ] = { 0 };
+  uint8_t           _i2caddr                  = 0;
+  uint8_t           _cmdLength                = 0;
+  uint8_t           _readLength               = 0;
+  I2C_async_state_e _state                    = I2C_async_state_e::Idle;
+};
+
+
+// **************************************************************************/
+// Per task transactions, processed by the scheduler
+// **************************************************************************/
+
+// Write cmd (may be empty) and schedule reading readLength bytes from reg
+// after conversionTime_ms.
+// When another task is waiting for a result from the same address, the transaction is queued.
+// Must be called from a plugin call for the task, so the I2C multiplexer channel is set.
+bool I2C_async_start(taskIndex_t    taskIndex,
+                     uint8_t        i2caddr,
+                     const uint8_t *cmd,
+                     uint8_t        cmdLength,
+                     uint16_t       reg,
+                     uint8_t        readLength,
+                     unsigned long  conversionTime_ms);
+
+// Check whether a PLUGIN_TIMER_IN event signals the end of a transaction.
+bool I2C_async_isTimer(taskIndex_t taskIndex,
+                       int         Par1);
+
+// Called by the scheduler when the plugin task timer of a transaction expires.
+void I2C_async_process(taskIndex_t taskIndex);
+
+I2C_async_state_e I2C_async_getState(taskIndex_t taskIndex);
+
+bool I2C_async_getResult(taskIndex_t taskIndex,
+                         uint8_t    *data,
+                         uint8_t     length);
+
+void I2C_async_cancel(taskIndex_t taskIndex);
+
+#endif // ifndef HELPERS_I2C_ASYNC_H
@@ -7,6 +7,7 @@
 #include "../ESPEasyCore/Serial.h"
 #include "../Globals/ESPEasy_time.h"
 #include "../Globals/Statistics.h"
+#include "../Helpers/ControllerWorker.h"
 #include "../Helpers/ESPEasy_FactoryDefault.h"
 #include "../Helpers/ESPEasy_Storage.h"
 #include "../Helpers/Numerical.h"
@@ -275,6 +276,13 @@ void reboot(ESPEasy_Scheduler::IntendedRebootReason_e reason) {
 
 void FeedSW_watchdog()
 {
+  #ifdef USES_CONTROLLER_WORKER
+  if (ControllerWorker_inWorker()) {
+    // Only the loop task feeds the watchdog.
+    ControllerWorker_runOnLoop([]() { FeedSW_watchdog(); });
+    return;
+  }
+  #endif // ifdef USES_CONTROLLER_WORKER
   #ifdef ESP8266
   ESP.wdtFeed();
   #endif // ifdef ESP8266
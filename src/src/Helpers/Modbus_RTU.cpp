@@ -34,6 +34,8 @@ void ModbusRTU_struct::reset() {
   _reads_pass       = 0;
   _reads_crc_failed = 0;
   _reads_nodata     = 0;
+  _queue.clear();
+  _transactionActive = false;
 }
 
 bool ModbusRTU_struct::init(const ESPEasySerialPort port, const int16_t serial_rx, const int16_t serial_tx, int16_t baudrate, uint8_t address) {
@@ -413,6 +415,8 @@ void ModbusRTU_struct::logModbusException(uint8_t value) {
    }
  */
 uint8_t ModbusRTU_struct::processCommand() {
+  waitTransactionDone();
+
   // CRC-calculation
   unsigned int crc =
     ModRTU_CRC(_sendframe, _sendframe_used);
@@ -493,17 +497,8 @@ uint8_t ModbusRTU_struct::processCommand() {
       _reads_nodata = 0;
     }
 
-    switch (return_value) {
-      case MODBUS_EXCEPTION_ACKNOWLEDGE:
-      case MODBUS_EXCEPTION_SLAVE_OR_SERVER_BUSY:
-      case MODBUS_BADCRC:
-      case MODBUS_TIMEOUT:
-
-        // Bad communication, makes sense to retry.
-        break;
-      default:
-        nrRetriesLeft = 0; // When not supported, does not make sense to retry.
-        break;
+    if (!mustRetry(return_value)) {
+      nrRetriesLeft = 0; // When not supported, does not make sense to retry.
     }
     --nrRetriesLeft;
   }
@@ -511,6 +506,202 @@ uint8_t ModbusRTU_struct::processCommand() {
   return return_value;
 }
 
+bool ModbusRTU_struct::mustRetry(uint8_t errorcode) {
+  switch (errorcode) {
+    case MODBUS_EXCEPTION_ACKNOWLEDGE:
+    case MODBUS_EXCEPTION_SLAVE_OR_SERVER_BUSY:
+    case MODBUS_BADCRC:
+    case MODBUS_TIMEOUT:
+
+      // Bad communication, makes sense to retry.
+      return true;
+  }
+  return false;
+}
+
+bool ModbusRTU_struct::queueReadRegisters(uint8_t functionCode, uint16_t address, uint8_t count,
+                                          ModbusRTU_callback_t callback) {
+  return queueReadRegisters(_modbus_address, functionCode, address, count, callback);
+}
+
+bool ModbusRTU_struct::queueReadRegisters(uint8_t slaveAddress, uint8_t functionCode, uint16_t address, uint8_t count,
+                                          ModbusRTU_callback_t callback) {
+  if (!isInitialized() || (count == 0) || (count > MODBUS_MAX_MERGED_REGISTERS)) {
+    return false;
+  }
+
+  if ((functionCode != MODBUS_READ_HOLDING_REGISTERS) && (functionCode != MODBUS_READ_INPUT_REGISTERS)) {
+    return false;
+  }
+  const uint32_t end = static_cast<uint32_t>(address) + count;
+
+  auto it = _queue.begin();
+
+  if (_transactionActive && (it != _queue.end())) {
+    // Already sent, cannot be extended anymore.
+    ++it;
+  }
+
+  for (; it != _queue.end(); ++it) {
+    if ((it->slaveAddress != slaveAddress) || (it->functionCode != functionCode)) {
+      continue;
+    }
+    const uint32_t it_end = static_cast<uint32_t>(it->startAddress) + it->count;
+
+    if ((address > it_end) || (end < it->startAddress)) {
+      // Not adjacent or overlapping
+      continue;
+    }
+    const uint16_t newStart = address < it->startAddress ? address : it->startAddress;
+    const uint32_t newEnd   = end > it_end ? end : it_end;
+
+    if ((newEnd - newStart) > MODBUS_MAX_MERGED_REGISTERS) {
+      continue;
+    }
+
+    if (newStart < it->startAddress) {
+      const uint16_t shift = it->startAddress - newStart;
+
+      for (auto req = it->requests.begin(); req != it->requests.end(); ++req) {
+        req->offset += shift;
+      }
+    }
+    it->startAddress = newStart;
+    it->count        = newEnd - newStart;
+
+    AsyncRequest request;
+    request.offset   = address - newStart;
+    request.count    = count;
+    request.callback = callback;
+    it->requests.push_back(std::move(request));
+    return true;
+  }
+
+  if (_queue.size() >= MODBUS_MAX_QUEUED_TRANSACTIONS) {
+    return false;
+  }
+  AsyncTransaction transaction;
+  transaction.startAddress = address;
+  transaction.slaveAddress = slaveAddress;
+  transaction.functionCode = functionCode;
+  transaction.count        = count;
+
+  AsyncRequest request;
+  request.count    = count;
+  request.callback = callback;
+  transaction.requests.push_back(std::move(request));
+  _queue.push_back(std::move(transaction));
+  return true;
+}
+
+void ModbusRTU_struct::processQueue() {
+  if (_queue.empty() || !isInitialized()) {
+    return;
+  }
+  AsyncTransaction& transaction = _queue.front();
+
+  if (!_transactionActive) {
+    // Discard any data not belonging to this request
+    while (easySerial->available()) {
+      easySerial->read();
+    }
+    buildFrame(transaction.slaveAddress, transaction.functionCode, transaction.startAddress, transaction.count);
+    const unsigned int crc = ModRTU_CRC(_sendframe, _sendframe_used);
+    _sendframe[_sendframe_used++] = (uint8_t)(crc & 0xFF);
+    _sendframe[_sendframe_used++] = (uint8_t)((crc >> 8) & 0xFF);
+
+    startWrite();
+    easySerial->write(_sendframe, _sendframe_used);
+    easySerial->flush();
+    startRead();
+
+    _recv_buf_used      = 0;
+    _transactionTimeout = millis() + _modbus_timeout;
+    _transactionActive  = true;
+    return;
+  }
+
+  while (easySerial->available() && _recv_buf_used < MODBUS_RECEIVE_BUFFER) {
+    _recv_buf[_recv_buf_used++] = easySerial->read();
+  }
+
+  //  idx:    0,   1,   2,   3,   4,   5,   6,   7
+  // send: 0x02,0x03,0x00,0x00,0x00,0x01,0x39,0x84
+  // recv: 0x02,0x03,0x02,0x01,0x57,0xBC,0x2A
+  // exception: 0x02,0x83,0x02,crc,crc
+  uint8_t errorcode = 0;
+
+  if ((_recv_buf_used >= 5) && ((_recv_buf[1] & 0x80) != 0)) {
+    if ((ModRTU_CRC(_recv_buf, 5) == 0) && (_recv_buf[0] == transaction.slaveAddress)) {
+      ++_reads_pass;
+      _reads_nodata = 0;
+      errorcode     = _recv_buf[2];
+    } else {
+      ++_reads_crc_failed;
+      errorcode = MODBUS_BADCRC;
+    }
+  } else if ((_recv_buf_used > 2) && (_recv_buf_used >= (3 + _recv_buf[2] + 2))) {
+    if ((ModRTU_CRC(_recv_buf, 3 + _recv_buf[2] + 2) == 0) && (_recv_buf[0] == transaction.slaveAddress)) {
+      ++_reads_pass;
+      _reads_nodata = 0;
+
+      if (_recv_buf[2] != (2 * transaction.count)) {
+        errorcode = MODBUS_BADDATA;
+      }
+    } else {
+      ++_reads_crc_failed;
+      errorcode = MODBUS_BADCRC;
+    }
+  } else if (timeOutReached(_transactionTimeout)) {
+    ++_reads_nodata;
+    errorcode = (_recv_buf_used == 0) ? MODBUS_NODATA : MODBUS_TIMEOUT;
+  } else {
+    // Still waiting for the reply
+    return;
+  }
+
+  if ((errorcode != 0) && mustRetry(errorcode) && (transaction.retriesLeft > 0)) {
+    --transaction.retriesLeft;
+    _transactionActive = false; // Resend on next call
+    return;
+  }
+  finishTransaction(errorcode);
+}
+
+void ModbusRTU_struct::finishTransaction(uint8_t errorcode) {
+  _transactionActive = false;
+  _last_error        = errorcode;
+
+  if (errorcode != 0) {
+    logModbusException(errorcode);
+  }
+
+  // Take the transaction out of the queue first, so a callback may queue new requests.
+  AsyncTransaction transaction = std::move(_queue.front());
+  _queue.pop_front();
+
+  uint16_t registers[MODBUS_MAX_MERGED_REGISTERS] = { 0 };
+
+  if (errorcode == 0) {
+    for (uint8_t i = 0; i < transaction.count; ++i) {
+      registers[i] = (_recv_buf[3 + 2 * i] << 8) | _recv_buf[4 + 2 * i];
+    }
+  }
+
+  for (auto it = transaction.requests.begin(); it != transaction.requests.end(); ++it) {
+    if (it->callback) {
+      it->callback(errorcode, registers + it->offset, it->count);
+    }
+  }
+}
+
+void ModbusRTU_struct::waitTransactionDone() {
+  while (_transactionActive && isInitialized()) {
+    processQueue();
+    delay(0);
+  }
+}
+
 uint32_t ModbusRTU_struct::read_32b_InputRegister(short address) {
   uint32_t result = 0;
   uint8_t     errorcode;
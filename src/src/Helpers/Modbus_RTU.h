@@ -5,8 +5,14 @@
 #include <Arduino.h>
 #include <ESPeasySerial.h>
 
+#include <functional>
+#include <list>
+#include <vector>
+
 
 #define MODBUS_RECEIVE_BUFFER 256
+#define MODBUS_MAX_MERGED_REGISTERS    32 // Max. nr of registers in a single (merged) asynchronous read
+#define MODBUS_MAX_QUEUED_TRANSACTIONS 16
 #define MODBUS_BROADCAST_ADDRESS 0xFE
 
 #define MODBUS_READ_HOLDING_REGISTERS 0x03
@@ -42,6 +48,9 @@
 #define MODBUS_TIMEOUT  (MODBUS_EXCEPTION_GATEWAY_TARGET + 7)
 #define MODBUS_NODATA   (MODBUS_EXCEPTION_GATEWAY_TARGET + 8)
 
+// Called when an asynchronous register read is finished.
+// On success (errorcode = 0) 'registers' holds the 'count' requested register values.
+typedef std::function<void(uint8_t errorcode, const uint16_t *registers, uint8_t count)> ModbusRTU_callback_t;
 
 struct ModbusRTU_struct  {
   ModbusRTU_struct();
@@ -194,14 +203,62 @@ struct ModbusRTU_struct  {
 
   uint32_t            getFailedReadsSinceLastValid() const;
 
+  // Asynchronous register reads (function 3 or 4).
+  // The request is queued and sent by processQueue(), which does not wait for the reply.
+  // Requests for adjacent or overlapping registers of the same slave and function code
+  // are merged into a single request, as long as it has not been sent yet.
+  // The callback is called from processQueue() when the reply has been received.
+  // Returns false when the request could not be queued.
+  bool queueReadRegisters(uint8_t              functionCode,
+                          uint16_t             address,
+                          uint8_t              count,
+                          ModbusRTU_callback_t callback);
+
+  bool queueReadRegisters(uint8_t              slaveAddress,
+                          uint8_t              functionCode,
+                          uint16_t             address,
+                          uint8_t              count,
+                          ModbusRTU_callback_t callback);
+
+  // Send the next queued request, or check for the reply of the request sent before.
+  // Must be called frequently, e.g. from PLUGIN_FIFTY_PER_SECOND.
+  void processQueue();
+
+  bool queueEmpty() const {
+    return _queue.empty();
+  }
+
   String detected_device_description;
 
 private:
 
+  struct AsyncRequest {
+    uint16_t             offset = 0; // Offset in the registers read by the transaction
+    uint8_t              count  = 0;
+    ModbusRTU_callback_t callback;
+  };
+
+  struct AsyncTransaction {
+    uint16_t                  startAddress = 0;
+    uint8_t                   slaveAddress = 0;
+    uint8_t                   functionCode = 0;
+    uint8_t                   count        = 0;
+    uint8_t                   retriesLeft  = 1;
+    std::vector<AsyncRequest> requests;
+  };
+
   void startWrite();
 
   void startRead();
 
+  // Retry a command when it failed due to bad communication.
+  static bool mustRetry(uint8_t errorcode);
+
+  void finishTransaction(uint8_t errorcode);
+
+  // Synchronous commands share the send and receive buffers with the queued requests.
+  void waitTransactionDone();
+
   uint8_t     _sendframe[12]                   = { 0 };
   uint8_t     _sendframe_used                  = 0;
   uint8_t     _recv_buf[MODBUS_RECEIVE_BUFFER] = { 0 };
@@ -214,6 +271,10 @@ private:
   uint16_t _modbus_timeout                  = 180;
   uint8_t  _last_error                      = 0;
 
+  std::list<AsyncTransaction> _queue;
+  unsigned long               _transactionTimeout = 0;
+  bool                        _transactionActive  = false;
+
   ESPeasySerial *easySerial = nullptr;
 };
 
@@ -8,6 +8,7 @@
 #include "../Globals/Settings.h"
 #include "../Globals/Services.h"
 
+#include "../Helpers/ControllerWorker.h"
 #include "../Helpers/ESPEasy_time_calc.h"
 #include "../Helpers/Hardware.h"
 #include "../Helpers/Misc.h"
@@ -17,6 +18,14 @@
  \*********************************************************************************************/
 void statusLED(bool traffic)
 {
+  #ifdef USES_CONTROLLER_WORKER
+  if (ControllerWorker_inWorker()) {
+    // The LED state is not thread safe, let the loop task update it.
+    ControllerWorker_runOnLoop([traffic]() { statusLED(traffic); });
+    return;
+  }
+  #endif // ifdef USES_CONTROLLER_WORKER
+
   static int gnStatusValueCurrent = -1;
   static long int gnLastUpdate    = millis();
 
@@ -2,6 +2,7 @@
 
 #include "../../ESPEasy_common.h"
 #include "../Commands/InternalCommands.h"
+#include "../DataStructs/C013_p2p_dataStructs.h"
 #include "../DataStructs/TimingStats.h"
 #include "../DataTypes/EventValueSource.h"
 #include "../ESPEasyCore/ESPEasy_Log.h"
@@ -17,6 +18,7 @@
 #include "../Helpers/Misc.h"
 #include "../Helpers/Network.h"
 #include "../Helpers/Numerical.h"
+#include "../Helpers/SamplingProfiler.h"
 #include "../Helpers/StringConverter.h"
 #include "../Helpers/StringProvider.h"
 
@@ -181,6 +183,7 @@ void checkUDP()
   if (runningUPDCheck) {
     return;
   }
+  PROFILER_SCOPE(UDP, 0);
 
   runningUPDCheck = true;
 
@@ -279,6 +282,9 @@ void checkUDP()
                     if ((len >= 43) && (it->second.build >= 20107)) {
                       it->second.webgui_portnumber = makeWord(packetBuffer[42], packetBuffer[41]);
                     }
+
+                    // Older builds send 0 here
+                    it->second.p2p_capabilities = (len >= 44) ? packetBuffer[43] : 0;
                   }
                 }
 
@@ -478,6 +484,8 @@ void sendSysInfoUDP(uint8_t repeats)
   // 2 uint8_t build
   // 25 char name
   // 1 uint8_t node type id
+  // 2 uint8_t webgui port
+  // 1 uint8_t p2p capabilities
 
   // send my info to the world...
 #ifndef BUILD_NO_DEBUG
@@ -510,6 +518,9 @@ void sendSysInfoUDP(uint8_t repeats)
     data[40] = NODE_TYPE_ID;
     data[41] =  lowByte(Settings.WebserverPort);
     data[42] = highByte(Settings.WebserverPort);
+#ifdef USES_C013
+    data[43] = C013_P2P_CAP_DELTA_DATA;
+#endif // ifdef USES_C013
     statusLED(true);
 
     IPAddress broadcastIP(255, 255, 255, 255);
@@ -545,6 +556,9 @@ void sendSysInfoUDP(uint8_t repeats)
     it->second.age      = 0;
     it->second.build    = Settings.Build;
     it->second.nodeType = NODE_TYPE_ID;
+#ifdef USES_C013
+    it->second.p2p_capabilities = C013_P2P_CAP_DELTA_DATA;
+#endif // ifdef USES_C013
   }
 }
 
@@ -613,6 +627,7 @@ void SSDP_schema(WiFiClient& client) {
  \*********************************************************************************************/
 
 UdpContext *_server;
+bool        _started = false;
 
 IPAddress _respondToAddr;
 uint16_t  _respondToPort;
@@ -696,6 +711,17 @@ bool SSDP_begin() {
   return true;
 }
 
+/********************************************************************************************\
+   Start SSDP on first use, as it needs the network to be connected
+ \*********************************************************************************************/
+void SSDP_loop() {
+  if (_started) {
+    SSDP_update();
+  } else if (NetworkConnected()) {
+    _started = SSDP_begin();
+  }
+}
+
 /********************************************************************************************\
    Send SSDP messages (notify & responses)
  \*********************************************************************************************/
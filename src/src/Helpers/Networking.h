@@ -98,6 +98,11 @@ extern unsigned long  _notify_time;
  \*********************************************************************************************/
 bool SSDP_begin();
 
+/********************************************************************************************\
+   Start SSDP when possible or else process SSDP messages
+ \*********************************************************************************************/
+void SSDP_loop();
+
 /********************************************************************************************\
    Send SSDP messages (notify & responses)
  \*********************************************************************************************/
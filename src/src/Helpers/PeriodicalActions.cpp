@@ -15,6 +15,7 @@
 #include "../ESPEasyCore/ESPEasyWifi.h"
 #include "../ESPEasyCore/ESPEasyRules.h"
 #include "../ESPEasyCore/Serial.h"
+#include "../Globals/Cache.h"
 #include "../Globals/ESPEasyWiFiEvent.h"
 #include "../Globals/ESPEasy_Scheduler.h"
 #include "../Globals/ESPEasy_time.h"
@@ -36,6 +37,7 @@
 #include "../Helpers/StringGenerator_System.h"
 #include "../Helpers/StringGenerator_WiFi.h"
 #include "../Helpers/StringProvider.h"
+#include "../WebServer/WebServer.h"
 
 #ifdef USES_C015
 #include "../../ESPEasy_fdwdecl.h"
@@ -62,6 +64,9 @@ void run50TimesPerSecond() {
     CPluginCall(CPlugin::Function::CPLUGIN_FIFTY_PER_SECOND, 0, dummy);
     STOP_TIMER(CPLUGIN_CALL_50PS);
   }
+  #ifdef USE_ASSET_PACK
+  Cache.assetPack.loop();
+  #endif // ifdef USE_ASSET_PACK
   processNextEvent();
 }
 
@@ -110,6 +115,11 @@ void runOncePerSecond()
 {
   START_TIMER;
   updateLogLevelCache();
+
+  if (!webserverRunning) {
+    // Not started in setup() to get to the first sensor reads sooner.
+    setWebserverRunning(true);
+  }
   dailyResetCounter++;
   if (dailyResetCounter > 86400) // 1 day elapsed... //86400
   {
@@ -225,6 +235,7 @@ void runEach30Seconds()
     addLogMove(LOG_LEVEL_INFO, log);
   }
   WiFi_AP_Candidates.purge_expired();
+  checkWiFiLeaseExpired();
   sendSysInfoUDP(1);
   refreshNodeList();
 
@@ -234,7 +245,7 @@ void runEach30Seconds()
   #if defined(ESP8266)
   #ifdef USES_SSDP
   if (Settings.UseSSDP)
-    SSDP_update();
+    SSDP_loop();
 
   #endif // USES_SSDP
   #endif
@@ -1,6 +1,7 @@
 #include "../Helpers/RulesHelper.h"
 
 #include "../ESPEasyCore/ESPEasy_Log.h"
+#include "../Globals/Cache.h"
 #include "../Globals/Settings.h"
 #include "../Helpers/ESPEasy_Storage.h"
 #include "../Helpers/StringProvider.h"
@@ -238,6 +239,41 @@ bool RulesHelperClass::addChar(char c, String& line,   bool& firstNonSpaceRead,
 }
 
 #ifdef CACHE_RULES_IN_MEMORY
+size_t RulesHelperClass::RulesLines::size() const
+{
+  # ifdef USE_ASSET_PACK
+
+  if (mapped != nullptr) {
+    return lineStart.size();
+  }
+  # endif // ifdef USE_ASSET_PACK
+  return lines.size();
+}
+
+String RulesHelperClass::getLine(const RulesLines& rulesLines, size_t index)
+{
+  # ifdef USE_ASSET_PACK
+
+  if (rulesLines.mapped != nullptr) {
+    String line;
+    bool   firstNonSpaceRead = false;
+    bool   commentFound      = false;
+
+    for (size_t i = rulesLines.lineStart[index]; i < rulesLines.mappedSize; ++i) {
+      if (addChar(rulesLines.mapped[i], line, firstNonSpaceRead, commentFound)) {
+        return line;
+      }
+    }
+
+    // Last line without line end
+    rules_strip_trailing_comments(line);
+    check_rules_line_user_errors(line);
+    return line;
+  }
+  # endif // ifdef USE_ASSET_PACK
+  return rulesLines.lines[index];
+}
+
 String RulesHelperClass::readLn(const String& filename,
                                 size_t      & pos,
                                 bool        & moreAvailable,
@@ -246,23 +282,66 @@ String RulesHelperClass::readLn(const String& filename,
   moreAvailable = false;
   auto it = _fileHandleMap.find(filename);
 
+  # ifdef USE_ASSET_PACK
+
+  if (it == _fileHandleMap.end()) {
+    const uint8_t *data = nullptr;
+    size_t size         = 0;
+
+    if (Cache.assetPack.find(filename, data, size)) {
+      // Only store where the non-empty lines start, the file content remains in flash.
+      RulesLines rulesLines;
+      rulesLines.mapped     = reinterpret_cast<const char *>(data);
+      rulesLines.mappedSize = size;
+
+      String tmpStr;
+      bool   firstNonSpaceRead = false;
+      bool   commentFound      = false;
+      size_t startCurrentLine  = 0;
+
+      for (size_t i = 0; i < size; ++i) {
+        if (addChar(rulesLines.mapped[i], tmpStr, firstNonSpaceRead, commentFound)) {
+          rulesLines.lineStart.push_back(startCurrentLine);
+          firstNonSpaceRead = false;
+          commentFound      = false;
+          tmpStr.clear();
+        }
+
+        if (rulesLines.mapped[i] == '\n') {
+          startCurrentLine = i + 1;
+        }
+      }
+
+      if (tmpStr.length() > 0) {
+        rulesLines.lineStart.push_back(startCurrentLine);
+      }
+
+      if (loglevelActiveFor(LOG_LEVEL_INFO)) {
+        String log = F("Rules : Mapped ");
+        log += rulesLines.lineStart.size();
+        log += F(" lines from ");
+        log += filename;
+        addLogMove(LOG_LEVEL_INFO, log);
+      }
+      _fileHandleMap.emplace(std::make_pair(filename, std::move(rulesLines)));
+      it = _fileHandleMap.find(filename);
+    }
+  }
+  # endif // ifdef USE_ASSET_PACK
+
   if (it == _fileHandleMap.end()) {
     // Read lines from the file
-    fs::File f = tryOpenFile(filename, "r+");
+    fs::File f = tryOpenFile(filename, "r");
 
     if (f) {
-      RulesLines lines;
+      RulesLines rulesLines;
       String     tmpStr;
       bool firstNonSpaceRead = false;
       bool commentFound      = false;
 
-      // Keep track of which line we're reading for the event cache.
-      size_t readPos = 0;
-
       while (f.available()) {
         if (addChar(char(f.read()), tmpStr, firstNonSpaceRead, commentFound)) {
-          lines.push_back(tmpStr);
-          ++readPos;
+          rulesLines.lines.push_back(tmpStr);
 
           firstNonSpaceRead = false;
           commentFound      = false;
@@ -273,30 +352,34 @@ String RulesHelperClass::readLn(const String& filename,
       if (tmpStr.length() > 0) {
         rules_strip_trailing_comments(tmpStr);
         check_rules_line_user_errors(tmpStr);
-        lines.push_back(tmpStr);
+        rulesLines.lines.push_back(tmpStr);
         tmpStr.clear();
       }
 
       if (loglevelActiveFor(LOG_LEVEL_INFO)) {
         String log = F("Rules : Read ");
-        log += lines.size();
+        log += rulesLines.lines.size();
         log += F(" lines from ");
         log += filename;
         addLogMove(LOG_LEVEL_INFO, log);
       }
-      _fileHandleMap.emplace(std::make_pair(filename, std::move(lines)));
+      _fileHandleMap.emplace(std::make_pair(filename, std::move(rulesLines)));
       it = _fileHandleMap.find(filename);
     }
   }
 
   if (it != _fileHandleMap.end()) {
-    while (pos < it->second.size()) {
+    const size_t nrLines = it->second.size();
+
+    while (pos < nrLines) {
       ++pos;
-      moreAvailable = pos < it->second.size();
+      moreAvailable = pos < nrLines;
+
+      String line = getLine(it->second, pos - 1);
 
       if (!searchNextOnBlock ||
-          it->second[pos - 1].substring(0, 3).equalsIgnoreCase(F("on "))) {
-        return it->second[pos - 1];
+          line.substring(0, 3).equalsIgnoreCase(F("on "))) {
+        return line;
       }
     }
   }
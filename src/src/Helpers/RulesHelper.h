@@ -4,6 +4,7 @@
 #include "../../ESPEasy_common.h"
 
 #include "../DataStructs/RulesEventCache.h"
+#include "../Helpers/AssetPack.h"
 
 #include <FS.h>
 #include <map>
@@ -67,8 +68,25 @@ private:
 #ifdef CACHE_RULES_IN_MEMORY
 
   // Cache the entire rules file contents in memory
-  typedef std::vector<String>         RulesLines;
+  struct RulesLines {
+    size_t size() const;
+
+    std::vector<String> lines;
+
+# ifdef USE_ASSET_PACK
+
+    // When the file is present in the asset pack, only keep the offset of
+    // each line in the mapped flash and parse the line when it is needed.
+    const char           *mapped     = nullptr;
+    size_t                mappedSize = 0;
+    std::vector<uint32_t> lineStart;
+# endif // ifdef USE_ASSET_PACK
+  };
+
   typedef std::map<String, RulesLines>FileHandleMap;
+
+  String getLine(const RulesLines& rulesLines,
+                 size_t            index);
 #else // ifdef CACHE_RULES_IN_MEMORY
 
   // Keep a handle to a file for low-memory systems
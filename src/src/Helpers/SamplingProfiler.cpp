@@ -0,0 +1,242 @@
+#include "../Helpers/SamplingProfiler.h"
+
+#ifdef USES_SAMPLING_PROFILER
+
+# include "../Globals/CPlugins.h"
+# include "../Helpers/Misc.h"
+# include "../Helpers/Scheduler.h"
+
+# include <new>
+
+
+SamplingProfiler samplingProfiler;
+
+# ifdef ESP32
+static void profiler_timer_callback(void *arg)
+{
+  samplingProfiler.sample();
+}
+
+# endif // ifdef ESP32
+
+SamplingProfiler::~SamplingProfiler()
+{
+  stop();
+}
+
+bool SamplingProfiler::start()
+{
+  if (isRunning()) {
+    return true;
+  }
+  ProfilerSample_t *buffer = new (std::nothrow) ProfilerSample_t[PROFILER_BUFFER_SIZE];
+
+  if (buffer == nullptr) {
+    return false;
+  }
+  _head   = 0;
+  _count  = 0;
+  _buffer = buffer;
+
+  # ifdef ESP32
+  esp_timer_create_args_t timer_args = {};
+
+  timer_args.callback        = &profiler_timer_callback;
+  timer_args.dispatch_method = ESP_TIMER_TASK;
+  timer_args.name            = "profiler";
+
+  if ((esp_timer_create(&timer_args, &_timer) != ESP_OK) ||
+      (esp_timer_start_periodic(_timer, PROFILER_SAMPLE_INTERVAL_USEC) != ESP_OK)) {
+    stop();
+    return false;
+  }
+  # else // ifdef ESP32
+  _lastSwitch = micros();
+  # endif // ifdef ESP32
+  return true;
+}
+
+void SamplingProfiler::stop()
+{
+  # ifdef ESP32
+
+  if (_timer != nullptr) {
+    esp_timer_stop(_timer);
+    esp_timer_delete(_timer);
+    _timer = nullptr;
+  }
+  # endif // ifdef ESP32
+
+  ProfilerSample_t *buffer = _buffer;
+
+  _buffer = nullptr;
+  delete[] buffer;
+}
+
+String SamplingProfiler::getTagName(uint16_t tag)
+{
+  const uint8_t id = getId(tag);
+
+  switch (getCategory(tag)) {
+    case ProfilerCategory_e::Loop:             return F("Loop");
+    case ProfilerCategory_e::Plugin:
+    {
+      String res = F("Task ");
+      res += id + 1;
+      const String taskName = getTaskDeviceName(id);
+
+      if (!taskName.isEmpty()) {
+        res += ' ';
+        res += taskName;
+      }
+      return res;
+    }
+    case ProfilerCategory_e::Controller:       return getCPluginNameFromProtocolIndex(id);
+    case ProfilerCategory_e::Rules:            return F("Rules");
+    case ProfilerCategory_e::WebServer:        return F("WebServer");
+    case ProfilerCategory_e::SerialConsole:    return F("Serial");
+    case ProfilerCategory_e::UDP:              return F("UDP");
+    case ProfilerCategory_e::IntervalTimer:
+      return ESPEasy_Scheduler::toString(static_cast<ESPEasy_Scheduler::IntervalTimer_e>(id));
+    case ProfilerCategory_e::SchedulerTimer:
+      return ESPEasy_Scheduler::toString(static_cast<ESPEasy_Scheduler::SchedulerTimerType_e>(id));
+    case ProfilerCategory_e::SystemEventQueue: return F("System event queue");
+    case ProfilerCategory_e::NetworkEvents:    return F("Network events");
+  }
+  return String(tag);
+}
+
+void SamplingProfiler::push(uint16_t tag)
+{
+  if (_depth < PROFILER_MAX_DEPTH) {
+    _stack[_depth] = tag;
+  }
+  ++_depth;
+  updatePath();
+}
+
+void SamplingProfiler::pop()
+{
+  if (_depth > 0) {
+    --_depth;
+  }
+  updatePath();
+}
+
+void SamplingProfiler::updatePath()
+{
+  # ifndef ESP32
+
+  if (isRunning()) {
+    // Account the time spent to the path we're leaving.
+    accountElapsed();
+  }
+  # endif // ifndef ESP32
+
+  uint32_t path = 0;
+
+  if (_depth > 0) {
+    const uint8_t leaf = (_depth < PROFILER_MAX_DEPTH) ? _depth - 1 : PROFILER_MAX_DEPTH - 1;
+    path = (static_cast<uint32_t>(_stack[0]) << 16) | _stack[leaf];
+  }
+
+  // Single 32-bit write, so the sampling timer never sees a half updated path.
+  _path = path;
+}
+
+# ifndef ESP32
+void SamplingProfiler::accountElapsed()
+{
+  const uint32_t now     = micros();
+  const uint32_t elapsed = now - _lastSwitch;
+
+  _lastSwitch = now;
+
+  // Round to nearest tick, so on average short sections are neither lost nor overcounted.
+  uint32_t ticks = (elapsed + (PROFILER_SAMPLE_INTERVAL_USEC / 2)) / PROFILER_SAMPLE_INTERVAL_USEC;
+
+  if (ticks == 0) {
+    return;
+  }
+
+  if (ticks > 0xFFFF) { ticks = 0xFFFF; }
+  addSample(_path, ticks);
+}
+
+# endif // ifndef ESP32
+
+void SamplingProfiler::sample()
+{
+  addSample(_path, 1);
+}
+
+void SamplingProfiler::addSample(uint32_t path, uint16_t ticks)
+{
+  ProfilerSample_t *buffer = _buffer;
+
+  if (buffer == nullptr) {
+    return;
+  }
+  const uint16_t root = path >> 16;
+  const uint16_t leaf = path & 0xFFFF;
+  const uint16_t time = millis() / PROFILER_WINDOW_MSEC;
+
+  // Try to merge with a recent sample of the same path in the same time window.
+  uint16_t index     = _head;
+  const uint16_t max = (_count < PROFILER_MERGE_LOOKBACK) ? _count : PROFILER_MERGE_LOOKBACK;
+
+  for (uint16_t i = 0; i < max; ++i) {
+    index = (index == 0) ? PROFILER_BUFFER_SIZE - 1 : index - 1;
+    ProfilerSample_t& s = buffer[index];
+
+    if (s.time != time) {
+      break;
+    }
+
+    if ((s.root == root) && (s.leaf == leaf)) {
+      const uint32_t sum = static_cast<uint32_t>(s.ticks) + ticks;
+      s.ticks = (sum > 0xFFFF) ? 0xFFFF : sum;
+      return;
+    }
+  }
+
+  ProfilerSample_t& s = buffer[_head];
+
+  s.root  = root;
+  s.leaf  = leaf;
+  s.ticks = ticks;
+  s.time  = time;
+  _head   = (_head + 1) % PROFILER_BUFFER_SIZE;
+
+  if (_count < PROFILER_BUFFER_SIZE) {
+    ++_count;
+  }
+}
+
+uint32_t SamplingProfiler::collect(uint32_t maxAge_msec, std::map<uint32_t, uint32_t>& ticksPerPath) const
+{
+  const ProfilerSample_t *buffer = _buffer;
+
+  if (buffer == nullptr) {
+    return 0;
+  }
+  const uint16_t now   = millis() / PROFILER_WINDOW_MSEC;
+  uint16_t index       = _head;
+  const uint16_t count = _count;
+  uint32_t total       = 0;
+
+  for (uint16_t i = 0; i < count; ++i) {
+    index = (index == 0) ? PROFILER_BUFFER_SIZE - 1 : index - 1;
+    const ProfilerSample_t& s = buffer[index];
+    const uint16_t age        = now - s.time;
+
+    if ((static_cast<uint32_t>(age) * PROFILER_WINDOW_MSEC) > maxAge_msec) {
+      break;
+    }
+    ticksPerPath[(static_cast<uint32_t>(s.root) << 16) | s.leaf] += s.ticks;
+    total += s.ticks;
+  }
+  return total;
+}
+
+#endif // ifdef USES_SAMPLING_PROFILER
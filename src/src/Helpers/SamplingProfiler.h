@@ -0,0 +1,154 @@
+#ifndef HELPERS_SAMPLINGPROFILER_H
+#define HELPERS_SAMPLINGPROFILER_H
+
+#include "../../ESPEasy_common.h"
+
+#ifdef USES_SAMPLING_PROFILER
+
+# include <map>
+
+# ifdef ESP32
+#  include <esp_timer.h>
+# endif // ifdef ESP32
+
+// Lightweight profiler to see where the CPU time of the last N seconds went.
+//
+// Code sections set an "activity tag" using PROFILER_SCOPE(category, id).
+// Tags are kept on a small stack, the outermost (root) and innermost (leaf) tag
+// form the path which is sampled.
+// - ESP32:   A periodic esp_timer samples the current path every PROFILER_SAMPLE_INTERVAL_USEC.
+//            No hardware timer is claimed, as those are used by libraries (e.g. IRremoteESP8266 uses timer 3).
+// - ESP8266: Timer1 is often used by plugins, so instead the time spent is accounted
+//            on every tag change, in ticks of PROFILER_SAMPLE_INTERVAL_USEC.
+//
+// Samples are stored in a ring buffer, which is only allocated while the profiler is running.
+// Samples of the same path within the same 100 msec window are merged.
+
+# ifdef ESP32
+#  define PROFILER_SAMPLE_INTERVAL_USEC  1000
+#  define PROFILER_BUFFER_SIZE           2048
+# else // ifdef ESP32
+#  define PROFILER_SAMPLE_INTERVAL_USEC  100
+#  define PROFILER_BUFFER_SIZE           512
+# endif // ifdef ESP32
+
+# define PROFILER_MAX_DEPTH              8
+# define PROFILER_WINDOW_MSEC            100 // Resolution of the sample timestamp
+# define PROFILER_MERGE_LOOKBACK         16  // Nr of samples to check for merging with the same path
+
+
+enum class ProfilerCategory_e : uint8_t {
+  Loop = 0,          // Main loop, not in any tagged section
+  Plugin,            // id = taskIndex
+  Controller,        // id = protocolIndex
+  Rules,
+  WebServer,
+  SerialConsole,
+  UDP,               // ESPEasy p2p and other UDP traffic
+  IntervalTimer,     // id = ESPEasy_Scheduler::IntervalTimer_e
+  SchedulerTimer,    // id = ESPEasy_Scheduler::SchedulerTimerType_e
+  SystemEventQueue,
+  NetworkEvents
+};
+
+struct ProfilerSample_t {
+  uint16_t root  = 0;
+  uint16_t leaf  = 0;
+  uint16_t ticks = 0;
+  uint16_t time  = 0; // millis() / PROFILER_WINDOW_MSEC
+};
+
+
+class SamplingProfiler {
+public:
+
+  SamplingProfiler() = default;
+
+  ~SamplingProfiler();
+
+  bool start();
+
+  void stop();
+
+  bool isRunning() const {
+    return _buffer != nullptr;
+  }
+
+  static uint16_t makeTag(ProfilerCategory_e category,
+                          uint8_t            id) {
+    return (static_cast<uint16_t>(category) << 8) | id;
+  }
+
+  static ProfilerCategory_e getCategory(uint16_t tag) {
+    return static_cast<ProfilerCategory_e>(tag >> 8);
+  }
+
+  static uint8_t getId(uint16_t tag) {
+    return tag & 0xFF;
+  }
+
+  static String getTagName(uint16_t tag);
+
+  void push(uint16_t tag);
+
+  void pop();
+
+  // Collect the number of ticks per path (root << 16 | leaf) of the last maxAge_msec.
+  // Returns the total number of ticks.
+  uint32_t collect(uint32_t                      maxAge_msec,
+                   std::map<uint32_t, uint32_t>& ticksPerPath) const;
+
+  // Called from the esp_timer task on ESP32.
+  void sample();
+
+private:
+
+  void updatePath();
+
+  void addSample(uint32_t path,
+                 uint16_t ticks);
+
+  # ifndef ESP32
+  void accountElapsed();
+  # endif // ifndef ESP32
+
+  ProfilerSample_t *_buffer = nullptr;
+  volatile uint32_t _path   = 0;
+  volatile uint16_t _head   = 0;
+  volatile uint16_t _count  = 0;
+  uint16_t          _stack[PROFILER_MAX_DEPTH] = { 0 };
+  uint8_t           _depth = 0;
+
+  # ifdef ESP32
+  esp_timer_handle_t _timer = nullptr;
+  # else // ifdef ESP32
+  uint32_t _lastSwitch = 0;
+  # endif // ifdef ESP32
+};
+
+extern SamplingProfiler samplingProfiler;
+
+
+// Set an activity tag for the duration of the current scope.
+class ProfilerScope {
+public:
+
+  ProfilerScope(ProfilerCategory_e category,
+                uint8_t            id = 0) {
+    samplingProfiler.push(SamplingProfiler::makeTag(category, id));
+  }
+
+  ~ProfilerScope() {
+    samplingProfiler.pop();
+  }
+};
+
+# define PROFILER_SCOPE(C, I)  ProfilerScope profilerScope_(ProfilerCategory_e::C, I);
+
+#else // ifdef USES_SAMPLING_PROFILER
+
+# define PROFILER_SCOPE(C, I)
+
+#endif // ifdef USES_SAMPLING_PROFILER
+
+#endif // ifndef HELPERS_SAMPLINGPROFILER_H
@@ -10,13 +10,17 @@
 #include "../ESPEasyCore/ESPEasyGPIO.h"
 #include "../ESPEasyCore/ESPEasyRules.h"
 #include "../Globals/GlobalMapPortStatus.h"
+#include "../Globals/Plugins.h"
 #include "../Globals/RTC.h"
 #include "../Globals/NPlugins.h"
+#include "../Helpers/ControllerWorker.h"
 #include "../Helpers/DeepSleep.h"
 #include "../Helpers/ESPEasyRTC.h"
+#include "../Helpers/I2C_async.h"
 #include "../Helpers/Networking.h"
 #include "../Helpers/PeriodicalActions.h"
 #include "../Helpers/PortStatus.h"
+#include "../Helpers/SamplingProfiler.h"
 
 
 #define TIMER_ID_SHIFT       28 // Must be decreased as soon as timers below reach 15
@@ -291,7 +295,7 @@ void ESPEasy_Scheduler::handle_schedule() {
       process_rules_timer(id, timer);
       break;
     case SchedulerTimerType_e::TaskDeviceTimer:
-      process_task_device_timer(id, timer);
+      process_task_device_timer_batch(id, timer);
       break;
     case SchedulerTimerType_e::GPIO_timer:
       process_gpio_timer(id);
@@ -402,6 +406,13 @@ void ESPEasy_Scheduler::setIntervalTimer(IntervalTimer_e id, unsigned long lastt
 }
 
 void ESPEasy_Scheduler::sendGratuitousARP_now() {
+  #ifdef USES_CONTROLLER_WORKER
+  if (ControllerWorker_inWorker()) {
+    // Failed connect on the worker task, the scheduler may only be used from the loop task.
+    ControllerWorker_runOnLoop([]() { Scheduler.sendGratuitousARP_now(); });
+    return;
+  }
+  #endif // ifdef USES_CONTROLLER_WORKER
   sendGratuitousARP();
 
   if (Settings.gratuitousARP()) {
@@ -411,6 +422,8 @@ void ESPEasy_Scheduler::sendGratuitousARP_now() {
 }
 
 void ESPEasy_Scheduler::process_interval_timer(IntervalTimer_e id, unsigned long lasttimer) {
+  PROFILER_SCOPE(IntervalTimer, static_cast<uint8_t>(id));
+
   // Set the interval timer now, it may be altered by the commands below.
   // This is the default next-run-time.
   setIntervalTimer(id, lasttimer);
@@ -628,6 +641,8 @@ void ESPEasy_Scheduler::setPluginTaskTimer(unsigned long msecFromNow, taskIndex_
 }
 
 void ESPEasy_Scheduler::process_plugin_task_timer(unsigned long id) {
+  PROFILER_SCOPE(SchedulerTimer, static_cast<uint8_t>(SchedulerTimerType_e::PLUGIN_TIMER_IN_e));
+
   #ifdef USE_SECOND_HEAP
   HeapSelectDram ephemeral;
   #endif
@@ -666,6 +681,11 @@ void ESPEasy_Scheduler::process_plugin_task_timer(unsigned long id) {
 
   if (validDeviceIndex(deviceIndex)) {
     if (validUserVarIndex(TempEvent.BaseVarIndex)) {
+      if (I2C_async_isTimer(TempEvent.TaskIndex, TempEvent.Par1)) {
+        // Read the result of a pending I2C transaction, so the plugin can handle it right away.
+        I2C_async_process(TempEvent.TaskIndex);
+      }
+
       // checkDeviceVTypeForTask(&TempEvent);
       String dummy;
       Plugin_ptr[deviceIndex](PLUGIN_TIMER_IN, &TempEvent, dummy);
@@ -708,6 +728,8 @@ bool ESPEasy_Scheduler::setRulesTimer(unsigned long msecFromNow, unsigned int ti
 }
 
 void ESPEasy_Scheduler::process_rules_timer(unsigned long id, unsigned long lasttimer) {
+  PROFILER_SCOPE(SchedulerTimer, static_cast<uint8_t>(SchedulerTimerType_e::RulesTimer));
+
   const unsigned long mixedTimerId = getMixedId(SchedulerTimerType_e::RulesTimer, id);
 
   auto it = systemTimers.find(mixedTimerId);
@@ -834,6 +856,8 @@ void ESPEasy_Scheduler::setPluginTimer(unsigned long msecFromNow, pluginID_t plu
 }
 
 void ESPEasy_Scheduler::process_plugin_timer(unsigned long id) {
+  PROFILER_SCOPE(SchedulerTimer, static_cast<uint8_t>(SchedulerTimerType_e::PLUGIN_ONLY_TIMER_IN_e));
+
   #ifdef USE_SECOND_HEAP
   HeapSelectDram ephemeral;
   #endif
@@ -917,6 +941,8 @@ void ESPEasy_Scheduler::setGPIOTimer(unsigned long msecFromNow, pluginID_t plugi
 }
 
 void ESPEasy_Scheduler::process_gpio_timer(unsigned long id) {
+  PROFILER_SCOPE(SchedulerTimer, static_cast<uint8_t>(SchedulerTimerType_e::GPIO_timer));
+
   uint8_t GPIOType      = static_cast<uint8_t>((id) & 0xFF);
   uint8_t pinNumber     = static_cast<uint8_t>((id >> 8) & 0xFF);
   uint8_t pinStateValue = static_cast<uint8_t>((id >> 16) & 0xFF);
@@ -1036,12 +1062,68 @@ void ESPEasy_Scheduler::reschedule_task_device_timer(unsigned long task_index, u
 
 void ESPEasy_Scheduler::process_task_device_timer(unsigned long task_index, unsigned long lasttimer) {
   if (!validTaskIndex(task_index)) { return; }
+  PROFILER_SCOPE(SchedulerTimer, static_cast<uint8_t>(SchedulerTimerType_e::TaskDeviceTimer));
   reschedule_task_device_timer(task_index, lasttimer);
   START_TIMER;
   SensorSendTask(task_index);
   STOP_TIMER(SENSOR_SEND_TASK);
 }
 
+/*********************************************************************************************\
+* Task Device Timer batch
+* Task device timers which are due in the same scheduler tick are run together,
+* ordered by the I2C multiplexer channel and clock speed they need.
+* Tasks sharing a channel and speed then run back to back, without switching the bus in between.
+\*********************************************************************************************/
+#define TASK_DEVICE_TIMER_MAX_BATCH  TASKS_MAX
+
+struct TaskDeviceTimerBatchItem {
+  unsigned long task_index;
+  unsigned long timer;
+  uint16_t      i2c_key;
+
+  bool operator<(const TaskDeviceTimerBatchItem& other) const {
+    return i2c_key < other.i2c_key;
+  }
+};
+
+static bool isTaskDeviceTimerId(unsigned long mixed_id) {
+  ESPEasy_Scheduler::SchedulerTimerType_e timerType = ESPEasy_Scheduler::SchedulerTimerType_e::SystemEventQueue;
+
+  ESPEasy_Scheduler::decodeSchedulerId(mixed_id, timerType);
+  return timerType == ESPEasy_Scheduler::SchedulerTimerType_e::TaskDeviceTimer;
+}
+
+void ESPEasy_Scheduler::process_task_device_timer_batch(unsigned long task_index, unsigned long lasttimer) {
+  std::vector<timer_id_couple> due;
+
+  msecTimerHandler.extractDue(isTaskDeviceTimerId, due, TASK_DEVICE_TIMER_MAX_BATCH - 1);
+
+  if (due.empty()) {
+    process_task_device_timer(task_index, lasttimer);
+    return;
+  }
+
+  std::vector<TaskDeviceTimerBatchItem> batch;
+  batch.reserve(due.size() + 1);
+  batch.push_back({ task_index, lasttimer, get_I2C_bus_key_by_taskIndex(task_index) });
+
+  for (auto it = due.begin(); it != due.end(); ++it) {
+    SchedulerTimerType_e timerType = SchedulerTimerType_e::TaskDeviceTimer;
+    const unsigned long  id        = decodeSchedulerId(it->_id, timerType);
+    batch.push_back({ id, it->_timer, get_I2C_bus_key_by_taskIndex(id) });
+  }
+
+  // Stable sort, so tasks with the same bus state keep the order in which they became due.
+  std::stable_sort(batch.begin(), batch.end());
+
+  I2C_BatchScope i2c_batch;
+
+  for (auto it = batch.begin(); it != batch.end(); ++it) {
+    process_task_device_timer(it->task_index, it->timer);
+  }
+}
+
 /*********************************************************************************************\
 * System Event Timer
 * Handling of these events will be asynchronous and being called from the loop().
@@ -1139,6 +1221,8 @@ void ESPEasy_Scheduler::schedule_event_timer(PluginPtrType ptr_type, uint8_t Ind
 }
 
 void ESPEasy_Scheduler::process_system_event_queue() {
+  PROFILER_SCOPE(SystemEventQueue, 0);
+
   #ifdef USE_SECOND_HEAP
   HeapSelectDram ephemeral;
   #endif
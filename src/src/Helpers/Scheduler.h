@@ -240,6 +240,10 @@ public:
   void process_task_device_timer(unsigned long task_index,
                                  unsigned long lasttimer);
 
+  // Process all task device timers due right now, grouped by the I2C bus state they need.
+  void process_task_device_timer_batch(unsigned long task_index,
+                                       unsigned long lasttimer);
+
   /*********************************************************************************************\
   * System Event Timer
   * Handling of these events will be asynchronous and being called from the loop().
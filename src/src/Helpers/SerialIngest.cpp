@@ -0,0 +1,561 @@
+#include "../Helpers/SerialIngest.h"
+
+#include <Arduino.h>
+
+#include <ctype.h>
+#include <new>
+#include <string.h>
+
+
+String SerialIngest_frame_t::toString() const {
+  String result;
+
+  if (result.reserve(length)) {
+    for (uint16_t i = 0; i < length; ++i) {
+      result += data[i];
+    }
+  }
+  return result;
+}
+
+bool SerialIngest_frame_t::isPrintableASCII() const {
+  for (uint16_t i = 0; i < length; ++i) {
+    const uint8_t ch = static_cast<uint8_t>(data[i]);
+
+    if ((ch < 32) || (ch > 127)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool SerialIngest_frame_t::isUBX() const {
+  return (length >= 8) && (static_cast<uint8_t>(data[0]) == 0xB5) && (static_cast<uint8_t>(data[1]) == 0x62);
+}
+
+SerialIngest::SerialIngest(const SerialIngest_config_t& config, uint16_t bufferSize) : _config(config) {
+  _buffer = new (std::nothrow) uint8_t[bufferSize];
+
+  if (_buffer != nullptr) {
+    _bufferSize = bufferSize;
+  }
+}
+
+SerialIngest::~SerialIngest() {
+  delete[] _buffer;
+}
+
+void SerialIngest::setConfig(const SerialIngest_config_t& config) {
+  _config = config;
+  clear();
+}
+
+size_t SerialIngest::fill(Stream& stream) {
+  if (!isValid()) { return 0; }
+  size_t total     = 0;
+  int    available = stream.available();
+
+  while (available > 0) {
+    if (_end == _bufferSize) {
+      compact();
+
+      if (_end == _bufferSize) {
+        // Buffer full, the rest remains in the serial port buffer until frames have been taken out.
+        break;
+      }
+    }
+    size_t count = _bufferSize - _end;
+
+    if (count > static_cast<size_t>(available)) {
+      count = available;
+    }
+    const size_t bytesRead = stream.readBytes(reinterpret_cast<char *>(_buffer + _end), count);
+
+    if (bytesRead == 0) {
+      break;
+    }
+    _end     += bytesRead;
+    total    += bytesRead;
+    available = stream.available();
+  }
+
+  if (total > 0) {
+    _lastReceived = millis();
+  }
+  return total;
+}
+
+size_t SerialIngest::feed(const uint8_t *data, size_t length, unsigned long now) {
+  if (!isValid()) { return 0; }
+
+  if ((_end + length) > _bufferSize) {
+    compact();
+  }
+  size_t accepted = _bufferSize - _end;
+
+  if (accepted > length) {
+    accepted = length;
+  }
+
+  if (accepted > 0) {
+    memcpy(_buffer + _end, data, accepted);
+    _end         += accepted;
+    _lastReceived = now;
+  }
+  return accepted;
+}
+
+bool SerialIngest::nextFrame(SerialIngest_frame_t& frame) {
+  return nextFrame(frame, millis());
+}
+
+bool SerialIngest::nextFrame(SerialIngest_frame_t& frame, unsigned long now) {
+  if (!isValid()) { return false; }
+
+  switch (_config.framing) {
+    case SerialIngest_framing_e::Line:           return scanLine(frame);
+    case SerialIngest_framing_e::StartStop:      return scanStartStop(frame);
+    case SerialIngest_framing_e::LengthPrefixed: return scanLengthPrefixed(frame);
+    case SerialIngest_framing_e::P1Telegram:     return scanP1Telegram(frame);
+    case SerialIngest_framing_e::NMEA_UBX:       return scanNMEA_UBX(frame);
+    case SerialIngest_framing_e::Idle:
+    {
+      const size_t length    = _end - _frameStart;
+      const size_t maxLength = maxFrameLength();
+
+      if (length == 0) { return false; }
+
+      if ((length < maxLength) && ((now - _lastReceived) < _config.idleTimeout_ms)) {
+        // Still receiving
+        return false;
+      }
+      const size_t start = _frameStart;
+      const bool   truncated = length >= maxLength;
+      _frameStart = start + (truncated ? maxLength : length);
+      _scan       = _frameStart;
+      setFrame(frame, start, _frameStart - start, truncated);
+      return true;
+    }
+  }
+  return false;
+}
+
+void SerialIngest::clear() {
+  _frameStart   = 0;
+  _scan         = 0;
+  _end          = 0;
+  _payloadStart = 0;
+  _expected     = 0;
+  _state        = State::Waiting;
+}
+
+bool SerialIngest::validP1char(char ch) {
+  if (isalnum(static_cast<unsigned char>(ch)))
+  {
+    return true;
+  }
+
+  switch (ch) {
+    case '.':
+    case ' ':
+    case '\\': // Single backslash, but escaped in C++
+    case '\r':
+    case '\n':
+    case '(':
+    case ')':
+    case '-':
+    case '*':
+    case ':':
+    case '_':
+      return true;
+  }
+  return false;
+}
+
+/*
+   CRC16
+      based on code written by Jan ten Hove
+     https://github.com/jantenhove/P1-Meter-ESP8266
+ */
+uint16_t SerialIngest::CRC16(const char *data, size_t length)
+{
+  unsigned int crc = 0;
+
+  for (size_t pos = 0; pos < length; ++pos)
+  {
+    crc ^= static_cast<uint8_t>(data[pos]); // XOR byte into least sig. byte of crc
+
+    for (int i = 8; i != 0; i--) {          // Loop over each bit
+      if ((crc & 0x0001) != 0) {            // If the LSB is set
+        crc >>= 1;                          // Shift right and XOR 0xA001
+        crc  ^= 0xA001;
+      }
+      else {                                // Else LSB is not set
+        crc >>= 1;                          // Just shift right
+      }
+    }
+  }
+
+  return crc;
+}
+
+void SerialIngest::compact() {
+  if (_frameStart == 0) { return; }
+  const size_t remaining = _end - _frameStart;
+
+  if (remaining > 0) {
+    memmove(_buffer, _buffer + _frameStart, remaining);
+  }
+  _scan        -= _frameStart;
+  _payloadStart = (_payloadStart > _frameStart) ? _payloadStart - _frameStart : 0;
+  _end          = remaining;
+  _frameStart   = 0;
+}
+
+size_t SerialIngest::maxFrameLength() const {
+  if ((_config.maxFrameLength == 0) || (_config.maxFrameLength > _bufferSize)) {
+    return _bufferSize;
+  }
+  return _config.maxFrameLength;
+}
+
+void SerialIngest::setFrame(SerialIngest_frame_t& frame, size_t start, size_t length, bool truncated) {
+  frame.data      = reinterpret_cast<const char *>(_buffer + start);
+  frame.length    = length;
+  frame.truncated = truncated;
+  _state          = State::Waiting;
+  ++_framesReceived;
+}
+
+void SerialIngest::dropFrame() {
+  ++_framesDropped;
+  _frameStart = _scan;
+  _state      = State::Waiting;
+}
+
+bool SerialIngest::scanLine(SerialIngest_frame_t& frame) {
+  const size_t maxLength = maxFrameLength();
+
+  while (_scan < _end) {
+    const uint8_t ch = _buffer[_scan];
+
+    if ((_scan == _frameStart) && (ch == _config.ignore)) {
+      ++_scan;
+      ++_frameStart;
+      continue;
+    }
+    ++_scan;
+
+    if (ch == _config.terminator) {
+      const size_t start  = _frameStart;
+      size_t       length = _scan - 1 - start;
+      _frameStart = _scan;
+
+      while ((length > 0) && (_buffer[start + length - 1] == _config.ignore)) {
+        --length;
+      }
+
+      if (length > 0) {
+        setFrame(frame, start, length, false);
+        return true;
+      }
+
+      // Skip empty lines
+      continue;
+    }
+
+    if ((_scan - _frameStart) >= maxLength) {
+      const size_t start = _frameStart;
+      _frameStart = _scan;
+      setFrame(frame, start, _scan - start, true);
+      return true;
+    }
+  }
+  return false;
+}
+
+bool SerialIngest::scanStartStop(SerialIngest_frame_t& frame) {
+  const size_t maxLength = maxFrameLength();
+
+  while (_scan < _end) {
+    const uint8_t ch = _buffer[_scan];
+    ++_scan;
+
+    if (_state == State::Waiting) {
+      if ((_config.start < 0) || (ch == _config.start)) {
+        _frameStart = _scan - 1;
+        _state      = State::Reading;
+      } else {
+        // Not part of a frame, discard
+        _frameStart = _scan;
+        continue;
+      }
+    }
+
+    if ((ch == _config.stop) && ((_scan - 1) != _frameStart)) {
+      const size_t start = _frameStart;
+      _frameStart = _scan;
+      setFrame(frame, start, _scan - start, false);
+      return true;
+    }
+
+    if ((_scan - _frameStart) >= maxLength) {
+      dropFrame();
+    }
+  }
+  return false;
+}
+
+bool SerialIngest::scanLengthPrefixed(SerialIngest_frame_t& frame) {
+  for (;;) {
+    if (_state == State::Reading) {
+      if ((_end - _payloadStart) < _expected) {
+        _scan = _end;
+        return false;
+      }
+      _scan       = _payloadStart + _expected;
+      _frameStart = _scan;
+      setFrame(frame, _payloadStart, _expected, false);
+      return true;
+    }
+
+    if (_scan >= _end) {
+      return false;
+    }
+    const uint8_t ch = _buffer[_scan];
+    ++_scan;
+
+    if ((_state == State::Waiting) && (_config.start >= 0)) {
+      if (ch == _config.start) {
+        _state = State::Length;
+      } else {
+        _frameStart = _scan;
+      }
+      continue;
+    }
+
+    // Length byte
+    _expected = ch;
+
+    if ((_expected > maxFrameLength()) || ((_scan - _frameStart + _expected) > _bufferSize)) {
+      dropFrame();
+      continue;
+    }
+    _payloadStart = _scan;
+    _state        = State::Reading;
+  }
+}
+
+bool SerialIngest::scanP1Telegram(SerialIngest_frame_t& frame) {
+  const size_t maxLength = maxFrameLength();
+
+  while (_scan < _end) {
+    const char ch = static_cast<char>(_buffer[_scan]);
+    ++_scan;
+    bool done = false;
+
+    switch (_state) {
+      case State::Waiting:
+
+        if (ch == '/') {
+          _frameStart = _scan - 1;
+          _state      = State::Reading;
+        } else {
+          // Not part of a telegram, discard
+          _frameStart = _scan;
+        }
+        break;
+      case State::Reading:
+
+        if (ch == '!') {
+          if (_config.checkCRC) {
+            _payloadStart = _scan; // Start of the checksum
+            _state        = State::Checksum;
+          } else {
+            done = true;
+          }
+        } else if (ch == '/') {
+          // Start of a new telegram, discard the incomplete one.
+          ++_framesDropped;
+          _frameStart = _scan - 1;
+        } else if (!validP1char(ch)) {
+          dropFrame();
+        }
+        break;
+      case State::Checksum:
+
+        if (!isxdigit(static_cast<unsigned char>(ch))) {
+          dropFrame();
+        } else if ((_scan - _payloadStart) == 4) {
+          if (checkP1Telegram(_payloadStart)) {
+            done = true;
+          } else {
+            dropFrame();
+          }
+        }
+        break;
+      case State::Length:
+        dropFrame();
+        break;
+    }
+
+    if (done) {
+      const size_t start = _frameStart;
+      _frameStart = _scan;
+      setFrame(frame, start, _scan - start, false);
+      return true;
+    }
+
+    if ((_state != State::Waiting) && ((_scan - _frameStart) >= maxLength)) {
+      dropFrame();
+    }
+  }
+  return false;
+}
+
+bool SerialIngest::checkP1Telegram(size_t checksumStart) const {
+  const uint16_t crc = CRC16(reinterpret_cast<const char *>(_buffer + _frameStart), checksumStart - _frameStart);
+  uint16_t value     = 0;
+
+  for (size_t i = 0; i < 4; ++i) {
+    const char ch = static_cast<char>(_buffer[checksumStart + i]);
+    value <<= 4;
+
+    if (ch <= '9') {
+      value |= ch - '0';
+    } else {
+      value |= (ch | 0x20) - 'a' + 10;
+    }
+  }
+  return value == crc;
+}
+
+// Mixed stream of NMEA sentences and UBX binary frames.
+// State::Reading  = NMEA sentence
+// State::Length   = UBX header
+// State::Checksum = UBX payload and checksum
+bool SerialIngest::scanNMEA_UBX(SerialIngest_frame_t& frame) {
+  const size_t maxLength = maxFrameLength();
+
+  while (_scan < _end) {
+    switch (_state) {
+      case State::Waiting:
+      {
+        const uint8_t ch = _buffer[_scan];
+        ++_scan;
+
+        if (ch == '$') {
+          _frameStart = _scan - 1;
+          _state      = State::Reading;
+        } else if (ch == 0xB5) {
+          _frameStart = _scan - 1;
+          _state      = State::Length;
+        } else {
+          // Not part of a frame (e.g. LF after CR), discard
+          _frameStart = _scan;
+        }
+        break;
+      }
+      case State::Reading:
+      {
+        const uint8_t ch = _buffer[_scan];
+        ++_scan;
+
+        if ((ch == '\r') || (ch == '\n')) {
+          const size_t length = _scan - 1 - _frameStart;
+
+          if (checkNMEASentence(_frameStart, length)) {
+            const size_t start = _frameStart;
+            _frameStart = _scan;
+            setFrame(frame, start, length, false);
+            return true;
+          }
+          dropFrame();
+        } else if ((ch < 32) || (ch > 126) || ((_scan - _frameStart) >= maxLength)) {
+          dropFrame();
+        }
+        break;
+      }
+      case State::Length:
+      {
+        // 0xB5 0x62 class id length (2 bytes, little endian)
+        if ((_end - _frameStart) < 6) {
+          _scan = _end;
+          return false;
+        }
+        const size_t frameLength = 8 + (_buffer[_frameStart + 4] | (_buffer[_frameStart + 5] << 8));
+
+        if ((_buffer[_frameStart + 1] != 0x62) || (frameLength > maxLength)) {
+          // Continue scanning right after the sync char, it may have been part of a NMEA sentence.
+          _scan = _frameStart + 1;
+          dropFrame();
+          break;
+        }
+        _expected = frameLength;
+        _state    = State::Checksum;
+        break;
+      }
+      case State::Checksum:
+      {
+        if ((_end - _frameStart) < _expected) {
+          _scan = _end;
+          return false;
+        }
+
+        if (checkUBXFrame(_frameStart, _expected)) {
+          const size_t start = _frameStart;
+          _scan       = start + _expected;
+          _frameStart = _scan;
+          setFrame(frame, start, _expected, false);
+          return true;
+        }
+        _scan = _frameStart + 1;
+        dropFrame();
+        break;
+      }
+    }
+  }
+  return false;
+}
+
+bool SerialIngest::checkNMEASentence(size_t start, size_t length) const {
+  // Shortest sentence: "$GPxxx"
+  if (length < 6) {
+    return false;
+  }
+  const char *data = reinterpret_cast<const char *>(_buffer + start);
+
+  if ((length < 9) || (data[length - 3] != '*')) {
+    // No checksum present
+    return !_config.checkCRC;
+  }
+  uint8_t parity = 0;
+
+  for (size_t i = 1; i < (length - 3); ++i) {
+    parity ^= static_cast<uint8_t>(data[i]);
+  }
+  uint8_t value = 0;
+
+  for (size_t i = length - 2; i < length; ++i) {
+    const char ch = data[i];
+
+    if (!isxdigit(static_cast<unsigned char>(ch))) {
+      return false;
+    }
+    value <<= 4;
+    value  |= (ch <= '9') ? (ch - '0') : ((ch | 0x20) - 'a' + 10);
+  }
+  return value == parity;
+}
+
+bool SerialIngest::checkUBXFrame(size_t start, size_t length) const {
+  // 8-bit Fletcher checksum over class, id, length and payload.
+  uint8_t CK_A = 0;
+  uint8_t CK_B = 0;
+
+  for (size_t i = start + 2; i < (start + length - 2); ++i) {
+    CK_A += _buffer[i];
+    CK_B += CK_A;
+  }
+  return (CK_A == _buffer[start + length - 2]) && (CK_B == _buffer[start + length - 1]);
+}
@@ -0,0 +1,170 @@
+#ifndef HELPERS_SERIALINGEST_H
+#define HELPERS_SERIALINGEST_H
+
+#include "../../ESPEasy_common.h"
+
+// Shared serial receive buffer with message framing, for plugins reading messages from a serial port.
+//
+// Bytes are moved from the serial port into the buffer using bulk reads (fill()),
+// instead of reading and appending them to a String one character at a time.
+// Complete messages are handed out as a view into the buffer (nextFrame()), without copying.
+//
+// The buffer is linear, not a ring. When space is needed, the unprocessed part is moved
+// to the start of the buffer. This way a frame is always contiguous in memory.
+//
+// The framing does not depend on the serial port or millis(),
+// so captured serial data can be replayed using feed() and nextFrame(frame, now).
+
+#define SERIAL_INGEST_BUFFER_SIZE  1024
+
+class Stream;
+
+enum class SerialIngest_framing_e : uint8_t {
+  Line,           // Ends with 'terminator'. 'ignore' characters are stripped at the start and end of a frame.
+  StartStop,      // Starts with 'start' and ends with 'stop', both included in the frame.
+  LengthPrefixed, // Optional 'start' byte, followed by a length byte and the payload. Frame is the payload.
+  P1Telegram,     // DSMR P1 telegram: '/' ... '!' optionally followed by 4 hex chars of CRC16.
+  Idle,           // Ends when nothing was received for 'idleTimeout_ms'.
+  NMEA_UBX        // GNSS receiver: NMEA sentences '$' ... "*HH" (frame excludes CR/LF)
+                  // mixed with u-blox UBX binary frames (0xB5 0x62 ..., frame includes header and checksum).
+};
+
+struct SerialIngest_config_t {
+  SerialIngest_framing_e framing        = SerialIngest_framing_e::Line;
+  int16_t                terminator     = '\r';
+  int16_t                ignore         = '\n'; // -1 = not used
+  int16_t                start          = -1;   // -1 = not used
+  int16_t                stop           = -1;
+  uint16_t               maxFrameLength = 0;    // 0 = buffer size
+  uint16_t               idleTimeout_ms = 0;
+  bool                   checkCRC       = false; // P1Telegram: CRC required, NMEA_UBX: NMEA checksum required
+};
+
+// View of a frame in the buffer.
+// Only valid until the next call to fill(), feed() or clear() of the SerialIngest.
+struct SerialIngest_frame_t {
+  // Copy the frame into a String.
+  String toString() const;
+
+  // Returns true when all characters are printable ASCII (32 ... 127).
+  bool   isPrintableASCII() const;
+
+  // NMEA_UBX framing: Returns true when the frame is a UBX frame, otherwise it is a NMEA sentence.
+  bool   isUBX() const;
+
+  const char *data      = nullptr;
+  uint16_t    length    = 0;
+  bool        truncated = false; // Max frame length reached before the end of the frame was seen
+};
+
+
+class SerialIngest {
+public:
+
+  SerialIngest(const SerialIngest_config_t& config,
+               uint16_t                     bufferSize = SERIAL_INGEST_BUFFER_SIZE);
+
+  ~SerialIngest();
+
+  SerialIngest(const SerialIngest&)            = delete;
+  SerialIngest& operator=(const SerialIngest&) = delete;
+
+  bool isValid() const {
+    return _buffer != nullptr;
+  }
+
+  // Change the framing. Data which is not yet framed is discarded.
+  void setConfig(const SerialIngest_config_t& config);
+
+  // Read all available bytes from the stream, as long as there is room in the buffer.
+  // Returns the number of bytes read.
+  size_t fill(Stream& stream);
+
+  // Append received bytes to the buffer.
+  // Returns the number of bytes accepted, which is less than length when the buffer is full.
+  size_t feed(const uint8_t *data,
+              size_t         length,
+              unsigned long  now);
+
+  // Get the next complete frame, if any.
+  bool   nextFrame(SerialIngest_frame_t& frame,
+                   unsigned long         now);
+
+  bool   nextFrame(SerialIngest_frame_t& frame);
+
+  // Discard all buffered data.
+  void   clear();
+
+  // Nr of bytes which are not yet handed out as a frame.
+  size_t pending() const {
+    return _end - _frameStart;
+  }
+
+  uint32_t getFramesReceived() const {
+    return _framesReceived;
+  }
+
+  // Frames dropped due to invalid data, CRC mismatch or exceeding the max frame length.
+  uint32_t getFramesDropped() const {
+    return _framesDropped;
+  }
+
+  // Returns true when the P1 telegram character is valid as part of the datagram contents and/or checksum.
+  static bool validP1char(char ch);
+
+  static uint16_t CRC16(const char *data,
+                        size_t      length);
+
+private:
+
+  enum class State : uint8_t {
+    Waiting,
+    Length,
+    Reading,
+    Checksum
+  };
+
+  void   compact();
+
+  size_t maxFrameLength() const;
+
+  void   setFrame(SerialIngest_frame_t& frame,
+                  size_t                start,
+                  size_t                length,
+                  bool                  truncated);
+
+  void   dropFrame();
+
+  bool   scanLine(SerialIngest_frame_t& frame);
+
+  bool   scanStartStop(SerialIngest_frame_t& frame);
+
+  bool   scanLengthPrefixed(SerialIngest_frame_t& frame);
+
+  bool   scanP1Telegram(SerialIngest_frame_t& frame);
+
+  bool   checkP1Telegram(size_t checksumStart) const;
+
+  bool   scanNMEA_UBX(SerialIngest_frame_t& frame);
+
+  bool   checkNMEASentence(size_t start,
+                           size_t length) const;
+
+  bool   checkUBXFrame(size_t start,
+                       size_t length) const;
+
+  SerialIngest_config_t _config;
+  uint8_t              *_buffer         = nullptr;
+  uint16_t              _bufferSize     = 0;
+  size_t                _frameStart     = 0; // First byte not yet handed out
+  size_t                _scan           = 0; // Next byte to inspect
+  size_t                _end            = 0; // End of received data
+  size_t                _payloadStart   = 0;
+  uint16_t              _expected       = 0;
+  unsigned long         _lastReceived   = 0;
+  uint32_t              _framesReceived = 0;
+  uint32_t              _framesDropped  = 0;
+  State                 _state          = State::Waiting;
+};
+
+#endif // ifndef HELPERS_SERIALINGEST_H
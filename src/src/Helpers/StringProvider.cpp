@@ -22,6 +22,7 @@
 #include "../Globals/Settings.h"
 #include "../Globals/WiFi_AP_Candidates.h"
 
+#include "../Helpers/BootTimeline.h"
 #include "../Helpers/Convert.h"
 #include "../Helpers/ESPEasy_Storage.h"
 #include "../Helpers/Memory.h"
@@ -62,6 +63,7 @@ const __FlashStringHelper * getLabel(LabelType::Enum label) {
 #endif
     case LabelType::WIFI_NR_EXTRA_SCANS:    return F("Extra WiFi scan loops");
     case LabelType::WIFI_USE_LAST_CONN_FROM_RTC: return F("Use Last Connected AP from RTC");
+    case LabelType::WIFI_USE_LAST_LEASE_FROM_RTC: return F("Use Last DHCP Lease from RTC");
 
     case LabelType::FREE_MEM:               return F("Free RAM");
     case LabelType::FREE_STACK:             return F("Free Stack");
@@ -108,6 +110,10 @@ const __FlashStringHelper * getLabel(LabelType::Enum label) {
     case LabelType::RESET_REASON:           return F("Reset Reason");
     case LabelType::LAST_TASK_BEFORE_REBOOT: return F("Last Action before Reboot");
     case LabelType::SW_WD_COUNT:            return F("SW WD count");
+    case LabelType::BOOT_SETUP_DURATION:    return F("Boot Setup Duration");
+    case LabelType::BOOT_FIRST_READ:        return F("Boot To First Read");
+    case LabelType::PREV_BOOT_SETUP_DURATION: return F("Previous Boot Setup Duration");
+    case LabelType::PREV_BOOT_FIRST_READ:   return F("Previous Boot To First Read");
 
 
     case LabelType::WIFI_CONNECTION:        return F("WiFi Connection");
@@ -160,6 +166,10 @@ const __FlashStringHelper * getLabel(LabelType::Enum label) {
 
     case LabelType::I2C_BUS_STATE:          return F("I2C Bus State");
     case LabelType::I2C_BUS_CLEARED_COUNT:  return F("I2C bus cleared count");
+    case LabelType::I2C_MUX_SWITCHES:       return F("I2C mux switches");
+    case LabelType::I2C_MUX_SWITCHES_SKIPPED: return F("I2C mux switches skipped");
+    case LabelType::I2C_CLOCK_CHANGES:      return F("I2C clock changes");
+    case LabelType::I2C_CLOCK_CHANGES_SKIPPED: return F("I2C clock changes skipped");
 
     case LabelType::SYSLOG_LOG_LEVEL:       return F("Syslog Log Level");
     case LabelType::SERIAL_LOG_LEVEL:       return F("Serial Log Level");
@@ -253,6 +263,7 @@ String getValue(LabelType::Enum label) {
 #endif
     case LabelType::WIFI_NR_EXTRA_SCANS:    return String(Settings.NumberExtraWiFiScans);
     case LabelType::WIFI_USE_LAST_CONN_FROM_RTC: return jsonBool(Settings.UseLastWiFiFromRTC());
+    case LabelType::WIFI_USE_LAST_LEASE_FROM_RTC: return jsonBool(Settings.UseLastWiFiLeaseFromRTC());
 
     case LabelType::FREE_MEM:               return String(FreeMem());
     case LabelType::FREE_STACK:             return String(getCurrentFreeStack());
@@ -306,6 +317,10 @@ String getValue(LabelType::Enum label) {
     case LabelType::RESET_REASON:           return getResetReasonString();
     case LabelType::LAST_TASK_BEFORE_REBOOT: return ESPEasy_Scheduler::decodeSchedulerId(lastMixedSchedulerId_beforereboot);
     case LabelType::SW_WD_COUNT:            return String(sw_watchdog_callback_count);
+    case LabelType::BOOT_SETUP_DURATION:    return String(getBootSetupDuration_ms());
+    case LabelType::BOOT_FIRST_READ:        return String(getBootFirstSensorRead_ms());
+    case LabelType::PREV_BOOT_SETUP_DURATION: return String(getPrevBootSetupDuration_ms());
+    case LabelType::PREV_BOOT_FIRST_READ:   return String(getPrevBootFirstSensorRead_ms());
 
     case LabelType::WIFI_CONNECTION:        break;
     case LabelType::WIFI_RSSI:              return String(WiFi.RSSI());
@@ -378,6 +393,10 @@ String getValue(LabelType::Enum label) {
     case LabelType::GIT_HEAD:               return get_git_head();
     case LabelType::I2C_BUS_STATE:          return toString(I2C_state);
     case LabelType::I2C_BUS_CLEARED_COUNT:  return String(I2C_bus_cleared_count);
+    case LabelType::I2C_MUX_SWITCHES:       return String(I2C_mux_switch_count);
+    case LabelType::I2C_MUX_SWITCHES_SKIPPED: return String(I2C_mux_switch_skipped);
+    case LabelType::I2C_CLOCK_CHANGES:      return String(I2C_clock_change_count);
+    case LabelType::I2C_CLOCK_CHANGES_SKIPPED: return String(I2C_clock_change_skipped);
     case LabelType::SYSLOG_LOG_LEVEL:       return getLogLevelDisplayString(Settings.SyslogLevel);
     case LabelType::SERIAL_LOG_LEVEL:       return getLogLevelDisplayString(getSerialLogLevel());
     case LabelType::WEB_LOG_LEVEL:          return getLogLevelDisplayString(getWebLogLevel());
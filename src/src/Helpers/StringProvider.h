@@ -31,6 +31,7 @@ struct LabelType {
 #endif
     WIFI_NR_EXTRA_SCANS,    
     WIFI_USE_LAST_CONN_FROM_RTC,
+    WIFI_USE_LAST_LEASE_FROM_RTC,
 
     FREE_MEM,            // 9876
     FREE_STACK,          // 3456
@@ -76,6 +77,10 @@ struct LabelType {
     DEEP_SLEEP_ALTERNATIVE_CALL,
     LAST_TASK_BEFORE_REBOOT, // Last scheduled task.
     SW_WD_COUNT,
+    BOOT_SETUP_DURATION,       // msec spent in setup()
+    BOOT_FIRST_READ,           // msec since boot of the first sensor read
+    PREV_BOOT_SETUP_DURATION,  // Same values of the previous boot, kept in RTC
+    PREV_BOOT_FIRST_READ,
 
     WIFI_CONNECTION,         // 802.11G
     WIFI_RSSI,               // -67
@@ -127,6 +132,10 @@ struct LabelType {
 
     I2C_BUS_STATE,
     I2C_BUS_CLEARED_COUNT,
+    I2C_MUX_SWITCHES,
+    I2C_MUX_SWITCHES_SKIPPED,
+    I2C_CLOCK_CHANGES,
+    I2C_CLOCK_CHANGES_SKIPPED,
 
     SYSLOG_LOG_LEVEL,
     SERIAL_LOG_LEVEL,
@@ -0,0 +1,109 @@
+#include "../Helpers/TaskValueAggregation.h"
+
+#ifdef USES_TASK_VALUE_AGGREGATION
+
+# include "../DataStructs/ESPEasy_EventStruct.h"
+# include "../DataStructs/TaskValueAggregator.h"
+
+# include "../Globals/ExtraTaskSettings.h"
+# include "../Globals/Settings.h"
+# include "../Globals/RuntimeData.h"
+
+# include <new>
+
+// Only allocated for tasks with aggregation set.
+static TaskValueAggregator *TaskValueAggregators[TASKS_MAX] = {};
+
+void clearTaskValueAggregation(taskIndex_t taskIndex) {
+  if (validTaskIndex(taskIndex) && (TaskValueAggregators[taskIndex] != nullptr)) {
+    delete TaskValueAggregators[taskIndex];
+    TaskValueAggregators[taskIndex] = nullptr;
+  }
+}
+
+TaskValueAggregation::TaskValueAggregation(struct EventStruct *event) : _event(event)
+{
+  const taskIndex_t taskIndex = event->TaskIndex;
+
+  if (!validTaskIndex(taskIndex) || (ExtraTaskSettings.TaskIndex != taskIndex)) {
+    return;
+  }
+
+  if (!ExtraTaskSettings.valueAggregationSet()) {
+    clearTaskValueAggregation(taskIndex);
+    return;
+  }
+
+  // Only numerical values can be aggregated.
+  const Sensor_VType vtype = event->getSensorType();
+
+  if ((vtype == Sensor_VType::SENSOR_TYPE_LONG) ||
+      (vtype == Sensor_VType::SENSOR_TYPE_STRING)) {
+    return;
+  }
+
+  uint32_t windowTime_ms = ExtraTaskSettings.AggregateWindowTime * 1000ul;
+
+  if ((windowTime_ms == 0) && (ExtraTaskSettings.AggregateWindowCount == 0)) {
+    windowTime_ms = Settings.TaskDeviceTimer[taskIndex] * 1000ul;
+
+    if (windowTime_ms == 0) {
+      // No window set
+      return;
+    }
+  }
+
+  TaskValueAggregate_e aggregates[VARS_PER_TASK];
+
+  for (uint8_t i = 0; i < VARS_PER_TASK; ++i) {
+    aggregates[i] = static_cast<TaskValueAggregate_e>(ExtraTaskSettings.TaskDeviceValueAggregate[i]);
+  }
+
+  TaskValueAggregator *aggregator = TaskValueAggregators[taskIndex];
+
+  if (aggregator == nullptr) {
+    aggregator = new (std::nothrow) TaskValueAggregator();
+
+    if (aggregator == nullptr) {
+      return;
+    }
+    TaskValueAggregators[taskIndex] = aggregator;
+    aggregator->reset(aggregates, ExtraTaskSettings.AggregateWindowCount, windowTime_ms);
+  } else if (aggregator->configChanged(aggregates, ExtraTaskSettings.AggregateWindowCount, windowTime_ms)) {
+    aggregator->reset(aggregates, ExtraTaskSettings.AggregateWindowCount, windowTime_ms);
+  }
+
+  for (uint8_t i = 0; i < VARS_PER_TASK; ++i) {
+    _rawValues[i] = UserVar[event->BaseVarIndex + i];
+  }
+  _active         = true;
+  _rawRuleEvents  = ExtraTaskSettings.aggregateRawRuleEvents();
+  _windowComplete = aggregator->add(_rawValues);
+}
+
+TaskValueAggregation::~TaskValueAggregation() {
+  if (_replaced) {
+    for (uint8_t i = 0; i < VARS_PER_TASK; ++i) {
+      UserVar[_event->BaseVarIndex + i] = _rawValues[i];
+    }
+  }
+}
+
+void TaskValueAggregation::setAggregateValues() {
+  if (!_active || !_windowComplete) {
+    return;
+  }
+  TaskValueAggregator *aggregator = TaskValueAggregators[_event->TaskIndex];
+
+  if (aggregator == nullptr) {
+    return;
+  }
+
+  for (uint8_t i = 0; i < VARS_PER_TASK; ++i) {
+    UserVar[_event->BaseVarIndex + i] = aggregator->get(i);
+  }
+  aggregator->nextWindow();
+  _replaced = true;
+}
+
+#endif // ifdef USES_TASK_VALUE_AGGREGATION
@@ -0,0 +1,66 @@
+#ifndef HELPERS_TASKVALUEAGGREGATION_H
+#define HELPERS_TASKVALUEAGGREGATION_H
+
+#include "../../ESPEasy_common.h"
+
+#ifdef USES_TASK_VALUE_AGGREGATION
+
+# include "../CustomBuild/ESPEasyLimits.h"
+# include "../DataTypes/TaskIndex.h"
+
+struct EventStruct;
+
+/*********************************************************************************************\
+* Aggregation of task values between sendData() and the controllers.
+*
+* When any value of a task has an aggregate set, each call to sendData() adds a sample
+* to the window of the task. Only when the window is complete, the aggregates are sent
+* to the controllers. Values without aggregate set send their last value.
+*
+* The task values (UserVar) are only replaced by the aggregates while sending,
+* so plugins keeping state in their task values are not affected.
+\*********************************************************************************************/
+class TaskValueAggregation {
+public:
+
+  // Add the task values to the window of the task, when aggregation is set for the task.
+  // ExtraTaskSettings must be loaded for the task.
+  explicit TaskValueAggregation(struct EventStruct *event);
+
+  // Restores the task values, when replaced by the aggregates.
+  ~TaskValueAggregation();
+
+  TaskValueAggregation(const TaskValueAggregation&)            = delete;
+  TaskValueAggregation& operator=(const TaskValueAggregation&) = delete;
+
+  bool isActive() const {
+    return _active;
+  }
+
+  // Rules events should be generated for each sample, with the raw values.
+  bool rawRuleEvents() const {
+    return _rawRuleEvents;
+  }
+
+  bool windowComplete() const {
+    return _windowComplete;
+  }
+
+  // Replace the task values by the aggregates and start a new window.
+  void setAggregateValues();
+
+private:
+
+  struct EventStruct *_event;
+  float               _rawValues[VARS_PER_TASK];
+  bool                _active         = false;
+  bool                _rawRuleEvents  = false;
+  bool                _windowComplete = false;
+  bool                _replaced       = false;
+};
+
+// Free the aggregation state of a task, e.g. when its settings have changed.
+void clearTaskValueAggregation(taskIndex_t taskIndex);
+
+#endif // ifdef USES_TASK_VALUE_AGGREGATION
+#endif // ifndef HELPERS_TASKVALUEAGGREGATION_H
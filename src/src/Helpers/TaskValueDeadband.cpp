@@ -0,0 +1,152 @@
+#include "../Helpers/TaskValueDeadband.h"
+
+#ifdef USES_TASK_VALUE_DEADBAND
+
+# include "../DataStructs/ESPEasy_EventStruct.h"
+
+# include "../Globals/ExtraTaskSettings.h"
+# include "../Globals/RuntimeData.h"
+
+# include "../Helpers/_Plugin_SensorTypeHelper.h"
+# include "../Helpers/ESPEasy_time_calc.h"
+# include "../Helpers/Numerical.h"
+
+# include <new>
+
+struct TaskValueDeadband_state_t {
+  TaskValueDeadband_state_t() {
+    for (controllerIndex_t x = 0; x < CONTROLLER_MAX; ++x) {
+      lastSentTime[x] = 0;
+      valid[x]        = false;
+    }
+  }
+
+  float         lastSent[CONTROLLER_MAX][VARS_PER_TASK];
+  unsigned long lastSentTime[CONTROLLER_MAX];
+  bool          valid[CONTROLLER_MAX];
+};
+
+// Only allocated for tasks with a deadband set, once values have been sent.
+static TaskValueDeadband_state_t *TaskValueDeadbandStates[TASKS_MAX] = {};
+
+void clearTaskValueDeadband(taskIndex_t taskIndex) {
+  if (validTaskIndex(taskIndex) && (TaskValueDeadbandStates[taskIndex] != nullptr)) {
+    delete TaskValueDeadbandStates[taskIndex];
+    TaskValueDeadbandStates[taskIndex] = nullptr;
+  }
+}
+
+void clearTaskValueDeadbandForController(controllerIndex_t controllerIndex) {
+  if (!validControllerIndex(controllerIndex)) {
+    return;
+  }
+
+  for (taskIndex_t taskIndex = 0; taskIndex < TASKS_MAX; ++taskIndex) {
+    if (TaskValueDeadbandStates[taskIndex] != nullptr) {
+      TaskValueDeadbandStates[taskIndex]->valid[controllerIndex] = false;
+    }
+  }
+}
+
+TaskValueDeadband::TaskValueDeadband(struct EventStruct *event) : _event(event)
+{
+  const taskIndex_t taskIndex = event->TaskIndex;
+
+  if (!validTaskIndex(taskIndex) || (ExtraTaskSettings.TaskIndex != taskIndex)) {
+    return;
+  }
+
+  if (!ExtraTaskSettings.valueDeadbandSet()) {
+    clearTaskValueDeadband(taskIndex);
+    return;
+  }
+
+  // Only numerical values are compared.
+  const Sensor_VType vtype = event->getSensorType();
+
+  if ((vtype == Sensor_VType::SENSOR_TYPE_LONG) ||
+      (vtype == Sensor_VType::SENSOR_TYPE_STRING)) {
+    return;
+  }
+  for (uint8_t i = 0; i < VARS_PER_TASK; ++i) {
+    _absolute[i] = ExtraTaskSettings.TaskDeviceValueDeadband[i];
+    _percent[i]  = ExtraTaskSettings.TaskDeviceValueDeadbandPercent[i];
+  }
+  _heartbeat_ms = ExtraTaskSettings.DeadbandHeartbeat * 1000ul;
+  _valueCount   = getValueCountFromSensorType(vtype);
+  _active       = _valueCount > 0;
+}
+
+bool TaskValueDeadband::mustSend(controllerIndex_t controllerIndex) const {
+  if (!_active || !validControllerIndex(controllerIndex)) {
+    return true;
+  }
+  const TaskValueDeadband_state_t *state = TaskValueDeadbandStates[_event->TaskIndex];
+
+  if ((state == nullptr) || !state->valid[controllerIndex]) {
+    return true;
+  }
+
+  if ((_heartbeat_ms != 0) &&
+      (timePassedSince(state->lastSentTime[controllerIndex]) >= static_cast<long>(_heartbeat_ms))) {
+    return true;
+  }
+  return exceedsDeadband(controllerIndex);
+}
+
+void TaskValueDeadband::setSent(controllerIndex_t controllerIndex) {
+  if (!_active || !validControllerIndex(controllerIndex)) {
+    return;
+  }
+  TaskValueDeadband_state_t *state = TaskValueDeadbandStates[_event->TaskIndex];
+
+  if (state == nullptr) {
+    state = new (std::nothrow) TaskValueDeadband_state_t();
+
+    if (state == nullptr) {
+      // Without state, all values are sent.
+      return;
+    }
+    TaskValueDeadbandStates[_event->TaskIndex] = state;
+  }
+
+  for (uint8_t i = 0; i < VARS_PER_TASK; ++i) {
+    state->lastSent[controllerIndex][i] = UserVar[_event->BaseVarIndex + i];
+  }
+  state->lastSentTime[controllerIndex] = millis();
+  state->valid[controllerIndex]        = true;
+}
+
+bool TaskValueDeadband::exceedsDeadband(controllerIndex_t controllerIndex) const {
+  const TaskValueDeadband_state_t *state = TaskValueDeadbandStates[_event->TaskIndex];
+
+  for (uint8_t i = 0; i < _valueCount && i < VARS_PER_TASK; ++i) {
+    const float value = UserVar[_event->BaseVarIndex + i];
+    const float last  = state->lastSent[controllerIndex][i];
+
+    if (!isValidFloat(value) || !isValidFloat(last)) {
+      if (isValidFloat(value) != isValidFloat(last)) {
+        return true;
+      }
+      continue;
+    }
+
+    const float diff = fabsf(value - last);
+
+    if (diff > 0.0f) {
+      float deadband         = _absolute[i];
+      const float percentage = _percent[i] * fabsf(last) / 100.0f;
+
+      if (percentage > deadband) {
+        deadband = percentage;
+      }
+
+      if (diff >= deadband) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+#endif // ifdef USES_TASK_VALUE_DEADBAND
@@ -0,0 +1,56 @@
+#ifndef HELPERS_TASKVALUEDEADBAND_H
+#define HELPERS_TASKVALUEDEADBAND_H
+
+#include "../../ESPEasy_common.h"
+
+#ifdef USES_TASK_VALUE_DEADBAND
+
+# include "../CustomBuild/ESPEasyLimits.h"
+# include "../DataTypes/ControllerIndex.h"
+# include "../DataTypes/TaskIndex.h"
+
+struct EventStruct;
+
+/*********************************************************************************************\
+* Report by exception: Only send task values to a controller when they have changed.
+*
+* A value has changed when it differs more from the value last sent to the same controller
+* than its deadband, which is the largest of the absolute and the percentage deadband.
+* A value without deadband set is sent on any change.
+* When nothing changed for the max. silent interval, the values are sent anyway.
+*
+* The last sent values are kept per task and per controller.
+\*********************************************************************************************/
+class TaskValueDeadband {
+public:
+
+  // ExtraTaskSettings must be loaded for the task.
+  // The deadband settings are copied, as sending to a controller may load the settings of another task.
+  explicit TaskValueDeadband(struct EventStruct *event);
+
+  // Returns true when the current task values must be sent to the controller.
+  bool mustSend(controllerIndex_t controllerIndex) const;
+
+  // Remember the current task values as sent to the controller.
+  void setSent(controllerIndex_t controllerIndex);
+
+private:
+
+  bool exceedsDeadband(controllerIndex_t controllerIndex) const;
+
+  struct EventStruct *_event;
+  float               _absolute[VARS_PER_TASK];
+  float               _percent[VARS_PER_TASK];
+  uint32_t            _heartbeat_ms = 0;
+  uint8_t             _valueCount   = 0;
+  bool                _active       = false;
+};
+
+// Forget the last sent values of a task, e.g. when its settings have changed.
+void clearTaskValueDeadband(taskIndex_t taskIndex);
+
+// Forget the last sent values of all tasks for a controller.
+void clearTaskValueDeadbandForController(controllerIndex_t controllerIndex);
+
+#endif // ifdef USES_TASK_VALUE_DEADBAND
+#endif // ifndef HELPERS_TASKVALUEDEADBAND_H
@@ -0,0 +1,212 @@
+#include "../Helpers/VibrationFeatures.h"
+
+#ifdef PLUGIN_USES_VIBRATION_FEATURES
+
+// Quarter period of sin(2 * pi * i / VIBRATION_FEATURES_MAX_SAMPLES) in Q15
+static const int16_t VibrationFeatures_sine[VIBRATION_FEATURES_MAX_SAMPLES / 4 + 1] PROGMEM = {
+      0,   201,   402,   603,   804,  1005,  1206,  1407,  1608,  1809,  2009,  2210,
+   2411,  2611,  2811,  3012,  3212,  3412,  3612,  3812,  4011,  4211,  4410,  4609,
+   4808,  5007,  5205,  5404,  5602,  5800,  5998,  6195,  6393,  6590,  6787,  6983,
+   7180,  7376,  7571,  7767,  7962,  8157,  8351,  8546,  8740,  8933,  9127,  9319,
+   9512,  9704,  9896, 10088, 10279, 10469, 10660, 10850, 11039, 11228, 11417, 11605,
+  11793, 11980, 12167, 12354, 12540, 12725, 12910, 13095, 13279, 13463, 13646, 13828,
+  14010, 14192, 14373, 14553, 14733, 14912, 15091, 15269, 15447, 15624, 15800, 15976,
+  16151, 16326, 16500, 16673, 16846, 17018, 17190, 17361, 17531, 17700, 17869, 18037,
+  18205, 18372, 18538, 18703, 18868, 19032, 19195, 19358, 19520, 19681, 19841, 20001,
+  20160, 20318, 20475, 20632, 20788, 20943, 21097, 21251, 21403, 21555, 21706, 21856,
+  22006, 22154, 22302, 22449, 22595, 22740, 22884, 23028, 23170, 23312, 23453, 23593,
+  23732, 23870, 24008, 24144, 24279, 24414, 24548, 24680, 24812, 24943, 25073, 25202,
+  25330, 25457, 25583, 25708, 25833, 25956, 26078, 26199, 26320, 26439, 26557, 26674,
+  26791, 26906, 27020, 27133, 27246, 27357, 27467, 27576, 27684, 27791, 27897, 28002,
+  28106, 28209, 28311, 28411, 28511, 28610, 28707, 28803, 28899, 28993, 29086, 29178,
+  29269, 29359, 29448, 29535, 29622, 29707, 29792, 29875, 29957, 30038, 30118, 30196,
+  30274, 30350, 30425, 30499, 30572, 30644, 30715, 30784, 30853, 30920, 30986, 31050,
+  31114, 31177, 31238, 31298, 31357, 31415, 31471, 31527, 31581, 31634, 31686, 31737,
+  31786, 31834, 31881, 31927, 31972, 32015, 32058, 32099, 32138, 32177, 32214, 32251,
+  32286, 32319, 32352, 32383, 32413, 32442, 32470, 32496, 32522, 32546, 32568, 32590,
+  32610, 32629, 32647, 32664, 32679, 32693, 32706, 32718, 32729, 32738, 32746, 32753,
+  32758, 32762, 32766, 32767, 32767
+
+};
+
+static int16_t sinQ15(uint16_t index) {
+  index &= (VIBRATION_FEATURES_MAX_SAMPLES - 1);
+  const uint16_t quarter = VIBRATION_FEATURES_MAX_SAMPLES / 4;
+  const uint16_t i       = index % quarter;
+
+  switch (index / quarter) {
+    case 0: return pgm_read_word(&VibrationFeatures_sine[i]);
+    case 1: return pgm_read_word(&VibrationFeatures_sine[quarter - i]);
+    case 2: return -static_cast<int16_t>(pgm_read_word(&VibrationFeatures_sine[i]));
+  }
+  return -static_cast<int16_t>(pgm_read_word(&VibrationFeatures_sine[quarter - i]));
+}
+
+static int16_t cosQ15(uint16_t index) {
+  return sinQ15(index + VIBRATION_FEATURES_MAX_SAMPLES / 4);
+}
+
+static bool isPowerOf2(uint16_t value) {
+  return value != 0 && (value & (value - 1)) == 0;
+}
+
+void fft_q15(int16_t *re, int16_t *im, uint16_t count) {
+  // Bit reversed reordering
+  for (uint16_t i = 1, j = 0; i < count; ++i) {
+    uint16_t bit = count >> 1;
+
+    for (; j & bit; bit >>= 1) {
+      j ^= bit;
+    }
+    j ^= bit;
+
+    if (i < j) {
+      std::swap(re[i], re[j]);
+      std::swap(im[i], im[j]);
+    }
+  }
+
+  for (uint16_t half = 1; half < count; half <<= 1) {
+    const uint16_t step = VIBRATION_FEATURES_MAX_SAMPLES / (2 * half);
+
+    for (uint16_t m = 0; m < half; ++m) {
+      const int32_t wr = cosQ15(m * step);
+      const int32_t wi = -sinQ15(m * step);
+
+      for (uint16_t i = m; i < count; i += 2 * half) {
+        const uint16_t k  = i + half;
+        const int32_t  tr = (wr * re[k] - wi * im[k]) >> 15;
+        const int32_t  ti = (wr * im[k] + wi * re[k]) >> 15;
+        const int32_t  qr = re[i];
+        const int32_t  qi = im[i];
+
+        re[k] = (qr - tr) >> 1;
+        im[k] = (qi - ti) >> 1;
+        re[i] = (qr + tr) >> 1;
+        im[i] = (qi + ti) >> 1;
+      }
+    }
+  }
+}
+
+bool calculateVibrationFeatures(const int16_t       *samples,
+                                uint16_t             count,
+                                float                sampleRate,
+                                float                bandLow,
+                                float                bandHigh,
+                                float                scale,
+                                int16_t             *re,
+                                int16_t             *im,
+                                VibrationFeatures_t& features)
+{
+  features = VibrationFeatures_t();
+
+  if ((samples == nullptr) || (count == 0)) {
+    return false;
+  }
+
+  int32_t sum = 0;
+
+  for (uint16_t i = 0; i < count; ++i) {
+    sum += samples[i];
+  }
+  const float mean  = static_cast<float>(sum) / count;
+  float       sumSq = 0.0f;
+  float       peak  = 0.0f;
+
+  for (uint16_t i = 0; i < count; ++i) {
+    const float d = samples[i] - mean;
+    sumSq += d * d;
+
+    if (fabsf(d) > peak) {
+      peak = fabsf(d);
+    }
+  }
+  const float rms = sqrtf(sumSq / count);
+
+  features.rms  = rms * scale;
+  features.peak = peak * scale;
+
+  if (rms > 0.0f) {
+    features.crest = peak / rms;
+  }
+
+  if ((re == nullptr) || (im == nullptr) || (count < 4) ||
+      (count > VIBRATION_FEATURES_MAX_SAMPLES) || !isPowerOf2(count) ||
+      (sampleRate <= 0.0f)) {
+    return true;
+  }
+
+  // Remove the mean and apply a Hann window, to limit leakage between frequency bins.
+  const int32_t  mean_i = sum / count;
+  const uint16_t step   = VIBRATION_FEATURES_MAX_SAMPLES / count;
+  int32_t maxAbs        = 0;
+
+  for (uint16_t i = 0; i < count; ++i) {
+    const int32_t w = (32768 - cosQ15(i * step)) >> 1;
+    const int32_t v = ((samples[i] - mean_i) * w) >> 15;
+
+    if (abs(v) > maxAbs) {
+      maxAbs = abs(v);
+    }
+  }
+
+  if (maxAbs == 0) {
+    return true;
+  }
+
+  // Scale to use most of the Q15 range, leaving 1 bit headroom.
+  int shift = 0;
+
+  while ((maxAbs << (shift + 1)) < 16384) {
+    ++shift;
+  }
+
+  while ((shift <= 0) && ((maxAbs >> -shift) >= 16384)) {
+    --shift;
+  }
+
+  for (uint16_t i = 0; i < count; ++i) {
+    const int32_t w = (32768 - cosQ15(i * step)) >> 1;
+    const int32_t v = ((samples[i] - mean_i) * w) >> 15;
+    re[i] = static_cast<int16_t>(shift >= 0 ? (v << shift) : (v >> -shift));
+    im[i] = 0;
+  }
+
+  fft_q15(re, im, count);
+
+  const float    binWidth = sampleRate / count;
+  const uint16_t nyquist  = count / 2;
+  uint16_t kLow           = 1; // Skip DC
+  uint16_t kHigh          = nyquist;
+
+  if (bandLow > binWidth) {
+    const float k = ceilf(bandLow / binWidth);
+    kLow = (k > nyquist) ? nyquist + 1 : static_cast<uint16_t>(k);
+  }
+
+  if (bandHigh > 0.0f) {
+    const float k = floorf(bandHigh / binWidth);
+
+    if (k < nyquist) {
+      kHigh = static_cast<uint16_t>(k);
+    }
+  }
+
+  float power = 0.0f;
+
+  for (uint16_t k = kLow; k <= kHigh; ++k) {
+    const float p = static_cast<float>(re[k]) * re[k] + static_cast<float>(im[k]) * im[k];
+
+    // Both positive and negative frequencies, Nyquist only once
+    power += (k == nyquist) ? p : 2.0f * p;
+  }
+
+  // Undo the scaling and the power loss of the Hann window (mean of w^2 = 3/8).
+  const float factor = (shift >= 0) ? static_cast<float>(1ul << shift) : 1.0f / static_cast<float>(1ul << -shift);
+
+  features.bandRMS = sqrtf(power * 8.0f / 3.0f) / factor * scale;
+  return true;
+}
+
+#endif // ifdef PLUGIN_USES_VIBRATION_FEATURES
@@ -0,0 +1,44 @@
+#ifndef HELPERS_VIBRATIONFEATURES_H
+#define HELPERS_VIBRATIONFEATURES_H
+
+#include "../../ESPEasy_common.h"
+
+#ifdef PLUGIN_USES_VIBRATION_FEATURES
+
+/****************************************************************************
+ * Feature extraction for a window of vibration samples (accelerometer/gyro),
+ * so only a few values need to be published instead of all samples.
+ ***************************************************************************/
+
+# define VIBRATION_FEATURES_MAX_SAMPLES  1024 // Limited by the size of the sine table
+
+struct VibrationFeatures_t {
+  float rms     = 0.0f; // RMS of the samples, with the mean (DC, gravity) removed
+  float peak    = 0.0f; // Largest absolute deviation from the mean
+  float crest   = 0.0f; // Crest factor: peak / RMS
+  float bandRMS = 0.0f; // RMS of the frequency band bandLow ... bandHigh
+};
+
+// Calculate the features of a window of 'count' samples, taken at 'sampleRate' Hz.
+// For the band RMS, 'count' must be a power of 2, up to VIBRATION_FEATURES_MAX_SAMPLES.
+// bandHigh = 0: Up to half the sample rate.
+// 're' and 'im' are work buffers of 'count' elements.
+// Results are in sample units, multiplied by 'scale'.
+bool calculateVibrationFeatures(const int16_t       *samples,
+                                uint16_t             count,
+                                float                sampleRate,
+                                float                bandLow,
+                                float                bandHigh,
+                                float                scale,
+                                int16_t             *re,
+                                int16_t             *im,
+                                VibrationFeatures_t& features);
+
+// In-place radix-2 FFT of Q15 values, 'count' a power of 2.
+// Each stage is scaled by 1/2 to prevent overflow, so the result is X[k] / count.
+void fft_q15(int16_t *re,
+             int16_t *im,
+             uint16_t count);
+
+#endif // ifdef PLUGIN_USES_VIBRATION_FEATURES
+#endif // ifndef HELPERS_VIBRATIONFEATURES_H
@@ -21,6 +21,7 @@
 #include "../Globals/SecuritySettings.h"
 #include "../Globals/ESPEasyWiFiEvent.h"
 
+#include "../Helpers/ControllerWorker.h"
 #include "../Helpers/ESPEasy_time_calc.h"
 #include "../Helpers/Misc.h"
 #include "../Helpers/Network.h"
@@ -272,18 +273,31 @@ void log_connecting_fail(const __FlashStringHelper * prefix, int controller_numb
   }
 }
 
+static void count_connection_failures(bool success) {
+  #ifdef USES_CONTROLLER_WORKER
+  if (ControllerWorker_inWorker()) {
+    // WiFiEventData is only updated by the loop task.
+    ControllerWorker_runOnLoop([success]() { count_connection_failures(success); });
+    return;
+  }
+  #endif // ifdef USES_CONTROLLER_WORKER
+
+  if (!success) {
+    ++WiFiEventData.connectionFailures;
+  } else if (WiFiEventData.connectionFailures > 0) {
+    --WiFiEventData.connectionFailures;
+  }
+}
+
 bool count_connection_results(bool success, const __FlashStringHelper * prefix, int controller_number) {
+  count_connection_failures(success);
+
   if (!success)
   {
-    ++WiFiEventData.connectionFailures;
     log_connecting_fail(prefix, controller_number);
     return false;
   }
   statusLED(true);
-
-  if (WiFiEventData.connectionFailures > 0) {
-    --WiFiEventData.connectionFailures;
-  }
   return true;
 }
 
@@ -596,10 +610,36 @@ String send_via_http(const String& logIdentifier,
   return response;
 }
 
+#ifdef USES_CONTROLLER_WORKER
+
+// Only used by the worker task.
+static const ControllerCredentials_t *workerControllerCredentials = nullptr;
+
+ControllerCredentials_t::ControllerCredentials_t(controllerIndex_t               controller_idx,
+                                                 const ControllerSettingsStruct& ControllerSettings)
+  : controller_idx(controller_idx),
+  user(getControllerUser(controller_idx, ControllerSettings)),
+  pass(getControllerPass(controller_idx, ControllerSettings))
+{}
+
+void setWorkerControllerCredentials(const ControllerCredentials_t *credentials)
+{
+  workerControllerCredentials = credentials;
+}
+
+#endif // ifdef USES_CONTROLLER_WORKER
+
 String getControllerUser(controllerIndex_t controller_idx, const ControllerSettingsStruct& ControllerSettings)
 {
   if (!validControllerIndex(controller_idx)) { return ""; }
 
+  #ifdef USES_CONTROLLER_WORKER
+  if (ControllerWorker_inWorker()) {
+    if ((workerControllerCredentials == nullptr) || (workerControllerCredentials->controller_idx != controller_idx)) { return ""; }
+    return workerControllerCredentials->user;
+  }
+  #endif // ifdef USES_CONTROLLER_WORKER
+
   if (ControllerSettings.useExtendedCredentials()) {
     return ExtendedControllerCredentials.getControllerUser(controller_idx);
   }
@@ -610,6 +650,13 @@ String getControllerPass(controllerIndex_t controller_idx, const ControllerSetti
 {
   if (!validControllerIndex(controller_idx)) { return ""; }
 
+  #ifdef USES_CONTROLLER_WORKER
+  if (ControllerWorker_inWorker()) {
+    if ((workerControllerCredentials == nullptr) || (workerControllerCredentials->controller_idx != controller_idx)) { return ""; }
+    return workerControllerCredentials->pass;
+  }
+  #endif // ifdef USES_CONTROLLER_WORKER
+
   if (ControllerSettings.useExtendedCredentials()) {
     return ExtendedControllerCredentials.getControllerPass(controller_idx);
   }
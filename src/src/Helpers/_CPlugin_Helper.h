@@ -126,5 +126,25 @@ void setControllerPass(controllerIndex_t controller_idx, const ControllerSetting
 
 bool hasControllerCredentialsSet(controllerIndex_t controller_idx, const ControllerSettingsStruct& ControllerSettings);
 
+#ifdef USES_CONTROLLER_WORKER
+
+// Controller credentials for a job on the controller worker task.
+// They are resolved on the loop task and captured into the job,
+// as the web UI may change the (extended) credentials meanwhile.
+struct ControllerCredentials_t {
+  ControllerCredentials_t(controllerIndex_t               controller_idx,
+                          const ControllerSettingsStruct& ControllerSettings);
+
+  controllerIndex_t controller_idx;
+  String            user;
+  String            pass;
+};
+
+// Set the credentials getControllerUser/getControllerPass return on the worker task.
+// Only to be called from the worker task, set to nullptr when the job is done.
+void setWorkerControllerCredentials(const ControllerCredentials_t *credentials);
+
+#endif // ifdef USES_CONTROLLER_WORKER
+
 
 #endif // CPLUGIN_HELPER_H
@@ -35,7 +35,10 @@ void CPluginInit()
   {
     CPlugin_ptr[x]                 = nullptr;
     ProtocolIndex_to_CPlugin_id[x] = INVALID_C_PLUGIN_ID;
-    // Do not initialize CPlugin_id_to_ProtocolIndex[x] to an invalid value. (it is map)
+  }
+
+  for (size_t i = 0; i < CPLUGIN_ID_TABLE_SIZE; ++i) {
+    CPlugin_id_to_ProtocolIndex[i] = INVALID_PROTOCOL_INDEX;
   }
 
   x = 0;
@@ -63,15 +63,15 @@ bool Internal_GPIO_pulseHelper::init()
     pinMode(config.gpio, config.pullupPinMode);
 
     pulseModeData.currentStableState = config.interruptPinMode == GPIOtriggerMode::PulseLow ? HIGH : LOW;
-    pulseModeData.lastCheckState     = HIGH;
+    pulseModeData.candidatePending   = false;
 
     // initialize internal variables for PULSE mode handling
+    ISRdata.edgeHead = 0;
+    ISRdata.edgeTail = 0;
     #ifdef PULSE_STATISTIC
     resetStatsErrorVars();
-    ISRdata.Step0counter         = ISRdata.pulseTotalCounter;
-    pulseModeData.Step1counter   = ISRdata.pulseTotalCounter;
-    pulseModeData.Step2OKcounter = ISRdata.pulseTotalCounter;
-    pulseModeData.Step3OKcounter = ISRdata.pulseTotalCounter;
+    ISRdata.edgeCounter           = ISRdata.pulseTotalCounter;
+    pulseModeData.stableOKcounter = ISRdata.pulseTotalCounter;
     #endif
 
     const int intPinMode = static_cast<int>(config.interruptPinMode) & MODE_INTERRUPT_MASK;
@@ -109,172 +109,77 @@ void Internal_GPIO_pulseHelper::resetPulseCounter()
   ISRdata.pulseTime    = 0;
 }
 
-void Internal_GPIO_pulseHelper::doPulseStepProcessing(int pStep)
+void Internal_GPIO_pulseHelper::doPulseProcessing()
 {
-  switch (pStep)
-  {
-    case GPIO_PULSE_HELPER_PROCESSING_STEP_0:
-      // regularily called to check if the trigger has flagged the next signal edge
-    {
-      if (ISRdata.initStepsFlags)
-      {
-        // schedule step 1 in remaining milliseconds from debounce time
-        long delayTime =
-          static_cast<long>(
-            (static_cast<int64_t>(config.debounceTime_micros)) -
-            static_cast<int64_t>(us_Since_triggerTimestamp())
-            ) / 1000L;
-
-        if (delayTime < 0)
-        {
-          // if debounce time was too short or we were called too late by Scheduler
-          #ifdef PULSE_STATISTIC
-          pulseModeData.Step0ODcounter++; // count occurences
-          pulseModeData.StepOverdueMax[pStep] = max(pulseModeData.StepOverdueMax[pStep], -delayTime);
-          #endif // PULSE_STATISTIC
-          delayTime = 0;
-        }
-        Scheduler.setPluginTaskTimer(delayTime, config.taskIndex, GPIO_PULSE_HELPER_PROCESSING_STEP_1);
-
-        #ifdef PULSE_STATISTIC
-
-        // FIXME TD-er: Why only correct this when statistics are collected?
-        ISRdata.triggerTimestamp = getMicros64() + delayTime * 1000L;
-        #endif // PULSE_STATISTIC
-
-        // initialization done
-        ISRdata.initStepsFlags = false;
-      }
-      break;
-    }
-
-    case GPIO_PULSE_HELPER_PROCESSING_STEP_1: // read pin status
-    {
-      #ifdef PULSE_STATISTIC
-      pulseModeData.Step1counter++;
-      pulseModeData.setStepOverdueMax(pStep, msec_Since_triggerTimestamp());
-      #endif // PULSE_STATISTIC
-
-      //  read current state from this tasks's GPIO
-      pulseModeData.lastCheckState = digitalRead(config.gpio);
-
-      // after debounceTime/2, do step 2
-      Scheduler.setPluginTaskTimer(config.debounceTime >> 1, config.taskIndex, GPIO_PULSE_HELPER_PROCESSING_STEP_2);
-
-      #ifdef PULSE_STATISTIC
-
-      // FIXME TD-er: Why only correct this when statistics are collected?
-      ISRdata.triggerTimestamp = getMicros64() + (config.debounceTime >> 1) * 1000L;
-      #endif // PULSE_STATISTIC
-      break;
-    }
+  // Only the ISR writes edgeHead, so all entries up to this head are complete.
+  const uint16_t head  = ISRdata.edgeHead;
+  uint16_t       tail  = ISRdata.edgeTail;
+  const uint64_t now   = getMicros64();
+  const uint32_t now32 = static_cast<uint32_t>(now);
 
-    case GPIO_PULSE_HELPER_PROCESSING_STEP_2: // 1st validation of pin status
-    {
-      #ifdef PULSE_STATISTIC
-      pulseModeData.setStepOverdueMax(pStep, msec_Since_triggerTimestamp());
-      #endif // PULSE_STATISTIC
+  #ifdef PULSE_STATISTIC
+  const unsigned int nrEdges = static_cast<uint16_t>(head - tail);
 
-      //  read current state from this tasks's GPIO
-      const int pinState = digitalRead(config.gpio);
+  if (nrEdges > pulseModeData.maxEdgesPerBatch) {
+    pulseModeData.maxEdgesPerBatch = nrEdges;
+  }
+  #endif // ifdef PULSE_STATISTIC
 
-      if (pinState == pulseModeData.lastCheckState)
+  for (; tail != head; ++tail) {
+    const uint32_t edge = ISRdata.edges[tail & GPIO_PULSE_HELPER_EDGE_BUFFER_MASK];
 
-      // we found stable state
-      {
-        #ifdef PULSE_STATISTIC
-        pulseModeData.Step2OKcounter++;
-        #endif // PULSE_STATISTIC
-        // after debounceTime/2, do step 3
-        Scheduler.setPluginTaskTimer(config.debounceTime >> 1, config.taskIndex, GPIO_PULSE_HELPER_PROCESSING_STEP_3);
-      }
-      else
+    // Restore the full 64 bit timestamp, the edge can be at most 71 minutes old.
+    const uint64_t edgeTime = now - static_cast<uint32_t>(now32 - (edge & ~1u));
 
-      // we found unexpected different pin state
-      {
-        #ifdef PULSE_STATISTIC
-        pulseModeData.Step2NOKcounter++;
-        #endif // PULSE_STATISTIC
-        // lets ignore previous pin status. It might have been a spike. Try to detect stable signal
-        pulseModeData.lastCheckState = pinState;    // now trust the new state
-        // after debounceTime/2, do step 2 again
-        Scheduler.setPluginTaskTimer(config.debounceTime >> 1, config.taskIndex, GPIO_PULSE_HELPER_PROCESSING_STEP_2);
+    if (pulseModeData.candidatePending) {
+      if ((edgeTime - pulseModeData.candidateTime) >= config.debounceTime_micros) {
+        // Previous state lasted at least the debounce time
+        processStableCandidate(now);
       }
-
       #ifdef PULSE_STATISTIC
-
-      // FIXME TD-er: Why only correct this when statistics are collected?
-      ISRdata.triggerTimestamp = getMicros64() + (config.debounceTime >> 1) * 1000L;
-      #endif // PULSE_STATISTIC
-      break;
-    }
-
-    case GPIO_PULSE_HELPER_PROCESSING_STEP_3: // 2nd validation of pin status and counting
-    {
-      #ifdef PULSE_STATISTIC
-      pulseModeData.setStepOverdueMax(pStep, msec_Since_triggerTimestamp());
-      #endif // PULSE_STATISTIC
-
-      // determine earliest effective start time of current stable pulse (= NOW - 2 * DebounceTime )
-      const uint64_t pulseChangeTime = getMicros64() - (config.debounceTime_micros << 1);
-
-      // determine how long the current stable pulse was lasting
-      if (pulseModeData.currentStableState == HIGH) // pulse was HIGH
-      {
-        pulseModeData.pulseHighTime = pulseChangeTime - ISRdata.currentStableStartTime;
-      }
-      else // pulse was LOW
-      {
-        pulseModeData.pulseLowTime = pulseChangeTime - ISRdata.currentStableStartTime;
+      else {
+        pulseModeData.bounceCounter++;
       }
+      #endif // ifdef PULSE_STATISTIC
+    }
+    pulseModeData.candidateState   = (edge & 1) ? HIGH : LOW;
+    pulseModeData.candidateTime    = edgeTime;
+    pulseModeData.candidatePending = true;
+  }
 
-      //  read current state from this tasks's GPIO
-      const int pinState = digitalRead(config.gpio);
-
-      if (pinState == pulseModeData.lastCheckState)
-
-      // we found the same state as in step 2. It is stable and valid.
-      {
-        processStablePulse(pinState, pulseChangeTime);
-      }
-      else
-
-      // we found unexpected different pin state
-      {
-        #ifdef PULSE_STATISTIC
-        pulseModeData.Step3NOKcounter++;
-        #endif // PULSE_STATISTIC
-
-        // ignore spike from previous step. It is regarded as spike within previous=current signal. Again try to detect stable signal
-        pulseModeData.lastCheckState = pinState;    // now trust the previous=new state
-        Scheduler.setPluginTaskTimer(config.debounceTime >> 1, config.taskIndex, GPIO_PULSE_HELPER_PROCESSING_STEP_2);
-
-        #ifdef PULSE_STATISTIC
+  // Free the processed entries for the ISR
+  ISRdata.edgeTail = tail;
 
-        // FIXME TD-er: Why only correct this when statistics are collected?
-        ISRdata.triggerTimestamp = getMicros64() + (config.debounceTime >> 1) * 1000L;
-        #endif // PULSE_STATISTIC
-      }
-      break;
-    }
-    default:
-    {
-      if (loglevelActiveFor(LOG_LEVEL_ERROR)) {
-        String log; log.reserve(48);
-        log = F("_P003:PLUGIN_TIMER_IN: Invalid processingStep: "); log += pStep;
-        addLogMove(LOG_LEVEL_ERROR, log);
-      }
-      break;
-    }
+  if (pulseModeData.candidatePending &&
+      ((now - pulseModeData.candidateTime) >= config.debounceTime_micros) &&
+      (ISRdata.edgeHead == head)) {
+    // No edge for at least the debounce time, so the current pin state is stable.
+    // It is more reliable than the state read in the ISR, which may have been read during bouncing.
+    pulseModeData.candidateState = digitalRead(config.gpio);
+    processStableCandidate(now);
   }
 }
 
-uint64_t Internal_GPIO_pulseHelper::us_Since_triggerTimestamp() const {
-  return getMicros64() - ISRdata.triggerTimestamp;
+unsigned long Internal_GPIO_pulseHelper::getEdgeOverflowCount() const
+{
+  return ISRdata.edgeOverflowCount;
 }
 
-long Internal_GPIO_pulseHelper::msec_Since_triggerTimestamp() const {
-  return static_cast<long>(us_Since_triggerTimestamp()) / 1000L;
+/*********************************************************************************************\
+*  Processing for an edge which was followed by at least the debounce time without new edges
+\*********************************************************************************************/
+void Internal_GPIO_pulseHelper::processStableCandidate(uint64_t now)
+{
+  #ifdef PULSE_STATISTIC
+  const uint64_t processingDelay = now - pulseModeData.candidateTime - config.debounceTime_micros;
+
+  if (processingDelay > pulseModeData.maxProcessingDelay) {
+    pulseModeData.maxProcessingDelay = processingDelay;
+  }
+  #endif // ifdef PULSE_STATISTIC
+
+  pulseModeData.candidatePending = false;
+  processStablePulse(pulseModeData.candidateState, pulseModeData.candidateTime);
 }
 
 /*********************************************************************************************\
@@ -287,11 +192,19 @@ void Internal_GPIO_pulseHelper::processStablePulse(int pinState, uint64_t pulseC
   // The state changed. Previous sable pulse ends, new starts
   {
     #ifdef PULSE_STATISTIC
-    pulseModeData.Step3OKcounter++;
+    pulseModeData.stableOKcounter++;
     #endif // PULSE_STATISTIC
 
+    // determine how long the previous stable pulse was lasting
+    if (pulseModeData.currentStableState == HIGH) { // pulse was HIGH
+      pulseModeData.pulseHighTime = pulseChangeTime - ISRdata.currentStableStartTime;
+    }
+    else {                                          // pulse was LOW
+      pulseModeData.pulseLowTime = pulseChangeTime - ISRdata.currentStableStartTime;
+    }
+
     // lets terminate the previous pulse and setup start point for new stable one
-    pulseModeData.currentStableState = !pulseModeData.currentStableState;
+    pulseModeData.currentStableState = pinState;
     ISRdata.currentStableStartTime   = pulseChangeTime;
 
     // now provide the counter result values for the ended pulse ( depending on mode type)
@@ -335,7 +248,7 @@ void Internal_GPIO_pulseHelper::processStablePulse(int pinState, uint64_t pulseC
         if (loglevelActiveFor(LOG_LEVEL_ERROR)) {
           String log;
           log.reserve(48);
-          log  = F("_P003:PLUGIN_TIMER_IN: Invalid modeType: ");
+          log  = F("Pulse: Invalid modeType: ");
           log += static_cast<int>(config.interruptPinMode);
           addLogMove(LOG_LEVEL_ERROR, log);
         }
@@ -348,7 +261,7 @@ void Internal_GPIO_pulseHelper::processStablePulse(int pinState, uint64_t pulseC
   // we found the same stable state as before
   {
     #ifdef PULSE_STATISTIC
-    pulseModeData.Step3IGNcounter++;
+    pulseModeData.stableIGNcounter++;
     #endif // PULSE_STATISTIC
     // do nothing. Ignore interupt. previous stable state was confirmed probably after a spike
   }
@@ -356,9 +269,6 @@ void Internal_GPIO_pulseHelper::processStablePulse(int pinState, uint64_t pulseC
   #ifdef PULSE_STATISTIC
   doStatisticLogging(pulseModeData.StatsLogLevel);
   #endif // PULSE_STATISTIC
-
-  // allow next pulse check call from interrupt
-  ISRdata.processingFlags = false;
 }
 
 void IRAM_ATTR Internal_GPIO_pulseHelper::ISR_pulseCheck(Internal_GPIO_pulseHelper *self)
@@ -385,17 +295,23 @@ void IRAM_ATTR Internal_GPIO_pulseHelper::ISR_pulseCheck(Internal_GPIO_pulseHelp
 
   // processing for new PULSE mode types
   {
+    // Only record the edge, debouncing is done in doPulseProcessing()
     #ifdef PULSE_STATISTIC
-    self->ISRdata.Step0counter++;
+    self->ISRdata.edgeCounter++;
     #endif // PULSE_STATISTIC
 
-    // check if processing is allowed (not blocked) for this task (taskID)
-    if (!self->ISRdata.processingFlags)
-    {
-      // initiate processing
-      self->ISRdata.processingFlags  = true; // block further initiations as long as async processing is taking place
-      self->ISRdata.initStepsFlags   = true; // PLUGIN_FIFTY_PER_SECOND is polling for this flag set
-      self->ISRdata.triggerTimestamp = getMicros64();
+    const uint16_t head = self->ISRdata.edgeHead;
+
+    if (static_cast<uint16_t>(head - self->ISRdata.edgeTail) >= GPIO_PULSE_HELPER_EDGE_BUFFER_SIZE) {
+      self->ISRdata.edgeOverflowCount++;
+    } else {
+      const uint32_t edgeTime = static_cast<uint32_t>(getMicros64());
+      const uint32_t pinState = digitalRead(self->config.gpio) == HIGH ? 1 : 0;
+
+      self->ISRdata.edges[head & GPIO_PULSE_HELPER_EDGE_BUFFER_MASK] = (edgeTime & ~1u) | pinState;
+
+      // Publish the entry only after it has been written.
+      self->ISRdata.edgeHead = head + 1;
     }
   }
   interrupts(); // enable interrupts again.
@@ -404,10 +320,8 @@ void IRAM_ATTR Internal_GPIO_pulseHelper::ISR_pulseCheck(Internal_GPIO_pulseHelp
 #ifdef PULSE_STATISTIC
 
 void Internal_GPIO_pulseHelper::updateStatisticalCounters(int par1) {
-  ISRdata.Step0counter         -= ISRdata.pulseTotalCounter - par1;
-  pulseModeData.Step1counter   -= ISRdata.pulseTotalCounter - par1;
-  pulseModeData.Step2OKcounter -= ISRdata.pulseTotalCounter - par1;
-  pulseModeData.Step3OKcounter -= ISRdata.pulseTotalCounter - par1;
+  ISRdata.edgeCounter           -= ISRdata.pulseTotalCounter - par1;
+  pulseModeData.stableOKcounter -= ISRdata.pulseTotalCounter - par1;
 }
 
 void Internal_GPIO_pulseHelper::setStatsLogLevel(uint8_t logLevel) {
@@ -418,15 +332,11 @@ void Internal_GPIO_pulseHelper::setStatsLogLevel(uint8_t logLevel) {
 *  reset statistical error cunters and overview variables
 \*********************************************************************************************/
 void Internal_GPIO_pulseHelper::resetStatsErrorVars() {
-  // initialize statistical step counters from TotalCounter and error counters with 0
-  pulseModeData.Step2NOKcounter = 0;
-  pulseModeData.Step3NOKcounter = 0;
-  pulseModeData.Step3IGNcounter = 0;
-  pulseModeData.Step0ODcounter  = 0;
-
-  for (int pStep = 0; pStep <= P003_PSTEP_MAX; pStep++) {
-    pulseModeData.StepOverdueMax[pStep] = 0;
-  }
+  // initialize statistical error counters and maximum values with 0
+  pulseModeData.bounceCounter      = 0;
+  pulseModeData.stableIGNcounter   = 0;
+  pulseModeData.maxEdgesPerBatch   = 0;
+  pulseModeData.maxProcessingDelay = 0;
 }
 
 /*********************************************************************************************\
@@ -435,20 +345,18 @@ void Internal_GPIO_pulseHelper::resetStatsErrorVars() {
 void Internal_GPIO_pulseHelper::doStatisticLogging(uint8_t logLevel)
 {
   if (loglevelActiveFor(logLevel)) {
-    // Statistic to logfile. E.g: ... [123/1|111|100/5|80/3/4|40] [12243|3244]
+    // Statistic to logfile. E.g: ... [123|40|80/3|40] [12243|3244]
     String log; 
-    if (log.reserve(125)) {
+    if (log.reserve(140)) {
       log  = F("Pulse:");
-      log += F("Stats (GPIO) [step0|1|2|3|tot(ok/nok/ign)] [lo|hi]= (");
+      log += F("Stats (GPIO) [edges|bounce|stable(ok/ign)|tot|overflow] [lo|hi]= (");
       log += config.gpio;                       log += F(") [");
-      log += ISRdata.Step0counter;              log += '|';
-      log += pulseModeData.Step1counter;        log += '|';
-      log += pulseModeData.Step2OKcounter;      log += '/';
-      log += pulseModeData.Step2NOKcounter;     log += '|';
-      log += pulseModeData.Step3OKcounter;      log += '/';
-      log += pulseModeData.Step3NOKcounter;     log += '/';
-      log += pulseModeData.Step3IGNcounter;     log += '|';
-      log += ISRdata.pulseTotalCounter;         log += F("] [");
+      log += ISRdata.edgeCounter;               log += '|';
+      log += pulseModeData.bounceCounter;       log += '|';
+      log += pulseModeData.stableOKcounter;     log += '/';
+      log += pulseModeData.stableIGNcounter;    log += '|';
+      log += ISRdata.pulseTotalCounter;         log += '|';
+      log += getEdgeOverflowCount();            log += F("] [");
       log += pulseModeData.pulseLowTime / 1000L;  log += '|';
       log += pulseModeData.pulseHighTime / 1000L; log += ']';
       addLogMove(logLevel, log);
@@ -462,20 +370,16 @@ void Internal_GPIO_pulseHelper::doStatisticLogging(uint8_t logLevel)
 void Internal_GPIO_pulseHelper::doTimingLogging(uint8_t logLevel)
 {
   if (loglevelActiveFor(logLevel)) {
-    // Timer to logfile. E.g: ... [4|12000|13444|12243|3244]
+    // Timer to logfile. E.g: ... [20] {0} [12|3]
     String log;
     if (log.reserve(120)) {
       log  = F("Pulse:");
-      log += F("OverDueStats (GPIO) [dbTim] {step0OdCnt} [maxOdTimeStep0|1|2|3]= (");
+      log += F("BufferStats (GPIO) [dbTim] {overflow} [maxEdgesPerBatch|maxDelay]= (");
       log += config.gpio;  log += F(") [");
       log += config.debounceTime;  log += F("] {");
-      log += pulseModeData.Step0ODcounter;  log += F("} [");
-
-      for (int pStep = 0; pStep <= P003_PSTEP_MAX; pStep++) {
-        log += pulseModeData.StepOverdueMax[pStep];
-
-        if (pStep < P003_PSTEP_MAX) { log += '|'; }
-      }
+      log += ISRdata.edgeOverflowCount;  log += F("} [");
+      log += pulseModeData.maxEdgesPerBatch;  log += '|';
+      log += pulseModeData.maxProcessingDelay / 1000L;
       log += ']';
       addLogMove(logLevel, log);
     }
@@ -17,12 +17,12 @@
   # define PULSE_STATS_ADHOC_LOG_LEVEL    LOG_LEVEL_INFO
 #endif // ifdef PULSE_STATISTIC
 
-// processing Steps in PLUGIN_TIMER_IN
-#define GPIO_PULSE_HELPER_PROCESSING_STEP_0             0
-#define GPIO_PULSE_HELPER_PROCESSING_STEP_1             1
-#define GPIO_PULSE_HELPER_PROCESSING_STEP_2             2
-#define GPIO_PULSE_HELPER_PROCESSING_STEP_3             3
-#define P003_PSTEP_MAX                     GPIO_PULSE_HELPER_PROCESSING_STEP_3
+// Size of the edge timestamp ring buffer used in PULSE modes.
+// Must be a power of 2. With the buffer processed 50x per second, 64 entries allow for 3200 edges/sec.
+#ifndef GPIO_PULSE_HELPER_EDGE_BUFFER_SIZE
+  # define GPIO_PULSE_HELPER_EDGE_BUFFER_SIZE  64
+#endif // ifndef GPIO_PULSE_HELPER_EDGE_BUFFER_SIZE
+#define GPIO_PULSE_HELPER_EDGE_BUFFER_MASK    (GPIO_PULSE_HELPER_EDGE_BUFFER_SIZE - 1)
 
 // special Mode Type. Note: Lower 3 bits are significant for GPIO Interupt type. The upper bits distinguish the Mode Types
 #define PULSE_LOW               (0x10 | CHANGE)
@@ -36,47 +36,45 @@
 struct pulseCounterISRdata_t {
   uint64_t      pulseTime              = 0; // time between previous and most recently counted edge/pulse
   uint64_t      currentStableStartTime = 0; // stores the start time of the current stable pulse.
-  uint64_t      triggerTimestamp       = 0; // timestamp, when the signal change was detected in the ISR
   unsigned long pulseCounter           = 0; // number of counted pulses within most recent data collection/sent interval
   unsigned long pulseTotalCounter      = 0; // total number of pulses counted since last reset
+
+  // PULSE modes: Lock-free single producer (ISR), single consumer (loop) ring buffer of edges.
+  // Each entry holds the lower 32 bits of the edge timestamp in usec, with the LSB replaced by the pin state after the edge.
+  // edgeHead is only written by the ISR, edgeTail only by the loop. Both are free running, wrapping at 2^16.
+  // All are volatile, so the compiler does not cache the indices or move the entry access across an index update.
+  volatile uint32_t      edges[GPIO_PULSE_HELPER_EDGE_BUFFER_SIZE] = { 0 };
+  volatile uint16_t      edgeHead          = 0;
+  volatile uint16_t      edgeTail          = 0;
+  volatile unsigned long edgeOverflowCount = 0; // number of edges dropped because the buffer was full
   #ifdef PULSE_STATISTIC
 
   // debug/tuning variables for PULSE mode statistical logging
-  unsigned int Step0counter = 0; // counts how often step 0 was entered (volatile <- in ISR)
+  unsigned int edgeCounter = 0; // counts how often the ISR was called (volatile <- in ISR)
   #endif // ifdef PULSE_STATISTIC
-
-  bool initStepsFlags  = false;  // indicates that the pulse processing steps shall be initiated. One bit per task.
-  bool processingFlags = false;  // indicates pulse processing is running and interrupts must be ignored. One bit per task.
 };
 
 // internal variables for PULSE mode, not used by ISR functions
 struct pulseModeData_t {
-  unsigned long pulseLowTime       = 0; // indicates the length of the most recent stable low pulse (in ms)
-  unsigned long pulseHighTime      = 0; // indicates the length of the most recent stable high pulse (in ms)
-  int           currentStableState = 0; // stores current stable pin state. Set in Step 3 when new stable pulse started
-  int           lastCheckState     = 0; // most recent pin state, that was read. Set in Step1,2,3
+  uint64_t      candidateTime      = 0;     // time of the most recent edge, which is not yet known to be stable
+  unsigned long pulseLowTime       = 0;     // indicates the length of the most recent stable low pulse (in usec)
+  unsigned long pulseHighTime      = 0;     // indicates the length of the most recent stable high pulse (in usec)
+  int           currentStableState = 0;     // stores current stable pin state.
+  int           candidateState     = 0;     // pin state after the most recent edge
+  bool          candidatePending   = false; // candidateTime and candidateState are set
 
 
 #ifdef PULSE_STATISTIC
 
-  void setStepOverdueMax(int pStep, long overdueTime) {
-    if (StepOverdueMax[pStep] < overdueTime) {
-      StepOverdueMax[pStep] = overdueTime;
-    }
-  }
-
   // debug/tuning variables for PULSE mode statistical logging
-  unsigned int Step1counter    = 0; // counts how often step 1 was entered
-  unsigned int Step2OKcounter  = 0; // counts how often step 2 detected the expected pin state (first verification)
-  unsigned int Step2NOKcounter = 0; // counts how often step 2 detected the wrong pin state (first verification failed)
-  unsigned int Step3OKcounter  = 0; // counts how often step 3 detected the expected pin state (2nd verification)
-  unsigned int Step3NOKcounter = 0; // counts how often step 3 detected the wrong pin state (2nd verification failed)
-  unsigned int Step3IGNcounter = 0; // counts how often step 3 detected the wrong pin state (2nd verification failed)
-  unsigned int Step0ODcounter  = 0; // counts how often the debounce time timed out before step 0 was reached
-  long         StepOverdueMax[P003_PSTEP_MAX + 1] = { 0 }; // longest recognised overdue time per step in ms
-  uint8_t         StatsLogLevel = PULSE_STATS_ADHOC_LOG_LEVEL; // log level for regular statistics logging
-
-#endif
+  unsigned int  bounceCounter      = 0; // counts edges followed by another edge within the debounce time
+  unsigned int  stableOKcounter    = 0; // counts stable state changes
+  unsigned int  stableIGNcounter   = 0; // counts stable states equal to the previous one (e.g. after a spike)
+  unsigned int  maxEdgesPerBatch   = 0; // largest number of edges taken from the buffer at once
+  unsigned long maxProcessingDelay = 0; // longest time between end of debounce time and processing in usec
+  uint8_t       StatsLogLevel      = PULSE_STATS_ADHOC_LOG_LEVEL; // log level for regular statistics logging
+
+#endif // ifdef PULSE_STATISTIC
 };
 
 struct Internal_GPIO_pulseHelper {
@@ -135,17 +133,20 @@ struct Internal_GPIO_pulseHelper {
 
   void resetPulseCounter();
 
-  // Process recorded pulse data on regular intervals.
-  // Typically from PLUGIN_FIFTY_PER_SECOND or PLUGIN_TIMER_IN
-  void doPulseStepProcessing(int pStep);
+  // Process the edges recorded by the ISR in PULSE modes.
+  // Typically called from PLUGIN_FIFTY_PER_SECOND
+  void doPulseProcessing();
+
+  unsigned long getEdgeOverflowCount() const;
 
   pulseModeData_t pulseModeData;
 
 private:
 
-  uint64_t us_Since_triggerTimestamp() const;
-
-  long     msec_Since_triggerTimestamp() const;
+  /*********************************************************************************************\
+  *  Processing for an edge which was followed by at least the debounce time without new edges
+  \*********************************************************************************************/
+  void     processStableCandidate(uint64_t now);
 
   /*********************************************************************************************\
   *  Processing for found stable pulse
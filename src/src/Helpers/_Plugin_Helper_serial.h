@@ -5,6 +5,7 @@
 #include <ESPeasySerial.h>
 
 #include "../../ESPEasy_common.h"
+#include "../Helpers/SerialIngest.h"
 
 struct ESPeasySerialType;
 
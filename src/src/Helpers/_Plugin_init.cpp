@@ -2,6 +2,7 @@
 
 #include "../../ESPEasy_common.h"
 
+#include "../Globals/Device.h"
 #include "../Globals/Plugins.h"
 #include "../Globals/Settings.h"
 
@@ -32,7 +33,10 @@ void PluginInit()
   {
     Plugin_ptr[x] = nullptr;
     DeviceIndex_to_Plugin_id[x] = INVALID_PLUGIN_ID;
-    // Do not initialize Plugin_id_to_DeviceIndex[x] to an invalid value. (it is map)
+  }
+
+  for (size_t i = 0; i < PLUGIN_ID_TABLE_SIZE; ++i) {
+    Plugin_id_to_DeviceIndex[i] = INVALID_DEVICE_INDEX;
   }
   uint32_t x = 0; // Used in ADDPLUGIN macro
 
@@ -1065,6 +1069,10 @@ void PluginInit()
   logMemUsageAfter(F("ADDPLUGIN(...)"));
 #endif
 
+  // The number of included plugins is known now.
+  // Allocate Device once, so it does not need to grow (and be copied) during PLUGIN_DEVICE_ADD.
+  Device.resize(x);
+
   String dummy;
   PluginCall(PLUGIN_DEVICE_ADD, nullptr, dummy);
     // Set all not supported plugins to disabled.
@@ -1083,6 +1091,5 @@ void PluginInit()
   logMemUsageAfter(F("PLUGIN_INIT_ALL"));
 #endif
 
-  sortDeviceIndexArray(); // Used in device selector dropdown.
 }
 
@@ -67,6 +67,22 @@
   }
 
 
+  void msecTimerHandlerStruct::extractDue(bool (*match)(unsigned long id), std::vector<timer_id_couple>& due, size_t maxItems) {
+    for (auto it = _timer_ids.begin(); it != _timer_ids.end() && due.size() < maxItems;) {
+      if (timePassedSince(it->_timer) < 0) {
+        // List is sorted on timer, so nothing after this one is due either.
+        return;
+      }
+
+      if (match(it->_id)) {
+        due.push_back(*it);
+        it = _timer_ids.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
   bool msecTimerHandlerStruct::getTimerForId(unsigned long id, unsigned long& timer) const {
     for (auto it = _timer_ids.begin(); it != _timer_ids.end(); ++it) {
       if (it->_id == id) {
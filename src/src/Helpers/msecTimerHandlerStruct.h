@@ -4,6 +4,7 @@
 
 #include <Arduino.h>
 #include <list>
+#include <vector>
 
 #include "../DataStructs/timer_id_couple.h"
 
@@ -20,6 +21,12 @@ struct msecTimerHandlerStruct {
   // Return 0 if no item has reached timeout moment.
   unsigned long getNextId(unsigned long& timer);
 
+  // Remove all items which have reached their timeout and for which match(id) returns true.
+  // These are appended to 'due' in order of their timer, until 'due' holds maxItems.
+  void extractDue(bool (*match)(unsigned long id),
+                  std::vector<timer_id_couple>& due,
+                  size_t                        maxItems);
+
   // Check if a give ID is scheduled and if so, return the set timer.
   // N.B. the ID is the mixed ID.
   bool   getTimerForId(unsigned long  id,
@@ -31,28 +31,28 @@ bool P004_data_struct::initiate_read() {
   _measurementStart = millis();
 
   for (uint8_t i = 0; i < 4; ++i) {
-    if (_sensors[i].initiate_read(_gpio_rx, _gpio_tx, _res)) {
-      if (!measurement_active()) {
-        // Set the timer right after initiating the first sensor
-
-
-        /*********************************************************************************************\
-        *  Dallas Start Temperature Conversion, expected max duration:
-        *    9 bits resolution ->  93.75 ms
-        *   10 bits resolution -> 187.5 ms
-        *   11 bits resolution -> 375 ms
-        *   12 bits resolution -> 750 ms
-        \*********************************************************************************************/
-        uint8_t res = _res;
-
-        if ((res < 9) || (res > 12)) { res = 12; }
-        _timer = millis() + (800 / (1 << (12 - res)));
-      }
+    if (_sensors[i].prepare_read(_gpio_rx, _gpio_tx, _res)) {
       _sensors[i].measurementActive = true;
     }
   }
 
-  return measurement_active();
+  if (!measurement_active()) {
+    return false;
+  }
+
+  // Start the conversion on all sensors on the bus at once,
+  // or share the conversion started by another task using the same bus.
+  if (!Dallas_startConversionAll(_gpio_rx, _gpio_tx, _res, _sweep, _timer)) {
+    for (uint8_t i = 0; i < 4; ++i) {
+      if (_sensors[i].measurementActive) {
+        ++_sensors[i].read_failed;
+        _sensors[i].lastReadError = true;
+      }
+    }
+    set_measurement_inactive();
+    return false;
+  }
+  return true;
 }
 
 bool P004_data_struct::collect_values() {
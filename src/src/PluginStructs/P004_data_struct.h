@@ -39,8 +39,8 @@ struct P004_data_struct : public PluginTaskData_base {
   void add_addr(const uint8_t addr[],
                 uint8_t       index);
 
-  // Send the start measuremnt command to all set sensors which have a non-zero address
-  // Their index determines the order in which the sensors receive this command.
+  // Start the measurement on all sensors on the bus, if any of the set sensors with a non-zero address is usable.
+  // A measurement started by another task on the same bus may be shared.
   bool initiate_read();
 
   bool collect_values();
@@ -86,6 +86,7 @@ private:
   int8_t          _gpio_rx = -1;
   int8_t          _gpio_tx = -1;
   uint8_t         _res  = 0;
+  uint32_t        _sweep = 0;
 };
 
 #endif // ifdef USES_P004
@@ -10,13 +10,8 @@
 # include "../Helpers/ESPEasy_Storage.h"
 # include "../Helpers/Misc.h"
 
-# define P020_RX_WAIT              PCONFIG(4)
-# define P020_RX_BUFFER            PCONFIG(7)
 
-
-P020_Task::P020_Task(taskIndex_t taskIndex) : _taskIndex(taskIndex) {
-  clearBuffer();
-}
+P020_Task::P020_Task(taskIndex_t taskIndex) : _taskIndex(taskIndex) {}
 
 P020_Task::~P020_Task() {
   stopServer();
@@ -108,18 +103,30 @@ void P020_Task::discardClientIn() {
   }
 }
 
-void P020_Task::clearBuffer() {
-  serial_buffer = String();
-  serial_buffer.reserve(P020_DATAGRAM_MAX_SIZE);
-}
-
-void P020_Task::serialBegin(const ESPEasySerialPort port, int16_t rxPin, int16_t txPin, unsigned long baud, uint8_t config) {
+void P020_Task::serialBegin(const ESPEasySerialPort port, int16_t rxPin, int16_t txPin, unsigned long baud, uint8_t config,
+                            uint16_t rxWait, uint16_t rxBufferSize) {
   serialEnd();
 
   if (rxPin >= 0) {
     ser2netSerial = new (std::nothrow) ESPeasySerial(port, rxPin, txPin);
 
-    if (nullptr != ser2netSerial) {
+    // A message ends when nothing was received for "RX Receive Timeout" msec.
+    SerialIngest_config_t ingestConfig;
+    ingestConfig.framing        = SerialIngest_framing_e::Idle;
+    ingestConfig.idleTimeout_ms = rxWait;
+
+    if (rxBufferSize < P020_DATAGRAM_MAX_SIZE) {
+      // Old settings may not have an RX buffer size set.
+      rxBufferSize = P020_DATAGRAM_MAX_SIZE;
+    }
+    serialIngest = new (std::nothrow) SerialIngest(ingestConfig, rxBufferSize);
+
+    if ((nullptr != serialIngest) && !serialIngest->isValid()) {
+      delete serialIngest;
+      serialIngest = nullptr;
+    }
+
+    if ((nullptr != ser2netSerial) && (nullptr != serialIngest)) {
         # if defined(ESP8266)
       ser2netSerial->begin(baud, (SerialConfig)config);
         # elif defined(ESP32)
@@ -131,9 +138,13 @@ void P020_Task::serialBegin(const ESPEasySerialPort port, int16_t rxPin, int16_t
 }
 
 void P020_Task::serialEnd() {
+  if (nullptr != serialIngest) {
+    delete serialIngest;
+    serialIngest = nullptr;
+  }
+
   if (nullptr != ser2netSerial) {
     delete ser2netSerial;
-    clearBuffer();
     ser2netSerial = nullptr;
     addLog(LOG_LEVEL_DEBUG, F("Ser2net   : Serial closed"));
   }
@@ -157,32 +168,22 @@ void P020_Task::handleClientIn(struct EventStruct *event) {
 }
 
 void P020_Task::handleSerialIn(struct EventStruct *event) {
-  if (nullptr == ser2netSerial) { return; }
-  int RXWait  = P020_RX_WAIT;
-  int timeOut = RXWait;
-
-  do {
-    if (ser2netSerial->available()) {
-      if (serial_buffer.length() > static_cast<size_t>(P020_RX_BUFFER)) {
-        addLog(LOG_LEVEL_DEBUG, F("Ser2Net   : Error: Buffer overflow, discarded input."));
-        ser2netSerial->read();
-      }
-      else { serial_buffer += (char)ser2netSerial->read(); }
-      timeOut = RXWait; // if serial received, reset timeout counter
-    } else {
-      if (timeOut <= 0) { break; }
-      delay(1);
-      --timeOut;
-    }
-  } while (true);
+  if ((nullptr == ser2netSerial) || (nullptr == serialIngest)) { return; }
+
+  // Do not wait for the RX timeout to pass, the frame is handed out on a later call.
+  serialIngest->fill(*ser2netSerial);
 
-  if (serial_buffer.length() > 0) {
-    ser2netClient.print(serial_buffer);
-    rulesEngine(serial_buffer);
+  SerialIngest_frame_t frame;
+
+  while (serialIngest->nextFrame(frame)) {
+    if (frame.truncated) {
+      addLog(LOG_LEVEL_DEBUG, F("Ser2Net   : RX buffer size reached, sending partial message."));
+    }
+    ser2netClient.write(reinterpret_cast<const uint8_t *>(frame.data), frame.length);
+    rulesEngine(frame);
     ser2netClient.flush();
-    clearBuffer();
     addLog(LOG_LEVEL_DEBUG, F("Ser2Net   : data send!"));
-  } // done
+  }
 }
 
 void P020_Task::discardSerialIn() {
@@ -191,12 +192,17 @@ void P020_Task::discardSerialIn() {
       ser2netSerial->read();
     }
   }
+
+  if (nullptr != serialIngest) {
+    serialIngest->clear();
+  }
 }
 
 // We can also use the rules engine for local control!
-void P020_Task::rulesEngine(String message) {
-  if (!(Settings.UseRules)) { return; }
-  int NewLinePos = message.indexOf(F("\r\n"));
+void P020_Task::rulesEngine(const SerialIngest_frame_t& frame) {
+  if (!(Settings.UseRules) || (serial_processing == 0)) { return; }
+  String message = frame.toString();
+  int    NewLinePos = message.indexOf(F("\r\n"));
 
   if (NewLinePos > 0) { message = message.substring(0, NewLinePos); }
   String eventString;
@@ -228,7 +234,7 @@ void P020_Task::rulesEngine(String message) {
 }
 
 bool P020_Task::isInit() const {
-  return nullptr != ser2netServer && nullptr != ser2netSerial;
+  return nullptr != ser2netServer && nullptr != ser2netSerial && nullptr != serialIngest;
 }
 
 void P020_Task::sendConnectedEvent(bool connected)
@@ -30,19 +30,19 @@ struct P020_Task : public PluginTaskData_base {
 
   void               discardClientIn();
 
-  void               clearBuffer();
-
   void               serialBegin(const ESPEasySerialPort port,
                                  int16_t                 rxPin,
                                  int16_t                 txPin,
                                  unsigned long           baud,
-                                 uint8_t                 config);
+                                 uint8_t                 config,
+                                 uint16_t                rxWait,
+                                 uint16_t                rxBufferSize);
 
   void serialEnd();
 
   void handleSerialIn(struct EventStruct *event);
   void handleClientIn(struct EventStruct *event);
-  void rulesEngine(String message);
+  void rulesEngine(const SerialIngest_frame_t& frame);
 
   void discardSerialIn();
 
@@ -54,11 +54,10 @@ struct P020_Task : public PluginTaskData_base {
   uint16_t       gatewayPort   = 0;
   WiFiClient     ser2netClient;
   bool           clientConnected = false;
-  String         serial_buffer;
-  String         net_buffer;
+  SerialIngest  *serialIngest      = nullptr;
   int            checkI            = 0;
   ESPeasySerial *ser2netSerial     = nullptr;
-  uint8_t           serial_processing = 0;
+  uint8_t        serial_processing = 0;
   taskIndex_t    _taskIndex = INVALID_TASK_INDEX;
 };
 
@@ -4,7 +4,7 @@
 
 P025_data_struct::P025_data_struct(uint8_t i2c_addr, uint8_t _pga, uint8_t _mux) : pga(_pga), mux(_mux), i2cAddress(i2c_addr) {}
 
-int16_t P025_data_struct::read() {
+bool P025_data_struct::startConversion(taskIndex_t taskIndex) {
   uint16_t config = (0x0003)    | // Disable the comparator (default val)
                     (0x0000)    | // Non-latching (default val)
                     (0x0000)    | // Alert/Rdy active low   (default val)
@@ -16,25 +16,25 @@ int16_t P025_data_struct::read() {
   config |= static_cast<uint16_t>(mux) << 12;
   config |= (0x8000); // Start a single conversion
 
-  Wire.beginTransmission(i2cAddress);
-  Wire.write((uint8_t)(0x01));
-  Wire.write((uint8_t)(config >> 8));
-  Wire.write((uint8_t)(config & 0xFF));
-  Wire.endTransmission();
+  const uint8_t cmd[] = {
+    0x01, // Config register
+    static_cast<uint8_t>(config >> 8),
+    static_cast<uint8_t>(config & 0xFF)
+  };
 
-  delay(9); // See https://github.com/letscontrolit/ESPEasy/issues/3159#issuecomment-660546091
-  return readRegister025(0x00);
+  // Read the conversion register after 9 msec.
+  // See https://github.com/letscontrolit/ESPEasy/issues/3159#issuecomment-660546091
+  return I2C_async_start(taskIndex, i2cAddress, cmd, sizeof(cmd), 0x00, 2, 9);
 }
 
-uint16_t P025_data_struct::readRegister025(uint8_t reg) {
-  Wire.beginTransmission(i2cAddress);
-  Wire.write((0x00));
-  Wire.endTransmission();
+bool P025_data_struct::getResult(taskIndex_t taskIndex, int16_t& value) {
+  uint8_t data[2] = { 0 };
 
-  if (Wire.requestFrom(i2cAddress, (uint8_t)2) != 2) {
-    return 0x8000;
+  if (!I2C_async_getResult(taskIndex, data, sizeof(data))) {
+    return false;
   }
-  return (Wire.read() << 8) | Wire.read();
+  value = static_cast<int16_t>((data[0] << 8) | data[1]);
+  return true;
 }
 
 #endif // ifdef USES_P025
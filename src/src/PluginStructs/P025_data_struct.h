@@ -4,6 +4,8 @@
 #include "../../_Plugin_Helper.h"
 #ifdef USES_P025
 
+# include "../Helpers/I2C_async.h"
+
 struct P025_data_struct : public PluginTaskData_base {
 public:
 
@@ -11,11 +13,16 @@ public:
                    uint8_t _pga,
                    uint8_t _mux);
 
-  int16_t read();
+  // Start a single conversion.
+  // The result is read by the scheduler after the conversion time, without blocking.
+  bool startConversion(taskIndex_t taskIndex);
 
-private:
+  // Fetch the result of the last conversion.
+  // Returns false when no result is available (yet).
+  bool getResult(taskIndex_t taskIndex,
+                 int16_t   & value);
 
-  uint16_t readRegister025(uint8_t reg);
+private:
 
   uint8_t pga; // Gain
   uint8_t mux; // Input multiplexer
@@ -13,10 +13,17 @@
 #define P044_RX_WAIT              PCONFIG(0)
 
 
-P044_Task::P044_Task() {
-  clearBuffer();
+static SerialIngest_config_t P044_ingestConfig(bool CRCcheck) {
+  SerialIngest_config_t config;
+
+  config.framing        = SerialIngest_framing_e::P1Telegram;
+  config.maxFrameLength = P044_DATAGRAM_MAX_SIZE - 2; // room for cr/lf
+  config.checkCRC       = CRCcheck;
+  return config;
 }
 
+P044_Task::P044_Task() : serialIngest(P044_ingestConfig(false), P044_DATAGRAM_MAX_SIZE) {}
+
 P044_Task::~P044_Task() {
   stopServer();
   serialEnd();
@@ -117,101 +124,11 @@ void P044_Task::checkBlinkLED() {
   }
 }
 
-void P044_Task::clearBuffer() {
-  if (serial_buffer.length() > maxMessageSize) {
-    maxMessageSize = _min(serial_buffer.length(), P044_DATAGRAM_MAX_SIZE);
+void P044_Task::setCRCcheck(bool enable) {
+  if (CRCcheck != enable) {
+    CRCcheck = enable;
+    serialIngest.setConfig(P044_ingestConfig(CRCcheck));
   }
-
-  serial_buffer = String();
-  serial_buffer.reserve(maxMessageSize);
-}
-
-void P044_Task::addChar(char ch) {
-  serial_buffer += ch;
-}
-
-/*  checkDatagram
-    checks whether the P044_CHECKSUM of the data received from P1 matches the P044_CHECKSUM
-    attached to the telegram
- */
-bool P044_Task::checkDatagram() const {
-  int endChar = serial_buffer.length() - 1;
-
-  if (CRCcheck) {
-    endChar -= P044_CHECKSUM_LENGTH;
-  }
-
-  if ((endChar < 0) || (serial_buffer[0] != P044_DATAGRAM_START_CHAR) ||
-      (serial_buffer[endChar] != P044_DATAGRAM_END_CHAR)) { return false; }
-
-  if (!CRCcheck) { return true; }
-
-  const int checksumStartIndex = endChar + 1;
-
-  #ifdef PLUGIN_044_DEBUG
-    for (unsigned int cnt = 0; cnt < serial_buffer.length(); ++cnt) {
-      serialPrint(serial_buffer.substring(cnt, 1));
-    }
-  #endif
-
-  // calculate the CRC and check if it equals the hexadecimal one attached to the datagram
-  unsigned int crc = CRC16(serial_buffer, checksumStartIndex);
-  return strtoul(serial_buffer.substring(checksumStartIndex).c_str(), nullptr, 16) == crc;
-}
-
-/*
-   CRC16
-      based on code written by Jan ten Hove
-     https://github.com/jantenhove/P1-Meter-ESP8266
- */
-unsigned int P044_Task::CRC16(const String& buf, int len)
-{
-  unsigned int crc = 0;
-
-  for (int pos = 0; pos < len; pos++)
-  {
-    crc ^= static_cast<const unsigned int>(buf[pos]); // XOR byte into least sig. byte of crc
-
-    for (int i = 8; i != 0; i--) {                    // Loop over each bit
-      if ((crc & 0x0001) != 0) {                      // If the LSB is set
-        crc >>= 1;                                    // Shift right and XOR 0xA001
-        crc  ^= 0xA001;
-      }
-      else {                                          // Else LSB is not set
-        crc >>= 1;                                    // Just shift right
-      }
-    }
-  }
-
-  return crc;
-}
-
-/*
-   validP1char
-       Checks if the character is valid as part of the P1 datagram contents and/or checksum.
-       Returns false on a datagram start ('/'), end ('!') or invalid character
- */
-bool P044_Task::validP1char(char ch) {
-  if (isAlphaNumeric(ch))
-  {
-    return true;
-  }
-
-  switch (ch) {
-    case '.':
-    case ' ':
-    case '\\': // Single backslash, but escaped in C++
-    case '\r':
-    case '\n':
-    case '(':
-    case ')':
-    case '-':
-    case '*':
-    case ':':
-    case '_':
-      return true;
-  }
-  return false;
 }
 
 void P044_Task::serialBegin(const ESPEasySerialPort port, int16_t rxPin, int16_t txPin,
@@ -230,7 +147,7 @@ void P044_Task::serialBegin(const ESPEasySerialPort port, int16_t rxPin, int16_t
       addLog(LOG_LEVEL_DEBUG, F("P1   : Serial opened"));
     }
   }
-  state = ParserState::WAITING;
+  serialIngest.clear();
 }
 
 void P044_Task::serialEnd() {
@@ -242,18 +159,22 @@ void P044_Task::serialEnd() {
 }
 
 void P044_Task::handleSerialIn(struct EventStruct *event) {
-  if (nullptr == P1EasySerial) { return; }
+  if ((nullptr == P1EasySerial) || !serialIngest.isValid()) { return; }
   int  RXWait  = P044_RX_WAIT;
   bool done    = false;
   int  timeOut = RXWait;
+  SerialIngest_frame_t frame;
+  const uint32_t       dropped = serialIngest.getFramesDropped();
 
   do {
-    if (P1EasySerial->available()) {
-      digitalWrite(P044_STATUS_LED, 1);
-      done = handleChar(P1EasySerial->read());
-      digitalWrite(P044_STATUS_LED, 0);
+    digitalWrite(P044_STATUS_LED, 1);
+    const size_t received = serialIngest.fill(*P1EasySerial);
+    done = serialIngest.nextFrame(frame);
+    digitalWrite(P044_STATUS_LED, 0);
 
-      if (done) { break; }
+    if (done) { break; }
+
+    if (received > 0) {
       timeOut = RXWait; // if serial received, reset timeout counter
     } else {
       if (timeOut <= 0) { break; }
@@ -262,8 +183,17 @@ void P044_Task::handleSerialIn(struct EventStruct *event) {
     }
   } while (true);
 
+  if (serialIngest.getFramesDropped() != dropped) {
+    addLog(LOG_LEVEL_DEBUG, CRCcheck ? F("P1   : Error: Invalid CRC or data, dropped data")
+                                     : F("P1   : Error: Invalid datagram, dropped data"));
+  }
+
   if (done) {
-    P1GatewayClient.print(serial_buffer);
+    P1GatewayClient.write(reinterpret_cast<const uint8_t *>(frame.data), frame.length);
+
+    // add the cr/lf pair to the datagram ahead of reading both
+    // from serial as the datagram has already been validated
+    P1GatewayClient.print(F("\r\n"));
     P1GatewayClient.flush();
 
     addLog(LOG_LEVEL_DEBUG, F("P1   : data send!"));
@@ -279,98 +209,13 @@ void P044_Task::handleSerialIn(struct EventStruct *event) {
   } // done
 }
 
-bool P044_Task::handleChar(char ch) {
-  if (serial_buffer.length() >= P044_DATAGRAM_MAX_SIZE - 2) { // room for cr/lf
-    addLog(LOG_LEVEL_DEBUG, F("P1   : Error: Buffer overflow, discarded input."));
-    state = ParserState::WAITING;                             // reset
-  }
-
-  bool done    = false;
-  bool invalid = false;
-
-  switch (state) {
-    case ParserState::WAITING:
-
-      if (ch == P044_DATAGRAM_START_CHAR)  {
-        clearBuffer();
-        addChar(ch);
-        state = ParserState::READING;
-      } // else ignore data
-      break;
-    case ParserState::READING:
-
-      if (validP1char(ch)) {
-        addChar(ch);
-      } else if (ch == P044_DATAGRAM_END_CHAR) {
-        addChar(ch);
-
-        if (CRCcheck) {
-          checkI = 0;
-          state  = ParserState::CHECKSUM;
-        } else {
-          done = true;
-        }
-      } else if (ch == P044_DATAGRAM_START_CHAR) {
-        addLog(LOG_LEVEL_DEBUG, F("P1   : Error: Start detected, discarded input."));
-        state = ParserState::WAITING; // reset
-        return handleChar(ch);
-      } else {
-        invalid = true;
-      }
-      break;
-    case ParserState::CHECKSUM:
-
-      if (validP1char(ch)) {
-        addChar(ch);
-        ++checkI;
-
-        if (checkI == P044_CHECKSUM_LENGTH) {
-          done = true;
-        }
-      } else {
-        invalid = true;
-      }
-      break;
-  } // switch
-
-  if (invalid) {
-    // input is not a datagram char
-    addLog(LOG_LEVEL_DEBUG, F("P1   : Error: DATA corrupt, discarded input."));
-
-    #ifdef PLUGIN_044_DEBUG
-      serialPrint(F("faulty char>"));
-      serialPrint(String(ch));
-      serialPrintln("<");
-    #endif
-    state = ParserState::WAITING; // reset
-  }
-
-  if (done) {
-    done = checkDatagram();
-
-    if (done) {
-      // add the cr/lf pair to the datagram ahead of reading both
-      // from serial as the datagram has already been validated
-      addChar('\r');
-      addChar('\n');
-    } else if (CRCcheck) {
-      addLog(LOG_LEVEL_DEBUG, F("P1   : Error: Invalid CRC, dropped data"));
-    } else {
-      addLog(LOG_LEVEL_DEBUG, F("P1   : Error: Invalid datagram, dropped data"));
-    }
-    state = ParserState::WAITING; // prepare for next one
-  }
-
-  return done;
-}
-
 void P044_Task::discardSerialIn() {
   if (nullptr != P1EasySerial) {
     while (P1EasySerial->available()) {
       P1EasySerial->read();
     }
   }
-  state = ParserState::WAITING;
+  serialIngest.clear();
 }
 
 bool P044_Task::isInit() const {
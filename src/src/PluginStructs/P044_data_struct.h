@@ -10,19 +10,10 @@
 // #define PLUGIN_044_DEBUG  // extra logging in serial out
 
 #define P044_STATUS_LED                    12
-#define P044_CHECKSUM_LENGTH               4
-#define P044_DATAGRAM_START_CHAR           '/'
-#define P044_DATAGRAM_END_CHAR             '!'
 #define P044_DATAGRAM_MAX_SIZE             2048u
 
 
 struct P044_Task : public PluginTaskData_base {
-  enum class ParserState : uint8_t {
-    WAITING,
-    READING,
-    CHECKSUM
-  };
-
   P044_Task();
 
   ~P044_Task();
@@ -44,30 +35,8 @@ struct P044_Task : public PluginTaskData_base {
 
   void                checkBlinkLED();
 
-  void                clearBuffer();
-
-  void                addChar(char ch);
-
-  /*  checkDatagram
-      checks whether the P044_CHECKSUM of the data received from P1 matches the P044_CHECKSUM
-      attached to the telegram
-   */
-  bool                checkDatagram() const;
-
-  /*
-     CRC16
-        based on code written by Jan ten Hove
-       https://github.com/jantenhove/P1-Meter-ESP8266
-   */
-  static unsigned int CRC16(const String& buf,
-                            int           len);
-
-  /*
-     validP1char
-         Checks if the character is valid as part of the P1 datagram contents and/or checksum.
-         Returns false on a datagram start ('/'), end ('!') or invalid character
-   */
-  static bool validP1char(char ch);
+  // Enable checking the CRC16 attached to the telegram (DSMR 4+)
+  void                setCRCcheck(bool enable);
 
   void        serialBegin(const ESPEasySerialPort port,
                           int16_t       rxPin,
@@ -79,8 +48,6 @@ struct P044_Task : public PluginTaskData_base {
 
   void handleSerialIn(struct EventStruct *event);
 
-  bool handleChar(char ch);
-
   void discardSerialIn();
 
   bool isInit() const;
@@ -89,13 +56,10 @@ struct P044_Task : public PluginTaskData_base {
   uint16_t       gatewayPort     = 0;
   WiFiClient     P1GatewayClient;
   bool           clientConnected = false;
-  String         serial_buffer;
-  ParserState    state             = ParserState::WAITING;
-  int            checkI            = 0;
+  SerialIngest   serialIngest;
   boolean        CRCcheck          = false;
   ESPeasySerial *P1EasySerial      = nullptr;
   unsigned long  blinkLEDStartTime = 0;
-  size_t         maxMessageSize    = P044_DATAGRAM_MAX_SIZE / 4;
 };
 
 #endif
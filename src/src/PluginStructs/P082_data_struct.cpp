@@ -62,6 +62,146 @@ const __FlashStringHelper* toString(P082_DynamicModel model) {
   return F("");
 }
 
+P082_track_t::~P082_track_t() {
+  init(0);
+}
+
+bool P082_track_t::init(uint8_t size) {
+  delete[] _points;
+  delete[] _keep;
+  _points = nullptr;
+  _keep   = nullptr;
+  _size   = 0;
+  clear();
+
+  if (size == 0) {
+    return true;
+  }
+  _points = new (std::nothrow) P082_track_point_t[size];
+  _keep   = new (std::nothrow) uint8_t[3 * size];
+
+  if ((_points == nullptr) || (_keep == nullptr)) {
+    init(0);
+    return false;
+  }
+  _size = size;
+  return true;
+}
+
+void P082_track_t::clear() {
+  _head  = 0;
+  _count = 0;
+}
+
+void P082_track_t::add(const P082_track_point_t& point) {
+  if (_size == 0) {
+    return;
+  }
+
+  if (_count < _size) {
+    _points[(_head + _count) % _size] = point;
+    ++_count;
+  } else {
+    // Full, overwrite the oldest
+    _points[_head] = point;
+    _head          = (_head + 1) % _size;
+  }
+}
+
+const P082_track_point_t& P082_track_t::get(uint8_t index) const {
+  return _points[(_head + index) % _size];
+}
+
+bool P082_track_t::keep(uint8_t index) const {
+  return index < _count && _keep[index] != 0;
+}
+
+uint8_t P082_track_t::simplify(float tolerance_m) {
+  if (_count == 0) {
+    return 0;
+  }
+  memset(_keep, 0, _count);
+  _keep[0]          = 1;
+  _keep[_count - 1] = 1;
+
+  if (_count > 2) {
+    const float cosLat = cosf(static_cast<float>(get(0).lat_e7) * (1e-7f * static_cast<float>(M_PI) / 180.0f));
+
+    // Iterative, using a stack of (first, last) pairs instead of recursion.
+    uint8_t *stack = _keep + _size;
+    size_t   sp    = 0;
+    stack[sp++] = 0;
+    stack[sp++] = _count - 1;
+
+    while (sp > 0) {
+      const uint8_t last  = stack[--sp];
+      const uint8_t first = stack[--sp];
+      float   maxDistance = 0.0f;
+      uint8_t index       = first;
+
+      for (uint8_t i = first + 1; i < last; ++i) {
+        const float distance = distanceToSegment(get(i), get(first), get(last), cosLat);
+
+        if (distance > maxDistance) {
+          maxDistance = distance;
+          index       = i;
+        }
+      }
+
+      if (maxDistance > tolerance_m) {
+        _keep[index] = 1;
+
+        if ((index - first) > 1) {
+          stack[sp++] = first;
+          stack[sp++] = index;
+        }
+
+        if ((last - index) > 1) {
+          stack[sp++] = index;
+          stack[sp++] = last;
+        }
+      }
+    }
+  }
+
+  uint8_t kept = 0;
+
+  for (uint8_t i = 0; i < _count; ++i) {
+    if (_keep[i] != 0) {
+      ++kept;
+    }
+  }
+  return kept;
+}
+
+float P082_track_t::distanceToSegment(const P082_track_point_t& p,
+                                      const P082_track_point_t& a,
+                                      const P082_track_point_t& b,
+                                      float                     cosLat) {
+  // Length of 10^-7 degree latitude in meters
+  constexpr float meters_per_e7 = 0.0111319491f;
+
+  const float bx = static_cast<float>(static_cast<int64_t>(b.lng_e7) - a.lng_e7) * meters_per_e7 * cosLat;
+  const float by = static_cast<float>(static_cast<int64_t>(b.lat_e7) - a.lat_e7) * meters_per_e7;
+  const float px = static_cast<float>(static_cast<int64_t>(p.lng_e7) - a.lng_e7) * meters_per_e7 * cosLat;
+  const float py = static_cast<float>(static_cast<int64_t>(p.lat_e7) - a.lat_e7) * meters_per_e7;
+
+  const float length2 = bx * bx + by * by;
+  float t             = 0.0f;
+
+  if (length2 > 0.0f) {
+    t = (px * bx + py * by) / length2;
+
+    if (t < 0.0f) { t = 0.0f; }
+
+    if (t > 1.0f) { t = 1.0f; }
+  }
+  const float dx = px - t * bx;
+  const float dy = py - t * by;
+
+  return sqrtf(dx * dx + dy * dy);
+}
+
 P082_data_struct::P082_data_struct() : gps(nullptr), easySerial(nullptr) {}
 
 P082_data_struct::~P082_data_struct() {
@@ -79,6 +219,11 @@ void P082_data_struct::reset() {
     delete easySerial;
     easySerial = nullptr;
   }
+
+  if (serialIngest != nullptr) {
+    delete serialIngest;
+    serialIngest = nullptr;
+  }
 }
 
 bool P082_data_struct::init(ESPEasySerialPort port, const int16_t serial_rx, const int16_t serial_tx) {
@@ -89,6 +234,10 @@ bool P082_data_struct::init(ESPEasySerialPort port, const int16_t serial_rx, con
   gps        = new (std::nothrow) TinyGPSPlus();
   easySerial = new (std::nothrow) ESPeasySerial(port, serial_rx, serial_tx);
 
+  SerialIngest_config_t config;
+  config.framing = SerialIngest_framing_e::NMEA_UBX;
+  serialIngest   = new (std::nothrow) SerialIngest(config, P082_INGEST_BUFFER_SIZE);
+
   if (easySerial != nullptr) {
     easySerial->begin(9600);
     wakeUp();
@@ -96,99 +245,160 @@ bool P082_data_struct::init(ESPEasySerialPort port, const int16_t serial_rx, con
   return isInitialized();
 }
 
+bool P082_data_struct::initTrack(uint8_t size) {
+  if (size > P082_TRACK_MAX_SIZE) {
+    size = P082_TRACK_MAX_SIZE;
+  }
+  return track.init(size);
+}
+
 bool P082_data_struct::isInitialized() const {
-  return gps != nullptr && easySerial != nullptr;
+  return gps != nullptr && easySerial != nullptr && serialIngest != nullptr && serialIngest->isValid();
 }
 
 bool P082_data_struct::loop() {
   if (!isInitialized()) {
     return false;
   }
-  bool completeSentence = false;
+  bool completeSentence   = false;
+  unsigned long startLoop = millis();
 
-  if (easySerial != nullptr) {
-    int available           = easySerial->available();
-    unsigned long startLoop = millis();
+  serialIngest->fill(*easySerial);
+  SerialIngest_frame_t frame;
 
-    while (available > 0 && timePassedSince(startLoop) < 10) {
-      --available;
-      int c = easySerial->read();
-      if (c >= 0) {
-# ifdef P082_SEND_GPS_TO_LOG
-        if (_currentSentence.length() <= 80) {
-          // No need to capture more than 80 bytes as a NMEA message is never that long.
-          if (c != 0) {
-            _currentSentence += static_cast<char>(c);
-          }
-        }
-# endif // ifdef P082_SEND_GPS_TO_LOG
+  while (timePassedSince(startLoop) < 10 && serialIngest->nextFrame(frame)) {
+    if (frame.isUBX()) {
+      processUBX(frame);
+    } else if (processNMEA(frame)) {
+      completeSentence = true;
+    }
+  }
+  return completeSentence;
+}
 
-        if (c == 0x85) {
-          // Found possible start of u-blox message
-          unsigned long timeout = millis() + 200;
-          unsigned int bytesRead = 0;
-          bool done = false;
-          bool ack_nak_read = false;
-          while (!timeOutReached(timeout) && !done)
-          {
-            if (available == 0) {
-              available = easySerial->available();
-            } else {
-              const int c = easySerial->read();
-              if (c >= 0) {
-                switch (bytesRead) {
-                  case 0:
-                    if (c != 0x62) {
-                      done = true;
-                    }
-                    ++bytesRead;
-                    break;
-                  case 1:
-                    if (c != 0x05) {
-                      done = true;
-                    }
-                    ++bytesRead;
-                    break;
-                  case 2:
-                    if (c == 0x01) {
-                      ack_nak_read = true;
-                      addLog(LOG_LEVEL_INFO, F("GPS  : ACK-ACK"));
-                    } else if (c == 0x00) {
-                      ack_nak_read = true;
-                      addLog(LOG_LEVEL_ERROR, F("GPS  : ACK-NAK"));
-                    }
-                    done = true;
-                    break;
-                  default:
-                    done = true;                    
-                    break;
-                }
-              }
-            }
-          }
-          if (!done) {
-            addLog(LOG_LEVEL_ERROR, F("GPS  : Ack/Nack timeout"));
-          } else if (!ack_nak_read) {
-            addLog(LOG_LEVEL_ERROR, F("GPS  : Unexpected reply"));
-          }
-        }
+// NMEA sentences decoded by TinyGPS++, any talker ID starting with 'G'.
+// Other sentences are skipped, so their characters are not processed one by one.
+static bool P082_isDecodedSentence(const SerialIngest_frame_t& frame) {
+  if ((frame.length < 7) || (frame.data[1] != 'G') || (frame.data[6] != ',')) {
+    return false;
+  }
+  const char *type = frame.data + 3;
+
+  return memcmp(type, "GGA", 3) == 0 ||
+         memcmp(type, "RMC", 3) == 0 ||
+         memcmp(type, "GSA", 3) == 0 ||
+         memcmp(type, "GSV", 3) == 0 ||
+         memcmp(type, "GLL", 3) == 0 ||
+         memcmp(type, "TXT", 3) == 0;
+}
+
+bool P082_data_struct::processNMEA(const SerialIngest_frame_t& frame) {
+  if (!P082_isDecodedSentence(frame)) {
+    ++_sentencesSkipped;
+    return false;
+  }
 
-        if (gps->encode(c)) {
-          // Full sentence received
+  for (uint16_t i = 0; i < frame.length; ++i) {
+    gps->encode(frame.data[i]);
+  }
+
+  if (!gps->encode('\r')) {
+    return false;
+  }
 # ifdef P082_SEND_GPS_TO_LOG
-          _lastSentence    = _currentSentence;
-          _currentSentence = String();
+
+  if (loglevelActiveFor(LOG_LEVEL_INFO)) {
+    _lastSentence = frame.toString();
+  }
 # endif // ifdef P082_SEND_GPS_TO_LOG
-          completeSentence = true;
-        } else {
-          if (available == 0) {
-            available = easySerial->available();
-          }
-        }
-      }
+  addNMEAFixToTrack();
+  return true;
+}
+
+static int32_t P082_toE7(const RawDegrees& raw) {
+  const int32_t value = static_cast<int32_t>(raw.deg) * 10000000 + static_cast<int32_t>(raw.billionths / 100);
+
+  return raw.negative ? -value : value;
+}
+
+void P082_data_struct::addNMEAFixToTrack() {
+  if (!track.isEnabled() || !gps->location.isValid() || (gps->location.age() > P082_TIMESTAMP_AGE)) {
+    return;
+  }
+
+  if ((_last_ubx_fix != 0) && (timePassedSince(_last_ubx_fix) < P082_UBX_FIX_TIMEOUT)) {
+    // Receiver also sends UBX NAV-PVT, which is used for the track.
+    return;
+  }
+
+  // Work on copies, as reading the values clears the 'updated' flag used in PLUGIN_READ.
+  TinyGPSTime time = gps->time;
+  const uint32_t fixTime = time.value();
+
+  if (fixTime == _last_track_time) {
+    // Same epoch, e.g. GGA and RMC of the same fix.
+    return;
+  }
+  _last_track_time = fixTime;
+
+  TinyGPSLocation location = gps->location;
+  TinyGPSAltitude altitude = gps->altitude;
+  TinyGPSSpeed    speed    = gps->speed;
+
+  P082_track_point_t point;
+  point.lat_e7    = P082_toE7(location.rawLat());
+  point.lng_e7    = P082_toE7(location.rawLng());
+  point.altitude  = altitude.meters();
+  point.speed     = speed.mps();
+  point.timestamp = millis();
+  track.add(point);
+}
+
+// Little endian values in UBX payload, which may not be aligned.
+static uint16_t P082_ubx_uint16(const uint8_t *data) {
+  return data[0] | (data[1] << 8);
+}
+
+static int32_t P082_ubx_int32(const uint8_t *data) {
+  return static_cast<int32_t>(
+    static_cast<uint32_t>(data[0]) |
+    (static_cast<uint32_t>(data[1]) << 8) |
+    (static_cast<uint32_t>(data[2]) << 16) |
+    (static_cast<uint32_t>(data[3]) << 24));
+}
+
+void P082_data_struct::processUBX(const SerialIngest_frame_t& frame) {
+  const uint8_t *data     = reinterpret_cast<const uint8_t *>(frame.data);
+  const uint8_t  msgClass = data[2];
+  const uint8_t  msgId    = data[3];
+  const uint16_t length   = P082_ubx_uint16(data + 4);
+  const uint8_t *payload  = data + 6;
+
+  if (msgClass == 0x05) {
+    if (msgId == 0x01) {
+      addLog(LOG_LEVEL_INFO, F("GPS  : ACK-ACK"));
+    } else if (msgId == 0x00) {
+      addLog(LOG_LEVEL_ERROR, F("GPS  : ACK-NAK"));
+    }
+    return;
+  }
+
+  if ((msgClass == 0x01) && (msgId == 0x07) && (length >= 92)) {
+    // UBX-NAV-PVT
+    const uint8_t fixType   = payload[20];
+    const bool    gnssFixOK = (payload[21] & 0x01) != 0;
+
+    if (gnssFixOK && (fixType >= 2) && (fixType <= 4)) {
+      P082_track_point_t point;
+      point.lng_e7    = P082_ubx_int32(payload + 24);
+      point.lat_e7    = P082_ubx_int32(payload + 28);
+      point.altitude  = P082_ubx_int32(payload + 36) / 1000.0f; // hMSL in mm
+      point.speed     = P082_ubx_int32(payload + 60) / 1000.0f; // gSpeed in mm/s
+      point.timestamp = millis();
+      track.add(point);
+      _last_ubx_fix = point.timestamp;
     }
   }
-  return completeSentence;
 }
 
 bool P082_data_struct::hasFix(unsigned int maxAge_msec) {
@@ -198,6 +408,13 @@ bool P082_data_struct::hasFix(unsigned int maxAge_msec) {
   return gps->location.isValid() && gps->location.age() < maxAge_msec;
 }
 
+uint32_t P082_data_struct::failedChecksum() const {
+  if (!isInitialized()) {
+    return 0;
+  }
+  return gps->failedChecksum() + serialIngest->getFramesDropped();
+}
+
 bool P082_data_struct::storeCurPos(unsigned int maxAge_msec) {
   if (!hasFix(maxAge_msec)) {
     return false;
@@ -7,6 +7,8 @@
 # include <TinyGPS++.h>
 # include <ESPeasySerial.h>
 
+# include "../Helpers/SerialIngest.h"
+
 #ifndef LIMIT_BUILD_SIZE
 # define P082_SEND_GPS_TO_LOG
 //# define P082_USE_U_BLOX_SPECIFIC // TD-er: Disabled for now, as it is not working reliable/predictable
@@ -15,6 +17,10 @@
 # define P082_TIMESTAMP_AGE       1500
 # define P082_DEFAULT_FIX_TIMEOUT 2500 // TTL of fix status in ms since last update
 
+# define P082_INGEST_BUFFER_SIZE  512  // Fits the longest NMEA sentence and common UBX messages
+# define P082_UBX_FIX_TIMEOUT     2000 // Prefer UBX NAV-PVT fixes for the track when received within this time
+# define P082_TRACK_MAX_SIZE      100
+
 
 enum class P082_query : uint8_t {
   P082_QUERY_LONG        = 0,
@@ -61,6 +67,66 @@ enum class P082_DynamicModel : uint8_t {
 
 const __FlashStringHelper* toString(P082_DynamicModel model);
 
+
+struct P082_track_point_t {
+  int32_t  lat_e7    = 0; // Degrees * 10^7
+  int32_t  lng_e7    = 0; // Degrees * 10^7
+  float    altitude  = 0.0f;
+  float    speed     = 0.0f;
+  uint32_t timestamp = 0; // millis() when the fix was received
+};
+
+// Ring buffer of timestamped fixes.
+// All memory is allocated in init(), when full the oldest fix is overwritten.
+struct P082_track_t {
+  ~P082_track_t();
+
+  bool init(uint8_t size);
+
+  void clear();
+
+  void add(const P082_track_point_t& point);
+
+  bool isEnabled() const {
+    return _size > 0;
+  }
+
+  uint8_t count() const {
+    return _count;
+  }
+
+  bool isFull() const {
+    return _size > 0 && _count == _size;
+  }
+
+  // @param index  0 = oldest fix
+  const P082_track_point_t& get(uint8_t index) const;
+
+  // Douglas-Peucker track simplification.
+  // Marks the fixes needed to describe the track within tolerance_m meters.
+  // First and last fix are always kept.
+  // @retval Number of fixes kept.
+  uint8_t simplify(float tolerance_m);
+
+  bool    keep(uint8_t index) const;
+
+private:
+
+  // Distance in meters of point p to the segment a - b
+  // Uses a flat projection, which is accurate enough for the short distances in a track.
+  static float distanceToSegment(const P082_track_point_t& p,
+                                 const P082_track_point_t& a,
+                                 const P082_track_point_t& b,
+                                 float                     cosLat);
+
+  P082_track_point_t *_points = nullptr;
+  uint8_t            *_keep   = nullptr; // Keep flags, followed by the stack used while simplifying
+  uint8_t             _size   = 0;
+  uint8_t             _head   = 0;       // Position of the oldest fix
+  uint8_t             _count  = 0;
+};
+
+
 struct P082_data_struct : public PluginTaskData_base {
 
   // Enum is being stored, so don't change int values
@@ -76,12 +142,19 @@ struct P082_data_struct : public PluginTaskData_base {
             const int16_t     serial_rx,
             const int16_t     serial_tx);
 
+  // Allocate the track buffer.
+  // @param size  Max. number of fixes, 0 = no track recording
+  bool initTrack(uint8_t size);
+
   bool isInitialized() const;
 
   bool loop();
 
   bool hasFix(unsigned int maxAge_msec);
 
+  // Checksum errors seen by TinyGPS++ and frames dropped by the serial ingest.
+  uint32_t failedChecksum() const;
+
   bool storeCurPos(unsigned int maxAge_msec);
 
   // Return the distance in meters compared to last stored position.
@@ -121,10 +194,20 @@ private:
 #endif
 
   bool writeToGPS(const uint8_t* data, size_t size);
+
+  // Feed a NMEA sentence to TinyGPS++
+  // @retval true when it was a valid sentence
+  bool processNMEA(const SerialIngest_frame_t& frame);
+
+  void processUBX(const SerialIngest_frame_t& frame);
+
+  void addNMEAFixToTrack();
 public:
 
-  TinyGPSPlus   *gps        = nullptr;
-  ESPeasySerial *easySerial = nullptr;
+  TinyGPSPlus   *gps          = nullptr;
+  ESPeasySerial *easySerial   = nullptr;
+  SerialIngest  *serialIngest = nullptr;
+  P082_track_t   track;
 
   double _last_lat = 0.0;
   double _last_lng = 0.0;
@@ -136,9 +219,11 @@ public:
 
   unsigned long _pps_time         = 0;
   unsigned long _last_measurement = 0;
+  unsigned long _last_ubx_fix     = 0;
+  uint32_t      _last_track_time  = 0; // NMEA time of the last fix added to the track
+  uint32_t      _sentencesSkipped = 0; // NMEA sentences not decoded by TinyGPS++
 # ifdef P082_SEND_GPS_TO_LOG
   String _lastSentence;
-  String _currentSentence;
 # endif // ifdef P082_SEND_GPS_TO_LOG
 
   float _cache[static_cast<uint8_t>(P082_query::P082_NR_OUTPUT_OPTIONS)] = { 0 };
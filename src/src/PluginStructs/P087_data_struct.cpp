@@ -9,7 +9,8 @@
 
 #ifdef USES_P087
 
-#include <vector>
+#include <ctype.h>
+#include <string.h>
 
 P087_data_struct::P087_data_struct() :  easySerial(nullptr) {}
 
@@ -22,6 +23,22 @@ void P087_data_struct::reset() {
     delete easySerial;
     easySerial = nullptr;
   }
+
+  if (serialIngest != nullptr) {
+    delete serialIngest;
+    serialIngest = nullptr;
+  }
+}
+
+SerialIngest_config_t P087_data_struct::ingestConfig() const {
+  SerialIngest_config_t config;
+
+  // Sentences end with CR, LF is ignored.
+  config.framing        = SerialIngest_framing_e::Line;
+  config.terminator     = '\r';
+  config.ignore         = '\n';
+  config.maxFrameLength = max_length;
+  return config;
 }
 
 bool P087_data_struct::init(ESPEasySerialPort port, const int16_t serial_rx, const int16_t serial_tx, unsigned long baudrate) {
@@ -29,7 +46,8 @@ bool P087_data_struct::init(ESPEasySerialPort port, const int16_t serial_rx, con
     return false;
   }
   reset();
-  easySerial = new (std::nothrow) ESPeasySerial(port, serial_rx, serial_tx);
+  easySerial   = new (std::nothrow) ESPeasySerial(port, serial_rx, serial_tx);
+  serialIngest = new (std::nothrow) SerialIngest(ingestConfig(), P087_INGEST_BUFFER_SIZE);
 
   if (isInitialized()) {
     easySerial->begin(baudrate);
@@ -38,6 +56,49 @@ bool P087_data_struct::init(ESPEasySerialPort port, const int16_t serial_rx, con
   return false;
 }
 
+// Get the literal characters at the start of a (Lua style) regex.
+// A sentence can only match when it contains these characters.
+static String P087_getLiteralPrefix(const String& regex, bool& anchored) {
+  String prefix;
+  const char *pattern = regex.c_str();
+  size_t i            = 0;
+
+  anchored = pattern[0] == '^';
+
+  if (anchored) {
+    ++i;
+  }
+
+  while (pattern[i] != 0) {
+    char   ch   = pattern[i];
+    size_t next = i + 1;
+
+    if (ch == REGEXP_ESC) {
+      // Escaped punctuation is a literal, %a, %d, etc. are character classes
+      if ((pattern[next] == 0) || isalnum(static_cast<unsigned char>(pattern[next]))) {
+        break;
+      }
+      ch = pattern[next];
+      ++next;
+    } else if ((ch == ')') || (strchr(REGEXP_SPECIALS, ch) != nullptr)) {
+      break;
+    }
+    const char quantifier = pattern[next];
+
+    if ((quantifier == '*') || (quantifier == '?') || (quantifier == '-')) {
+      // Character is optional
+      break;
+    }
+    prefix += ch;
+
+    if (quantifier == '+') {
+      break;
+    }
+    i = next;
+  }
+  return prefix;
+}
+
 void P087_data_struct::post_init() {
   for (uint8_t i = 0; i < P87_MAX_CAPTURE_INDEX; ++i) {
     capture_index_used[i] = false;
@@ -48,6 +109,7 @@ void P087_data_struct::post_init() {
   for (uint8_t i = 0; i < P087_NR_FILTERS; ++i) {
     // Create some quick lookup table to see if we have a filter for the specific index
     capture_index_must_not_match[i] = _lines[i * 3 + P087_FIRST_FILTER_POS + 1].toInt() == P087_Filter_Comp::NotEqual;
+    capture_filter_used[i]          = false;
     int index = _lines[i * 3 + P087_FIRST_FILTER_POS].toInt();
 
     // Index is negative when not used.
@@ -58,13 +120,18 @@ void P087_data_struct::post_init() {
       log                      += String(index);
       capture_index[i]          = index;
       capture_index_used[index] = true;
+      capture_filter_used[i]    = true;
     }
   }
   addLogMove(LOG_LEVEL_DEBUG, log);
+
+  match_type          = getMatchType();
+  regexp_match_length = getRegExpMatchLength();
+  regex_prefix        = P087_getLiteralPrefix(_lines[P087_REGEX_POS], regex_anchored);
 }
 
 bool P087_data_struct::isInitialized() const {
-  return easySerial != nullptr;
+  return easySerial != nullptr && serialIngest != nullptr && serialIngest->isValid();
 }
 
 void P087_data_struct::sendString(const String& data) {
@@ -88,50 +155,15 @@ bool P087_data_struct::loop() {
   }
   bool fullSentenceReceived = false;
 
-  if (easySerial != nullptr) {
-    int available = easySerial->available();
-
-    while (available > 0 && !fullSentenceReceived) {
-      // Look for end marker
-      char c = easySerial->read();
-      --available;
+  serialIngest->fill(*easySerial);
+  SerialIngest_frame_t frame;
 
-      if (available == 0) {
-        available = easySerial->available();
-        delay(0);
-      }
-
-      switch (c) {
-        case 13:
-        {
-          const size_t length = sentence_part.length();
-          bool valid          = length > 0;
-
-          for (size_t i = 0; i < length && valid; ++i) {
-            if ((sentence_part[i] > 127) || (sentence_part[i] < 32)) {
-              sentence_part = String();
-              ++sentences_received_error;
-              valid = false;
-            }
-          }
-
-          if (valid) {
-            fullSentenceReceived = true;
-            last_sentence = sentence_part;
-            sentence_part = String();
-          }
-          break;
-        }
-        case 10:
-
-          // Ignore LF
-          break;
-        default:
-          sentence_part += c;
-          break;
-      }
-
-      if (max_length_reached()) { fullSentenceReceived = true; }
+  while (!fullSentenceReceived && serialIngest->nextFrame(frame)) {
+    if (frame.isPrintableASCII()) {
+      fullSentenceReceived = true;
+      last_sentence        = frame.toString();
+    } else {
+      ++sentences_received_error;
     }
   }
 
@@ -159,6 +191,10 @@ void P087_data_struct::getSentencesReceived(uint32_t& succes, uint32_t& error, u
 
 void P087_data_struct::setMaxLength(uint16_t maxlenght) {
   max_length = maxlenght;
+
+  if (serialIngest != nullptr) {
+    serialIngest->setConfig(ingestConfig());
+  }
 }
 
 void P087_data_struct::setLine(uint8_t varNr, const String& line) {
@@ -184,7 +220,7 @@ P087_Match_Type P087_data_struct::getMatchType() const {
 }
 
 bool P087_data_struct::invertMatch() const {
-  switch (getMatchType()) {
+  switch (match_type) {
     case Regular_Match:          // fallthrough
     case Global_Match:
       break;
@@ -198,7 +234,7 @@ bool P087_data_struct::invertMatch() const {
 }
 
 bool P087_data_struct::globalMatch() const {
-  switch (getMatchType()) {
+  switch (match_type) {
     case Regular_Match: // fallthrough
     case Regular_Match_inverted:
       break;
@@ -241,20 +277,68 @@ bool P087_data_struct::disableFilterWindowActive() const {
   return false;
 }
 
-typedef std::pair<uint8_t, String> capture_tuple;
-static std::vector<capture_tuple> capture_vector;
+// Context for match_callback, as the callback does not have a user argument.
+static const P087_data_struct *P087_match_context  = nullptr;
+static bool                    P087_match_found    = false;
+static bool                    P087_match_rejected = false;
 
 
 // called for each match
 void P087_data_struct::match_callback(const char *match, const unsigned int length, const MatchState& ms)
 {
-  for (uint8_t i = 0; i < ms.level; i++)
-  {
-    capture_tuple tuple;
-    tuple.first  = i;
-    tuple.second = ms.GetCapture(i);
-    capture_vector.push_back(tuple);
-  } // end of for each capture
+  if (P087_match_context != nullptr) {
+    P087_match_context->checkCaptures(ms, P087_match_found, P087_match_rejected);
+  }
+}
+
+void P087_data_struct::checkCaptures(const MatchState& ms, bool& found, bool& rejected) const
+{
+  for (int i = 0; i < ms.level && i < P87_MAX_CAPTURE_INDEX; ++i) {
+    if (!capture_index_used[i]) {
+      continue;
+    }
+    const char *capture = ms.capture[i].init;
+    const int   length  = ms.capture[i].len;
+
+    for (uint8_t n = 0; n < P087_NR_FILTERS; ++n) {
+      if (!capture_filter_used[n] || (capture_index[n] != i)) {
+        continue;
+      }
+
+      // Found a Capture Filter with this capture index.
+      const String& filter = _lines[n * 3 + P087_FIRST_FILTER_POS + 2];
+      const bool    match  = (length > 0) &&
+                             (static_cast<size_t>(length) == filter.length()) &&
+                             (strncmp(capture, filter.c_str(), length) == 0);
+
+      if (match) {
+        // Found a match. Now check if it is supposed to be one or not.
+        if (capture_index_must_not_match[n]) {
+          rejected = true;
+        } else {
+          found = true;
+        }
+      }
+
+      #ifndef BUILD_NO_DEBUG
+      if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
+        String log;
+        log.reserve(32);
+        log  = F("P087: Index: ");
+        log += i;
+        log += F(" Found ");
+        log += ms.GetCapture(i);
+        log += match ? F(" Matches") : F(" No Match");
+        log += capture_index_must_not_match[n] ? F(" (!=) ") : F(" (==) ");
+
+        if (!match) {
+          log += filter;
+        }
+        addLogMove(LOG_LEVEL_DEBUG, log);
+      }
+      #endif // ifndef BUILD_NO_DEBUG
+    }
+  }
 }
 
 bool P087_data_struct::matchRegexp(String& received) const {
@@ -263,69 +347,39 @@ bool P087_data_struct::matchRegexp(String& received) const {
   if (strlength == 0) {
     return false;
   }
-  if (regex_empty || getMatchType() == Filter_Disabled) {
+  if (regex_empty || match_type == Filter_Disabled) {
     return true;
   }
 
-
-  uint32_t regexp_match_length = getRegExpMatchLength();
-
   if ((regexp_match_length > 0) && (strlength > regexp_match_length)) {
     strlength = regexp_match_length;
   }
 
+  // Quick checks to reject sentences which can never match the regex.
+  const size_t prefix_length = regex_prefix.length();
+
+  if (strlength < prefix_length) {
+    return false;
+  }
+
+  if (regex_anchored && (prefix_length > 0) &&
+      (strncmp(received.c_str(), regex_prefix.c_str(), prefix_length) != 0)) {
+    return false;
+  }
+
   // We need to do a const_cast here, but this only is valid as long as we
   // don't call a replace function from regexp.
   MatchState ms(const_cast<char *>(received.c_str()), strlength);
 
   bool match_result = false;
   if (globalMatch()) {
-    capture_vector.clear();
+    P087_match_context  = this;
+    P087_match_found    = false;
+    P087_match_rejected = false;
     ms.GlobalMatch(_lines[P087_REGEX_POS].c_str(), match_callback);
-    const uint8_t vectorlength = capture_vector.size();
-
-    for (uint8_t i = 0; i < vectorlength; ++i) {
-      if ((capture_vector[i].first < P87_MAX_CAPTURE_INDEX) && capture_index_used[capture_vector[i].first]) {
-        for (uint8_t n = 0; n < P087_NR_FILTERS; ++n) {
-          unsigned int lines_index = n * 3 + P087_FIRST_FILTER_POS + 2;
-
-          if ((capture_index[n] == capture_vector[i].first) && !(_lines[lines_index].isEmpty())) {
-            String log;
-            log.reserve(32);
-            log  = F("P087: Index: ");
-            log += capture_vector[i].first;
-            log += F(" Found ");
-            log += capture_vector[i].second;
-
-            // Found a Capture Filter with this capture index.
-            if (capture_vector[i].second == _lines[lines_index]) {
-              log += F(" Matches");
-
-              // Found a match. Now check if it is supposed to be one or not.
-              if (capture_index_must_not_match[n]) {
-                log += F(" (!=)");
-                addLogMove(LOG_LEVEL_INFO, log);
-                return false;
-              } else {
-                match_result = true;
-                log         += F(" (==)");
-              }
-            } else {
-              log += F(" No Match");
-
-              if (capture_index_must_not_match[n]) {
-                log += F(" (!=) ");
-              } else {
-                log += F(" (==) ");
-              }
-              log += _lines[lines_index];
-            }
-            addLogMove(LOG_LEVEL_INFO, log);
-          }
-        }
-      }
-    }
-    capture_vector.clear();
+    P087_match_context = nullptr;
+
+    match_result = P087_match_found && !P087_match_rejected;
   } else {
     char result = ms.Match(_lines[P087_REGEX_POS].c_str());
 
@@ -357,9 +411,4 @@ const __FlashStringHelper * P087_data_struct::MatchType_toString(P087_Match_Type
   return F("");
 }
 
-bool P087_data_struct::max_length_reached() const {
-  if (max_length == 0) { return false; }
-  return sentence_part.length() >= max_length;
-}
-
 #endif // USES_P087
@@ -20,6 +20,7 @@
 # define P87_Nlines              (P087_FIRST_FILTER_POS + 3 * (P087_NR_FILTERS))
 # define P87_Nchars              128
 # define P87_MAX_CAPTURE_INDEX   32
+# define P087_INGEST_BUFFER_SIZE 1024
 
 
 enum P087_Filter_Comp {
@@ -99,6 +100,11 @@ public:
                              const unsigned int length,
                              const MatchState & ms);
 
+  // Check the captures of a match against the capture filters, without copying them.
+  void          checkCaptures(const MatchState& ms,
+                              bool            & found,
+                              bool            & rejected) const;
+
   bool          matchRegexp(String& received) const;
 
   static const __FlashStringHelper * MatchType_toString(P087_Match_Type matchType);
@@ -109,10 +115,10 @@ public:
 
 private:
 
-  bool max_length_reached() const;
+  SerialIngest_config_t ingestConfig() const;
 
   ESPeasySerial *easySerial = nullptr;
-  String         sentence_part;
+  SerialIngest  *serialIngest = nullptr;
   String         last_sentence;
   uint16_t       max_length               = 550;
   uint32_t       sentences_received       = 0;
@@ -124,7 +130,14 @@ private:
 
   bool capture_index_used[P87_MAX_CAPTURE_INDEX] = { 0 };
   bool capture_index_must_not_match[P87_MAX_CAPTURE_INDEX] = { 0 };
+  bool capture_filter_used[P087_NR_FILTERS] = { 0 };
   bool regex_empty = false;
+
+  // Compiled settings, to avoid parsing them for every received sentence
+  String          regex_prefix; // Literal start of the regex, to reject sentences before running the regex
+  P087_Match_Type match_type          = Regular_Match;
+  uint16_t        regexp_match_length = 0;
+  bool            regex_anchored      = false;
 };
 
 
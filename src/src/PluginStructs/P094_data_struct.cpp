@@ -10,6 +10,8 @@
 #include "../Globals/ESPEasy_time.h"
 #include "../Helpers/StringConverter.h"
 
+#include <string.h>
+
 
 P094_data_struct::P094_data_struct() :  easySerial(nullptr) {}
 
@@ -22,6 +24,22 @@ void P094_data_struct::reset() {
     delete easySerial;
     easySerial = nullptr;
   }
+
+  if (serialIngest != nullptr) {
+    delete serialIngest;
+    serialIngest = nullptr;
+  }
+}
+
+SerialIngest_config_t P094_data_struct::ingestConfig() const {
+  SerialIngest_config_t config;
+
+  // Sentences end with CR, LF is ignored.
+  config.framing        = SerialIngest_framing_e::Line;
+  config.terminator     = '\r';
+  config.ignore         = '\n';
+  config.maxFrameLength = max_length;
+  return config;
 }
 
 bool P094_data_struct::init(ESPEasySerialPort port, 
@@ -32,7 +50,8 @@ bool P094_data_struct::init(ESPEasySerialPort port,
     return false;
   }
   reset();
-  easySerial = new (std::nothrow) ESPeasySerial(port, serial_rx, serial_tx);
+  easySerial   = new (std::nothrow) ESPeasySerial(port, serial_rx, serial_tx);
+  serialIngest = new (std::nothrow) SerialIngest(ingestConfig(), P094_INGEST_BUFFER_SIZE);
 
   if (isInitialized()) {
     easySerial->begin(baudrate);
@@ -55,17 +74,34 @@ void P094_data_struct::post_init() {
     const bool valid_filter_comp      = tmp_filter_comp >= 0 && tmp_filter_comp < P094_FILTER_COMP_NR_ELEMENTS;
 
     valueType_index[i] = P094_not_used;
+    filter_used[i]     = false;
+    filter_value[i]    = 0;
 
     if (valid_index && valid_filter_comp && filter_string_notempty) {
       valueType_used[index] = true;
       valueType_index[i]    = static_cast<P094_Filter_Value_Type>(index);
       filter_comp[i]        = static_cast<P094_Filter_Comp>(tmp_filter_comp);
+
+      if (valueType_index[i] == P094_Filter_Value_Type::P094_position) {
+        filter_value[i] = _lines[lines_baseindex + 1].toInt();
+      } else {
+        filter_value[i] = hexToUL(_lines[lines_baseindex + 3]);
+      }
+      filter_used[i] = valueType_index[i] != P094_Filter_Value_Type::P094_not_used;
+    }
+  }
+  any_filter_used = false;
+
+  for (uint8_t i = 0; i < P094_NR_FILTERS; ++i) {
+    if (filter_used[i]) {
+      any_filter_used = true;
     }
   }
+  match_type = getMatchType();
 }
 
 bool P094_data_struct::isInitialized() const {
-  return easySerial != nullptr;
+  return easySerial != nullptr && serialIngest != nullptr && serialIngest->isValid();
 }
 
 void P094_data_struct::sendString(const String& data) {
@@ -89,52 +125,15 @@ bool P094_data_struct::loop() {
   }
   bool fullSentenceReceived = false;
 
-  if (easySerial != nullptr) {
-    int available = easySerial->available();
-
-    unsigned long timeout = millis() + 10;
-
-    while (available > 0 && !fullSentenceReceived) {
-      // Look for end marker
-      char c = easySerial->read();
-      --available;
-
-      if (available == 0) {
-        if (!timeOutReached(timeout)) {
-          available = easySerial->available();
-        }
-        delay(0);
-      }
-
-      switch (c) {
-        case 13:
-        {
-          const size_t length = sentence_part.length();
-          bool valid          = length > 0;
-
-          for (size_t i = 0; i < length && valid; ++i) {
-            if ((sentence_part[i] > 127) || (sentence_part[i] < 32)) {
-              sentence_part = String();
-              ++sentences_received_error;
-              valid = false;
-            }
-          }
-
-          if (valid) {
-            fullSentenceReceived = true;
-          }
-          break;
-        }
-        case 10:
-
-          // Ignore LF
-          break;
-        default:
-          sentence_part += c;
-          break;
-      }
+  serialIngest->fill(*easySerial);
+  SerialIngest_frame_t frame;
 
-      if (max_length_reached()) { fullSentenceReceived = true; }
+  while (!fullSentenceReceived && serialIngest->nextFrame(frame)) {
+    if (frame.isPrintableASCII()) {
+      fullSentenceReceived = true;
+      sentence_part        = frame.toString();
+    } else {
+      ++sentences_received_error;
     }
   }
 
@@ -170,6 +169,10 @@ void P094_data_struct::getSentencesReceived(uint32_t& succes, uint32_t& error, u
 
 void P094_data_struct::setMaxLength(uint16_t maxlenght) {
   max_length = maxlenght;
+
+  if (serialIngest != nullptr) {
+    serialIngest->setConfig(ingestConfig());
+  }
 }
 
 void P094_data_struct::setLine(uint8_t varNr, const String& line) {
@@ -187,7 +190,7 @@ P094_Match_Type P094_data_struct::getMatchType() const {
 }
 
 bool P094_data_struct::invertMatch() const {
-  switch (getMatchType()) {
+  switch (match_type) {
     case P094_Regular_Match:
       break;
     case P094_Regular_Match_inverted:
@@ -200,9 +203,8 @@ bool P094_data_struct::invertMatch() const {
 
 bool P094_data_struct::filterUsed(uint8_t lineNr) const
 {
-  if (valueType_index[lineNr] == P094_Filter_Value_Type::P094_not_used) { return false; }
-  uint8_t varNr = P094_Get_filter_base_index(lineNr);
-  return _lines[varNr + 3].length() > 0;
+  if (lineNr >= P094_NR_FILTERS) { return false; }
+  return filter_used[lineNr];
 }
 
 String P094_data_struct::getFilter(uint8_t lineNr, P094_Filter_Value_Type& filterValueType, uint32_t& optional,
@@ -241,184 +243,217 @@ bool P094_data_struct::disableFilterWindowActive() const {
   return false;
 }
 
+// Parse a hex field of the received packet, without allocating a String.
+// Same result as hexToUL(received, start, nrHexDecimals) for plain hex data.
+static unsigned long P094_parseHexField(const char *data, size_t length, size_t start, size_t nrHexDecimals) {
+  unsigned long result = 0;
+
+  if (nrHexDecimals > 8) {
+    nrHexDecimals = 8;
+  }
+
+  for (size_t i = start; i < length && i < (start + nrHexDecimals); ++i) {
+    const char ch = data[i];
+    uint8_t    nibble;
+
+    if ((ch >= '0') && (ch <= '9')) {
+      nibble = ch - '0';
+    } else if ((ch >= 'a') && (ch <= 'f')) {
+      nibble = ch - 'a' + 10;
+    } else if ((ch >= 'A') && (ch <= 'F')) {
+      nibble = ch - 'A' + 10;
+    } else {
+      break;
+    }
+    result = (result << 4) | nibble;
+  }
+  return result;
+}
+
 bool P094_data_struct::parsePacket(const String& received) const {
-  size_t strlength = received.length();
+  const size_t strlength = received.length();
 
   if (strlength == 0) {
     return false;
   }
 
 
-  if (getMatchType() == P094_Filter_Disabled) {
+  if (match_type == P094_Filter_Disabled) {
     return true;
   }
 
-  bool match_result = false;
+  const char *data = received.c_str();
 
   // FIXME TD-er: For now added '$' to test with GPS.
-  if ((received[0] == 'b') || (received[0] == '$')) {
-    // Received a data packet in CUL format.
-    if (strlength < 21) {
-      return false;
+  if ((data[0] != 'b') && (data[0] != '$')) {
+    switch (data[0]) {
+      case 'C': // CMODE
+      case 'S': // SMODE
+      case 'T': // TMODE
+      case 'O': // OFF
+      case 'V': // Version info
+
+        // FIXME TD-er: Must test the result of the other possible answers.
+        return true;
     }
+    return false;
+  }
 
-    // Decoded packet
-
-    unsigned long packet_header[P094_FILTER_VALUE_Type_NR_ELEMENTS];
-    packet_header[P094_packet_length] = hexToUL(received, 1, 2);
-    packet_header[P094_unknown1]      = hexToUL(received, 3, 2);
-    packet_header[P094_manufacturer]  = hexToUL(received, 5, 4);
-    packet_header[P094_serial_number] = hexToUL(received, 9, 8);
-    packet_header[P094_unknown2]      = hexToUL(received, 17, 2);
-    packet_header[P094_meter_type]    = hexToUL(received, 19, 2);
-
-    // FIXME TD-er: Is this also correct?
-    packet_header[P094_rssi] = hexToUL(received, strlength - 4, 4);
-
-    // FIXME TD-er: Is this correct?
-    // match_result = packet_length == (strlength - 21) / 2;
-
-    if (loglevelActiveFor(LOG_LEVEL_INFO)) {
-      String log;
-      if (log.reserve(128)) {
-        log  = F("CUL Reader: ");
-        log += F(" length: ");
-        log += packet_header[P094_packet_length];
-        log += F(" (header: ");
-        log += strlength - (packet_header[P094_packet_length] * 2);
-        log += F(") manu: ");
-        log += formatToHex_decimal(packet_header[P094_manufacturer]);
-        log += F(" serial: ");
-        log += formatToHex_decimal(packet_header[P094_serial_number]);
-        log += F(" mType: ");
-        log += formatToHex_decimal(packet_header[P094_meter_type]);
-        log += F(" RSSI: ");
-        log += formatToHex_decimal(packet_header[P094_rssi]);
-        addLogMove(LOG_LEVEL_INFO, log);
-      }
+  // Received a data packet in CUL format.
+  if ((strlength < 21) || !any_filter_used) {
+    // Without any filter set, no filter block can match.
+    return false;
+  }
+
+  // Decoded packet
+  unsigned long packet_header[P094_FILTER_VALUE_Type_NR_ELEMENTS] = { 0 };
+  packet_header[P094_packet_length] = P094_parseHexField(data, strlength, 1, 2);
+  packet_header[P094_unknown1]      = P094_parseHexField(data, strlength, 3, 2);
+  packet_header[P094_manufacturer]  = P094_parseHexField(data, strlength, 5, 4);
+  packet_header[P094_serial_number] = P094_parseHexField(data, strlength, 9, 8);
+  packet_header[P094_unknown2]      = P094_parseHexField(data, strlength, 17, 2);
+  packet_header[P094_meter_type]    = P094_parseHexField(data, strlength, 19, 2);
+
+  // FIXME TD-er: Is this also correct?
+  packet_header[P094_rssi] = P094_parseHexField(data, strlength, strlength - 4, 4);
+
+  // FIXME TD-er: Is this correct?
+  // match_result = packet_length == (strlength - 21) / 2;
+
+  #ifndef BUILD_NO_DEBUG
+  if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
+    String log;
+    if (log.reserve(128)) {
+      log  = F("CUL Reader: ");
+      log += F(" length: ");
+      log += packet_header[P094_packet_length];
+      log += F(" (header: ");
+      log += strlength - (packet_header[P094_packet_length] * 2);
+      log += F(") manu: ");
+      log += formatToHex_decimal(packet_header[P094_manufacturer]);
+      log += F(" serial: ");
+      log += formatToHex_decimal(packet_header[P094_serial_number]);
+      log += F(" mType: ");
+      log += formatToHex_decimal(packet_header[P094_meter_type]);
+      log += F(" RSSI: ");
+      log += formatToHex_decimal(packet_header[P094_rssi]);
+      addLogMove(LOG_LEVEL_DEBUG, log);
     }
+  }
+  #endif // ifndef BUILD_NO_DEBUG
 
-    bool filter_matches[P094_NR_FILTERS];
+  bool filter_matches[P094_NR_FILTERS] = { 0 };
 
+  // Check the "must" filters first, as they may reject the packet right away.
+  for (uint8_t pass = 0; pass < 2; ++pass) {
     for (unsigned int f = 0; f < P094_NR_FILTERS; ++f) {
-      filter_matches[f] = false;
-    }
+      if (!filter_used[f]) {
+        continue;
+      }
+      const P094_Filter_Comp comparator = filter_comp[f];
+      const bool mustFilter             = (comparator == P094_Filter_Comp::P094_Equal_MUST) ||
+                                          (comparator == P094_Filter_Comp::P094_NotEqual_MUST);
 
-    // Do not check for "not used" (0)
-    for (unsigned int i = 1; i < P094_FILTER_VALUE_Type_NR_ELEMENTS; ++i) {
-      if (valueType_used[i]) {
-        for (unsigned int f = 0; f < P094_NR_FILTERS; ++f) {
-          if (valueType_index[f] == i) {
-            // Have a matching filter
-
-            uint32_t optional;
-            P094_Filter_Value_Type filterValueType;
-            P094_Filter_Comp comparator;
-            bool   match = false;
-            String inputString;
-            String valueString;
-
-            if (i == P094_Filter_Value_Type::P094_position) {
-              valueString = getFilter(f, filterValueType, optional, comparator);
-
-              if (received.length() >= (optional + valueString.length())) {
-                // received string is long enough to fit the expression.
-                inputString = received.substring(optional, optional + valueString.length());
-                match = inputString.equalsIgnoreCase(valueString);
-              }
-            } else {
-              unsigned long value = hexToUL(getFilter(f, filterValueType, optional, comparator));
-              match       = (value == packet_header[i]);
-              inputString = formatToHex_decimal(packet_header[i]);
-              valueString = formatToHex_decimal(value);
-            }
-
-
-            if (loglevelActiveFor(LOG_LEVEL_INFO)) {
-              String log;
-              if (log.reserve(64)) {
-                log  = F("CUL Reader: ");
-                log += P094_FilterValueType_toString(valueType_index[f]);
-                log += F(":  in:");
-                log += inputString;
-                log += ' ';
-                log += P094_FilterComp_toString(comparator);
-                log += ' ';
-                log += valueString;
-
-                switch (comparator) {
-                  case P094_Filter_Comp::P094_Equal_OR:
-                  case P094_Filter_Comp::P094_Equal_MUST:
-
-                    if (match) { log += F(" expected MATCH"); } 
-                    break;
-                  case P094_Filter_Comp::P094_NotEqual_OR:
-                  case P094_Filter_Comp::P094_NotEqual_MUST:
-
-                    if (!match) { log += F(" expected NO MATCH"); }
-                    break;
-                }
-                addLogMove(LOG_LEVEL_INFO, log);
-              }
-            }
-
-            switch (comparator) {
-              case P094_Filter_Comp::P094_Equal_OR:
-
-                if (match) { filter_matches[f] = true; }
-                break;
-              case P094_Filter_Comp::P094_NotEqual_OR:
-
-                if (!match) { filter_matches[f] = true; }
-                break;
-
-              case P094_Filter_Comp::P094_Equal_MUST:
-
-                if (!match) { return false; }
-                break;
-
-              case P094_Filter_Comp::P094_NotEqual_MUST:
-
-                if (match) { return false; }
-                break;
-            }
-          }
-        }
+      if (mustFilter != (pass == 0)) {
+        continue;
       }
-    }
+      bool match = false;
 
-    // Now we have to check if all rows per filter line in filter_matches[f] are true or not used.
-    int nrMatches = 0;
-    int nrNotUsed = 0;
+      if (valueType_index[f] == P094_Filter_Value_Type::P094_position) {
+        const String& valueString = _lines[P094_Get_filter_base_index(f) + 3];
+        const size_t  position    = filter_value[f];
 
-    for (unsigned int f = 0; !match_result && f < P094_NR_FILTERS; ++f) {
-      if (f % P094_AND_FILTER_BLOCK == 0) {
-        if ((nrMatches > 0) && ((nrMatches + nrNotUsed) == P094_AND_FILTER_BLOCK)) {
-          match_result = true;
+        if (strlength >= (position + valueString.length())) {
+          // received string is long enough to fit the expression.
+          match = strncasecmp(data + position, valueString.c_str(), valueString.length()) == 0;
         }
-        nrMatches = 0;
-        nrNotUsed = 0;
+      } else {
+        match = (filter_value[f] == packet_header[valueType_index[f]]);
       }
 
-      if (filter_matches[f]) {
-        ++nrMatches;
-      } else {
-        if (!filterUsed(f)) {
-          ++nrNotUsed;
+      #ifndef BUILD_NO_DEBUG
+      if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
+        String log;
+        if (log.reserve(64)) {
+          log  = F("CUL Reader: ");
+          log += P094_FilterValueType_toString(valueType_index[f]);
+          log += F(":  in:");
+
+          if (valueType_index[f] == P094_Filter_Value_Type::P094_position) {
+            const String& valueString = _lines[P094_Get_filter_base_index(f) + 3];
+            log += received.substring(filter_value[f], filter_value[f] + valueString.length());
+            log += ' ';
+            log += P094_FilterComp_toString(comparator);
+            log += ' ';
+            log += valueString;
+          } else {
+            log += formatToHex_decimal(packet_header[valueType_index[f]]);
+            log += ' ';
+            log += P094_FilterComp_toString(comparator);
+            log += ' ';
+            log += formatToHex_decimal(filter_value[f]);
+          }
+
+          switch (comparator) {
+            case P094_Filter_Comp::P094_Equal_OR:
+            case P094_Filter_Comp::P094_Equal_MUST:
+
+              if (match) { log += F(" expected MATCH"); }
+              break;
+            case P094_Filter_Comp::P094_NotEqual_OR:
+            case P094_Filter_Comp::P094_NotEqual_MUST:
+
+              if (!match) { log += F(" expected NO MATCH"); }
+              break;
+          }
+          addLogMove(LOG_LEVEL_DEBUG, log);
         }
       }
+      #endif // ifndef BUILD_NO_DEBUG
+
+      switch (comparator) {
+        case P094_Filter_Comp::P094_Equal_OR:
+
+          if (match) { filter_matches[f] = true; }
+          break;
+        case P094_Filter_Comp::P094_NotEqual_OR:
+
+          if (!match) { filter_matches[f] = true; }
+          break;
+
+        case P094_Filter_Comp::P094_Equal_MUST:
+
+          if (!match) { return false; }
+          break;
+
+        case P094_Filter_Comp::P094_NotEqual_MUST:
+
+          if (match) { return false; }
+          break;
+      }
     }
-  } else {
-    switch (received[0]) {
-      case 'C': // CMODE
-      case 'S': // SMODE
-      case 'T': // TMODE
-      case 'O': // OFF
-      case 'V': // Version info
+  }
 
-        // FIXME TD-er: Must test the result of the other possible answers.
+  // Now we have to check if all rows per filter line in filter_matches[f] are true or not used.
+  bool match_result = false;
+  int  nrMatches    = 0;
+  int  nrNotUsed    = 0;
+
+  for (unsigned int f = 0; !match_result && f < P094_NR_FILTERS; ++f) {
+    if (f % P094_AND_FILTER_BLOCK == 0) {
+      if ((nrMatches > 0) && ((nrMatches + nrNotUsed) == P094_AND_FILTER_BLOCK)) {
         match_result = true;
-        break;
+      }
+      nrMatches = 0;
+      nrNotUsed = 0;
+    }
+
+    if (filter_matches[f]) {
+      ++nrMatches;
+    } else {
+      if (!filter_used[f]) {
+        ++nrNotUsed;
+      }
     }
   }
 
@@ -464,11 +499,6 @@ const __FlashStringHelper * P094_data_struct::P094_FilterComp_toString(P094_Filt
   return F("");
 }
 
-bool P094_data_struct::max_length_reached() const {
-  if (max_length == 0) { return false; }
-  return sentence_part.length() >= max_length;
-}
-
 size_t P094_data_struct::P094_Get_filter_base_index(size_t filterLine) {
   return filterLine * P094_ITEMS_PER_FILTER + P094_FIRST_FILTER_POS;
 }
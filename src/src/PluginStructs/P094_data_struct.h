@@ -21,6 +21,7 @@
 # define P94_Nlines              (P094_FIRST_FILTER_POS + (P094_ITEMS_PER_FILTER * (P094_NR_FILTERS)))
 # define P94_Nchars              128
 # define P94_MAX_CAPTURE_INDEX   32
+# define P094_INGEST_BUFFER_SIZE 1024
 
 
 enum P094_Match_Type {
@@ -67,6 +68,8 @@ public:
             const int16_t serial_tx,
             unsigned long baudrate);
 
+  // Called after loading the config from the settings.
+  // Compiles the filters, so they don't need to be parsed for every received packet.
   void post_init();
 
   bool isInitialized() const;
@@ -123,9 +126,10 @@ public:
 
 private:
 
-  bool max_length_reached() const;
+  SerialIngest_config_t ingestConfig() const;
 
   ESPeasySerial *easySerial = nullptr;
+  SerialIngest  *serialIngest = nullptr;
   String         sentence_part;
   uint16_t       max_length               = 550;
   uint32_t       sentences_received       = 0;
@@ -137,6 +141,12 @@ private:
   bool                   valueType_used[P094_FILTER_VALUE_Type_NR_ELEMENTS] = {0};
   P094_Filter_Value_Type valueType_index[P094_NR_FILTERS];
   P094_Filter_Comp       filter_comp[P094_NR_FILTERS];
+
+  // Compiled filters
+  P094_Match_Type        match_type = P094_Regular_Match;
+  uint32_t               filter_value[P094_NR_FILTERS]    = { 0 }; // Numerical value or position
+  bool                   filter_used[P094_NR_FILTERS]     = { 0 };
+  bool                   any_filter_used                  = false;
 };
 
 
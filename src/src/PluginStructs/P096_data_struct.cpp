@@ -264,7 +264,8 @@ bool P096_data_struct::plugin_read(struct EventStruct *event) {
 
       eInkScreen->clearBuffer();
 
-      int yPos = 0;
+      int  yPos    = 0;
+      bool changed = false;
 
       for (uint8_t x = 0; x < P096_Nlines; x++) {
         String newString = AdaGFXparseTemplate(strings[x], _textcols, gfxHelper);
@@ -274,6 +275,10 @@ bool P096_data_struct::plugin_read(struct EventStruct *event) {
         #  endif // if ADAGFX_PARSE_SUBCOMMAND
 
         if (yPos < _ypix) {
+          // Always draw into the buffer, as it is cleared, but track if anything changed
+          if (gfxHelper->isLineChanged(x, newString, yPos, _fgcolor, _bgcolor, _fontscaling)) {
+            changed = true;
+          }
           gfxHelper->printText(newString.c_str(), 0, yPos, _fontscaling, _fgcolor, _bgcolor);
         }
         delay(0);
@@ -285,7 +290,9 @@ bool P096_data_struct::plugin_read(struct EventStruct *event) {
       UserVar[event->BaseVarIndex]     = curX;                                               // and put into Values
       UserVar[event->BaseVarIndex + 1] = curY;
 
-      eInkScreen->display();
+      if (changed) { // A full eInk refresh takes seconds, skip it when the content is still the same
+        eInkScreen->display();
+      }
       eInkScreen->clearBuffer();
     }
   }
@@ -303,6 +310,10 @@ bool P096_data_struct::plugin_write(struct EventStruct *event, const String& str
   if ((nullptr != eInkScreen) && cmd.equals(_commandTriggerCmd)) {
     String arg1 = parseString(string, 2);
 
+    if (nullptr != gfxHelper) {
+      gfxHelper->invalidateLines(); // Screen content may be changed, redraw all lines on next read
+    }
+
     if (arg1.equals(F("off"))) { // Not supported 'on' and 'off' as commands
       success = false;
     }
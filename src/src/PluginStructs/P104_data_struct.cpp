@@ -607,22 +607,24 @@ void P104_data_struct::updateZone(uint8_t                 zone,
  * Enable/Disable updating a range of modules
  **********************************************/
 void P104_data_struct::modulesOnOff(uint8_t start, uint8_t end, MD_MAX72XX::controlValue_t on_off) {
-  for (uint8_t m = start; m <= end; m++) {
-    pM->control(m, MD_MAX72XX::UPDATE, on_off);
-  }
+  // UPDATE is a library-wide setting, switching it on flushes all changed rows of all modules at once,
+  // so only call it once instead of once per module
+  pM->control(start, end, MD_MAX72XX::UPDATE, on_off);
 }
 
 /********************************************************
  * draw a single bar-graph, arguments already adjusted for direction
+ * Pixels are set in columns, 1 byte per column from lower to upper, bit = row
  *******************************************************/
-void P104_data_struct::drawOneBarGraph(uint16_t lower,
-                                       uint16_t upper,
-                                       int16_t  pixBottom,
-                                       int16_t  pixTop,
-                                       uint16_t zeroPoint,
-                                       uint8_t  barWidth,
-                                       uint8_t  barType,
-                                       uint8_t  row) {
+void P104_data_struct::drawOneBarGraph(std::vector<uint8_t>& columns,
+                                       uint16_t              lower,
+                                       uint16_t              upper,
+                                       int16_t               pixBottom,
+                                       int16_t               pixTop,
+                                       uint16_t              zeroPoint,
+                                       uint8_t               barWidth,
+                                       uint8_t               barType,
+                                       uint8_t               row) {
   bool on_off;
 
   for (uint8_t r = 0; r < barWidth; r++) {
@@ -644,11 +646,11 @@ void P104_data_struct::drawOneBarGraph(uint16_t lower,
       if ((barType == P104_BARTYPE_ALT_DOT) && (barWidth > 1) && on_off) {
         on_off = ((r % 2) == (col % 2)); // barType 2 = dotted line when bar is wider than 1 pixel
       }
-      pM->setPoint(row + r, col, on_off);
 
-      if (col % 16 == 0) { delay(0); }
+      if (on_off) {
+        columns[col - lower] |= (1 << (row + r));
+      }
     }
-    delay(0); // Leave some breathingroom
   }
 }
 
@@ -777,15 +779,11 @@ void P104_data_struct::displayBarGraph(uint8_t                 zone,
     P->setIntensity(zstruct.zone - 1, zstruct.brightness); // don't forget to set the brightness
     uint8_t row = 0;
 
-    if ((barGraphs.size() == 3) || (barGraphs.size() == 5) || (barGraphs.size() == 6)) { // Center within the rows a bit
-      for (; row < (barGraphs.size() == 5 ? 2 : 1); row++) {
-        for (uint8_t col = zstruct._lower; col <= zstruct._upper; col++) {
-          pM->setPoint(row, col, false);                                                 // all off
+    // The graph is built in a column buffer first, unused rows stay off
+    std::vector<uint8_t> columns(zstruct._upper - zstruct._lower + 1, 0u);
 
-          if (col % 16 == 0) { delay(0); }
-        }
-        delay(0); // Leave some breathingroom
-      }
+    if ((barGraphs.size() == 3) || (barGraphs.size() == 5) || (barGraphs.size() == 6)) { // Center within the rows a bit
+      row = (barGraphs.size() == 5 ? 2 : 1);
     }
 
     for (auto it = barGraphs.begin(); it != barGraphs.end(); ++it) {
@@ -826,18 +824,22 @@ void P104_data_struct::displayBarGraph(uint8_t                 zone,
         log += zeroPoint;
       }
       #  endif // ifdef P104_DEBUG_DEV
-      drawOneBarGraph(zstruct._lower, zstruct._upper, pixBottom, pixTop, zeroPoint, barWidth, it->barType, row);
+      drawOneBarGraph(columns, zstruct._lower, zstruct._upper, pixBottom, pixTop, zeroPoint, barWidth, it->barType, row);
       row += barWidth; // Next set of rows
       delay(0); // Leave some breathingroom
     }
 
-    for (; row < 8; row++) {           // Clear unused rows
-      for (uint8_t col = zstruct._lower; col <= zstruct._upper; col++) {
-        pM->setPoint(row, col, false); // all off
+    // Only write the columns that differ from the display buffer, so the
+    // flush when updates are enabled again only sends the changed rows/modules
+    for (uint16_t col = zstruct._lower; col <= zstruct._upper; col++) {
+      const uint8_t buf = col / COL_SIZE;
+      const uint8_t c   = col % COL_SIZE;
 
-        if (col % 16 == 0) { delay(0); }
+      if (pM->getColumn(buf, c) != columns[col - zstruct._lower]) {
+        pM->setColumn(buf, c, columns[col - zstruct._lower]);
       }
-      delay(0); // Leave some breathingroom
+
+      if (col % 16 == 0) { delay(0); }
     }
     #  ifdef P104_DEBUG
 
@@ -392,14 +392,15 @@ private:
   void modulesOnOff(uint8_t                    start,
                     uint8_t                    end,
                     MD_MAX72XX::controlValue_t on_off);
-  void drawOneBarGraph(uint16_t lower,
-                       uint16_t upper,
-                       int16_t  pixBottom,
-                       int16_t  pixTop,
-                       uint16_t zeroPoint,
-                       uint8_t  barWidth,
-                       uint8_t  barType,
-                       uint8_t  row);
+  void drawOneBarGraph(std::vector<uint8_t>& columns,
+                       uint16_t              lower,
+                       uint16_t              upper,
+                       int16_t               pixBottom,
+                       int16_t               pixTop,
+                       uint16_t              zeroPoint,
+                       uint8_t               barWidth,
+                       uint8_t               barType,
+                       uint8_t               row);
   # endif // ifdef P104_USE_BAR_GRAPH
 
   void   displayOneZoneText(uint8_t                 currentZone,
@@ -314,7 +314,7 @@ bool P116_data_struct::plugin_read(struct EventStruct *event) {
         updateFontMetrics();
         # endif // if ADAGFX_PARSE_SUBCOMMAND
 
-        if (yPos < _ypix) {
+        if ((yPos < _ypix) && gfxHelper->isLineChanged(x, newString, yPos, _fgcolor, _bgcolor, _fontscaling)) {
           gfxHelper->printText(newString.c_str(), 0, yPos, _fontscaling, _fgcolor, _bgcolor);
         }
         delay(0);
@@ -365,6 +365,10 @@ bool P116_data_struct::plugin_write(struct EventStruct *event, const String& str
 
   if ((nullptr != st77xx) && cmd.equals(_commandTriggerCmd)) {
     String arg1 = parseString(string, 2);
+
+    if (nullptr != gfxHelper) {
+      gfxHelper->invalidateLines(); // Screen content may be changed, redraw all lines on next read
+    }
     success = true;
 
     if (arg1.equals(F("off"))) {
@@ -254,6 +254,14 @@ bool P120_data_struct::init_sensor(struct EventStruct *event) {
     adxl345->doubleTapINT(doubleTap);
     adxl345->FreeFallINT(freeFall);
 
+    if (P120_FREQUENCY == P120_FREQUENCY_BURST) {
+      init_burst(event);
+    } else {
+      // Settings may be left from burst mode, the sensor keeps them until power-down
+      adxl345->setFIFOMode(ADXL345_FIFO_BYPASS);
+      adxl345->setFullResBit(false);
+    }
+
     addLog(LOG_LEVEL_INFO, F("ADXL345: Initialization done."));
   } else {
     addLog(LOG_LEVEL_ERROR, F("ADXL345: Initialization of sensor failed."));
@@ -284,6 +292,161 @@ bool P120_data_struct::init_sensor(struct EventStruct *event) {
   return true;
 }
 
+// **************************************************************************/
+// Burst mode: Set output data rate and allocate the buffers
+// **************************************************************************/
+void P120_data_struct::init_burst(struct EventStruct *event) {
+  _burstRate = constrain(P120_BURST_RATE, ADXL345_BW_50, ADXL345_BW_1600);
+  _burstAxis = constrain(P120_BURST_AXIS, 0, 2);
+  _bandLow   = P120_BAND_LOW;
+  _bandHigh  = P120_BAND_HIGH;
+  _burstSize = P120_BURST_SIZE;
+
+  if ((_burstSize < 64) || (_burstSize > P120_MAX_BURST_SIZE) || ((_burstSize & (_burstSize - 1)) != 0)) {
+    _burstSize = P120_DEFAULT_BURST_SIZE;
+  }
+
+  if ((_burstRate >= P120_BLOCKING_BURST_RATE) && (_burstSize > P120_MAX_BLOCKING_BURST_SIZE)) {
+    _burstSize = P120_MAX_BLOCKING_BURST_SIZE;
+  }
+
+  _burst.resize(_burstSize, 0);
+  _fftRe.resize(_burstSize, 0);
+  _fftIm.resize(_burstSize, 0);
+
+  adxl345->setFullResBit(true);
+  adxl345->set_bw(_burstRate);
+  start_burst();
+
+  if (loglevelActiveFor(LOG_LEVEL_INFO)) {
+    String log = F("ADXL345: Burst of ");
+    log += _burstSize;
+    log += F(" samples at ");
+    log += static_cast<int>(3200u >> (ADXL345_BW_1600 - _burstRate));
+    log += F(" Hz");
+    addLogMove(LOG_LEVEL_INFO, log);
+  }
+}
+
+// **************************************************************************/
+// Burst mode: Clear the FIFO and start collecting samples
+// **************************************************************************/
+void P120_data_struct::start_burst() {
+  adxl345->setFIFOMode(ADXL345_FIFO_BYPASS); // Clears the FIFO
+  adxl345->setFIFOMode(ADXL345_FIFO_STREAM);
+  _burstUsed     = 0;
+  _featuresReady = false;
+  _burstWaiting  = false;
+}
+
+// **************************************************************************/
+// Burst mode: Time after the last PLUGIN_READ to start the next burst,
+// so the features are as recent as possible when read.
+// Blocking bursts are limited to one per P120_MIN_BLOCKING_BURST_INTERVAL.
+// **************************************************************************/
+uint32_t P120_data_struct::burst_start_delay(struct EventStruct *event) const {
+  uint32_t interval_ms = Settings.TaskDeviceTimer[event->TaskIndex] * 1000ul;
+
+  if (interval_ms == 0) {
+    if (_burstRate < P120_BLOCKING_BURST_RATE) {
+      return 0; // Continuous
+    }
+    interval_ms = P120_MIN_BLOCKING_BURST_INTERVAL;
+  }
+  const uint16_t sampleRate  = 3200u >> (ADXL345_BW_1600 - _burstRate);
+  const uint32_t duration_ms = (1000ul * _burstSize) / sampleRate + P120_BURST_START_MARGIN;
+
+  return (interval_ms > duration_ms) ? interval_ms - duration_ms : 0;
+}
+
+// **************************************************************************/
+// Burst mode: Move the samples from the FIFO into the burst buffer.
+// When the FIFO is found full, samples may have been lost, so the burst is restarted.
+// From P120_BLOCKING_BURST_RATE, the FIFO is read until the burst is complete.
+// **************************************************************************/
+bool P120_data_struct::read_burst(struct EventStruct *event) {
+  if (!initialized()) {
+    init_sensor(event);
+  }
+
+  if (!initialized() || _burst.empty() || _featuresReady) {
+    return false;
+  }
+
+  if (_burstWaiting) {
+    if (timePassedSince(_lastFeatures) < static_cast<long>(burst_start_delay(event))) {
+      return false;
+    }
+    start_burst();
+  }
+
+  const uint16_t      sampleRate = 3200u >> (ADXL345_BW_1600 - _burstRate);
+  const bool          blocking   = _burstRate >= P120_BLOCKING_BURST_RATE;
+  const unsigned long timeout    = millis() + (1000ul * _burstSize) / sampleRate + 20;
+  int16_t xyz[3 * ADXL345_FIFO_SIZE];
+
+  if (blocking && (_burstUsed == 0)) {
+    start_burst(); // Discard what was collected since the last call, the FIFO may have overflowed
+  }
+
+  do {
+    const int entries = adxl345->readFIFO(xyz, ADXL345_FIFO_SIZE);
+
+    if (entries >= ADXL345_FIFO_SIZE) {
+      ++_burstOverruns;
+      _burstUsed = 0;
+    }
+
+    for (int i = 0; i < entries && _burstUsed < _burstSize; ++i) {
+      _burst[_burstUsed++] = xyz[3 * i + _burstAxis];
+    }
+
+    if (entries > 0) {
+      _x = xyz[3 * (entries - 1)];
+      _y = xyz[3 * (entries - 1) + 1];
+      _z = xyz[3 * (entries - 1) + 2];
+    } else if (blocking) {
+      delayMicroseconds(100);
+    }
+  } while (blocking && _burstUsed < _burstSize && !timeOutReached(timeout));
+
+  sensor_check_interrupt(event); // Process any interrupt
+
+  if (_burstUsed < _burstSize) {
+    return false;
+  }
+
+  calculateVibrationFeatures(&_burst[0], _burstSize, sampleRate, _bandLow, _bandHigh, P120_FULL_RES_SCALE,
+                             &_fftRe[0], &_fftIm[0], _features);
+  _featuresReady = true;
+  return true;
+}
+
+// **************************************************************************/
+// Burst mode: Set the features as task values
+// **************************************************************************/
+bool P120_data_struct::get_burst_features(struct EventStruct *event) {
+  if (!_featuresReady) {
+    return false;
+  }
+  UserVar[event->BaseVarIndex]     = _features.rms;
+  UserVar[event->BaseVarIndex + 1] = _features.peak;
+  UserVar[event->BaseVarIndex + 2] = _features.crest;
+  UserVar[event->BaseVarIndex + 3] = _features.bandRMS;
+
+  if ((_burstOverruns != 0) && loglevelActiveFor(LOG_LEVEL_INFO)) {
+    String log = F("ADXL345: FIFO overruns: ");
+    log += _burstOverruns;
+    addLogMove(LOG_LEVEL_INFO, log);
+  }
+  _burstOverruns = 0;
+
+  _featuresReady = false;
+  _burstWaiting  = true;
+  _lastFeatures  = millis();
+  return true;
+}
+
 /* Look for Interrupts and Triggered Action    */
 void P120_data_struct::sensor_check_interrupt(struct EventStruct *event) {
   // getInterruptSource clears all triggered actions after returning value
@@ -529,12 +692,52 @@ bool P120_data_struct::plugin_webform_load(struct EventStruct *event) {
 
     const __FlashStringHelper *frequencyOptions[] = {
       F("10x per second"),
-      F("50x per second") };
-    int frequencyValues[] = { P120_FREQUENCY_10, P120_FREQUENCY_50 };
-    addFormSelector(F("Measuring frequency"), F("p120_frequency"), 2, frequencyOptions, frequencyValues, P120_FREQUENCY);
+      F("50x per second"),
+      F("FIFO burst (vibration)") };
+    int frequencyValues[] = { P120_FREQUENCY_10, P120_FREQUENCY_50, P120_FREQUENCY_BURST };
+    addFormSelector(F("Measuring frequency"), F("p120_frequency"), 3, frequencyOptions, frequencyValues, P120_FREQUENCY);
     addFormNote(F("Values X/Y/Z are updated 1x per second, Controller updates &amp; Value-events are based on 'Interval' setting."));
   }
 
+  // Burst mode options
+  {
+    addFormSubHeader(F("FIFO burst"));
+
+    const __FlashStringHelper *rateOptions[] = {
+      F("100 Hz"),
+      F("200 Hz"),
+      F("400 Hz"),
+      F("800 Hz"),
+      F("1600 Hz"),
+      F("3200 Hz") };
+    int rateValues[] = { ADXL345_BW_50, ADXL345_BW_100, ADXL345_BW_200, ADXL345_BW_400, ADXL345_BW_800, ADXL345_BW_1600 };
+    addFormSelector(F("Sample rate"), F("p120_burst_rate"), 6, rateOptions, rateValues, P120_BURST_RATE);
+    addFormNote(F("From 1600 Hz a burst is read at once, blocking for its duration, max. once per second. 3200 Hz needs SPI or 400 kHz I2C."));
+
+    const __FlashStringHelper *sizeOptions[] = {
+      F("64"),
+      F("128"),
+      F("256"),
+      F("512") };
+    int sizeValues[] = { 64, 128, 256, 512 };
+    addFormSelector(F("Burst size"), F("p120_burst_size"), 4, sizeOptions, sizeValues, P120_BURST_SIZE);
+    addUnit(F("samples"));
+    addFormNote(F("Max. 256 samples from 1600 Hz."));
+
+    const __FlashStringHelper *axisOptions[] = {
+      F("X"),
+      F("Y"),
+      F("Z") };
+    int axisValues[] = { 0, 1, 2 };
+    addFormSelector(F("Axis"), F("p120_burst_axis"), 3, axisOptions, axisValues, P120_BURST_AXIS);
+
+    addFormFloatNumberBox(F("Band low"), F("p120_band_low"), P120_BAND_LOW, 0.0f, 1600.0f, 1);
+    addUnit(F("Hz"));
+    addFormFloatNumberBox(F("Band high"), F("p120_band_high"), P120_BAND_HIGH, 0.0f, 1600.0f, 1);
+    addUnit(F("Hz"));
+    addFormNote(F("Values: RMS, Peak, Crest factor and Band RMS of a burst, in g, mean removed. Band high 0: Half the sample rate."));
+  }
+
   return true;
 }
 
@@ -542,7 +745,25 @@ bool P120_data_struct::plugin_webform_load(struct EventStruct *event) {
 // Save the configuration interface
 // *******************************************************************
 bool P120_data_struct::plugin_webform_save(struct EventStruct *event) {
-  P120_FREQUENCY = getFormItemInt(F("p120_frequency"));
+  const bool wasBurst = P120_FREQUENCY == P120_FREQUENCY_BURST;
+
+  P120_FREQUENCY  = getFormItemInt(F("p120_frequency"));
+  P120_BURST_RATE = getFormItemInt(F("p120_burst_rate"));
+  P120_BURST_SIZE = getFormItemInt(F("p120_burst_size"));
+  P120_BURST_AXIS = getFormItemInt(F("p120_burst_axis"));
+  P120_BAND_LOW   = getFormItemFloat(F("p120_band_low"));
+  P120_BAND_HIGH  = getFormItemFloat(F("p120_band_high"));
+
+  if (wasBurst != (P120_FREQUENCY == P120_FREQUENCY_BURST)) {
+    // Nr of output values has changed, generate new value names
+    ExtraTaskSettings.TaskIndex = event->TaskIndex;
+    String dummy;
+    PluginCall(PLUGIN_GET_DEVICEVALUENAMES, event, dummy);
+
+    for (uint8_t i = 0; i < VARS_PER_TASK; ++i) {
+      ExtraTaskSettings.TaskDeviceValueDecimals[i] = (P120_FREQUENCY == P120_FREQUENCY_BURST) ? 3 : 0;
+    }
+  }
   uint32_t flags = 0ul;
 
   set2BitToUL(flags, P120_FLAGS1_RANGE, getFormItemInt(F("p120_range")));
@@ -616,6 +837,12 @@ bool P120_data_struct::plugin_set_defaults(struct EventStruct *event) {
   set8BitToUL(flags, P120_FLAGS4_OFFSET_Z, 0 + 0x80);
   P120_CONFIG_FLAGS4 = flags;
 
+  P120_BURST_RATE = P120_DEFAULT_BURST_RATE;
+  P120_BURST_SIZE = P120_DEFAULT_BURST_SIZE;
+  P120_BURST_AXIS = 2;     // Z-axis
+  P120_BAND_LOW   = 10.0f; // 10 ... 1000 Hz, as commonly used for machine vibration
+  P120_BAND_HIGH  = 1000.0f;
+
   // No decimals plausible, as the outputs from the sensor are of type int
   for (uint8_t i = 0; i < VARS_PER_TASK; ++i) {
     ExtraTaskSettings.TaskDeviceValueDecimals[i] = 0;
@@ -5,6 +5,7 @@
 #if defined(USES_P120) || defined(USES_P125)
 
 # include "../Globals/EventQueue.h"
+# include "../Helpers/VibrationFeatures.h"
 
 # include <vector>
 
@@ -22,6 +23,21 @@
 # define P120_FREQUENCY                   PCONFIG(3)
 # define P120_FREQUENCY_10                0          // 10x per second
 # define P120_FREQUENCY_50                1          // 50x per second
+# define P120_FREQUENCY_BURST             2          // Read bursts from the FIFO, output vibration features
+# define P120_BURST_RATE                  PCONFIG(4) // ADXL345_BW_xxx code, output data rate = 3200 Hz >> (0xF - code)
+# define P120_BURST_SIZE                  PCONFIG(5) // Samples per burst
+# define P120_BURST_AXIS                  PCONFIG(6) // 0 = X, 1 = Y, 2 = Z
+# define P120_BAND_LOW                    PCONFIG_FLOAT(0)
+# define P120_BAND_HIGH                   PCONFIG_FLOAT(1)
+# define P120_DEFAULT_BURST_RATE          ADXL345_BW_400 // 800 Hz
+# define P120_DEFAULT_BURST_SIZE          256
+# define P120_MAX_BURST_SIZE              512
+# define P120_BLOCKING_BURST_RATE         ADXL345_BW_800 // From 1600 Hz the FIFO fills up between 2 calls at 50x per second
+# define P120_MAX_BLOCKING_BURST_SIZE     256            // Max. 160 msec blocking
+# define P120_MIN_BLOCKING_BURST_INTERVAL 1000           // msec between blocking bursts when Interval is 0
+# define P120_BURST_START_MARGIN          40             // msec, 2 calls at 50x per second
+# define P120_FULL_RES_SCALE              0.0039f        // Full resolution: 3.9 mg/LSB for all ranges
+
 // First set of configuration flags
 # define P120_CONFIG_FLAGS1               PCONFIG_LONG(0)
 # define P120_FLAGS1_RANGE                0          // Range setting, size 2 bits
@@ -88,6 +104,14 @@ public:
     return adxl345 != nullptr;
   }
 
+  // Burst mode: Read the FIFO into the burst buffer.
+  // Returns true when the burst is complete and the features are calculated.
+  bool read_burst(struct EventStruct *event);
+
+  // Burst mode: Set the features of the last burst as task values.
+  // The next burst is started in time to complete just before the next PLUGIN_READ.
+  bool get_burst_features(struct EventStruct *event);
+
   bool plugin_webform_load(struct EventStruct *event);
   bool plugin_webform_save(struct EventStruct *event);
   bool plugin_set_defaults(struct EventStruct *event);
@@ -96,6 +120,9 @@ private:
 
   void initialization();
   bool init_sensor(struct EventStruct *event);
+  void init_burst(struct EventStruct *event);
+  void start_burst();
+  uint32_t burst_start_delay(struct EventStruct *event) const;
   void sensor_check_interrupt(struct EventStruct *event);
   void appendPayloadXYZ(struct EventStruct *event,
                         String            & payload,
@@ -119,6 +146,22 @@ private:
 
   int _x = 0, _y = 0, _z = 0; // Last measured values
 
+  // Burst mode, buffers are allocated once at sensor init.
+  std::vector<int16_t>_burst; // Samples of the selected axis
+  std::vector<int16_t>_fftRe;
+  std::vector<int16_t>_fftIm;
+  uint16_t            _burstUsed     = 0;
+  uint16_t            _burstSize     = 0;
+  uint8_t             _burstRate     = 0;
+  uint8_t             _burstAxis     = 0;
+  uint32_t            _burstOverruns = 0;
+  float               _bandLow       = 0.0f;
+  float               _bandHigh      = 0.0f;
+  VibrationFeatures_t _features;
+  unsigned long       _lastFeatures  = 0;     // Time of the last PLUGIN_READ with features
+  bool                _featuresReady = false;
+  bool                _burstWaiting  = false; // Waiting to start the next burst
+
   bool activityTriggered   = false;
   bool inactivityTriggered = false;
   bool i2c_mode            = false;
@@ -0,0 +1,26 @@
+#ifndef STATIC_WEBSTATICASSETS_H
+#define STATIC_WEBSTATICASSETS_H
+
+#include "../../ESPEasy_common.h"
+
+// Pre-compressed static web assets (CSS/JS), generated from the files in static/ by
+// tools/pio/generate-web-static-assets.py into WebStaticAssets_gz.h (committed, not generated by the build)
+// The URL of each asset contains a hash of its content, so it can be cached "forever" by the browser.
+
+#ifdef WEBSERVER_STATIC_ASSETS
+
+struct WebStaticAsset_t {
+  const char    *url;         // PROGMEM
+  const char    *etag;        // PROGMEM, including quotes
+  const char    *contentType; // PROGMEM
+  const uint8_t *data;        // PROGMEM, gzip compressed
+  uint32_t       size;
+};
+
+// Serve the asset matching the URI, if any.
+// Answers with "304 Not Modified" when the browser already has this version.
+bool handle_static_asset(const String& uri);
+
+#endif // ifdef WEBSERVER_STATIC_ASSETS
+
+#endif // ifndef STATIC_WEBSTATICASSETS_H
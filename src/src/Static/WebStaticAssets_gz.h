@@ -0,0 +1,365 @@
+// Generated by tools/pio/generate-web-static-assets.py from the files in static/
+// Do not edit, run the script again after changing a file in static/
+
+#ifndef STATIC_WEBSTATICASSETS_GZ_H
+#define STATIC_WEBSTATICASSETS_GZ_H
+
+#include "../Static/WebStaticAssets.h"
+
+#ifdef WEBSERVER_STATIC_ASSETS
+
+#if defined(WEBSERVER_CSS) && !defined(WEBSERVER_EMBED_CUSTOM_CSS)
+// espeasy_default.css: 5272 bytes minified, 1692 bytes gzip
+# define WEBSTATIC_ESPEASY_DEFAULT_CSS_AVAILABLE
+static const char WEBSTATIC_ESPEASY_DEFAULT_CSS_URL[] PROGMEM  = "/static/espeasy_default.6189d3ac.css";
+static const char WEBSTATIC_ESPEASY_DEFAULT_CSS_ETAG[] PROGMEM = "\"6189d3ac\"";
+static const char WEBSTATIC_ESPEASY_DEFAULT_CSS_TYPE[] PROGMEM = "text/css";
+static const uint8_t WEBSTATIC_ESPEASY_DEFAULT_CSS_GZ[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xad,0x58,0xeb,0x8e,0x9b,0x38,
+  0x14,0x7e,0x15,0xa4,0x51,0x35,0xed,0x0a,0x10,0x21,0x77,0xf2,0xa7,0xbb,0x9d,0xc9,
+  0xaf,0xdd,0x67,0xa8,0x0c,0x98,0x60,0x05,0x6c,0x64,0x9c,0x49,0x52,0xc4,0x3e,0xfb,
+  0x1e,0x1b,0x0c,0xe6,0x92,0xe9,0x6c,0x55,0x45,0xed,0xc0,0xb1,0x7d,0xee,0xdf,0x39,
+  0xc7,0xb8,0x51,0xc6,0x4a,0x1c,0x0a,0x6a,0xa7,0x0b,0x3b,0xf5,0xed,0x74,0x59,0x25,
+  0x8c,0x0a,0xe7,0x8a,0xc9,0x29,0x15,0xc1,0xd6,0xf3,0x6a,0xb9,0xb0,0xa9,0x22,0x96,
+  0x31,0x1e,0x3c,0x79,0xdb,0x97,0xda,0x8d,0x52,0x1c,0x9d,0x73,0xc4,0xcf,0x01,0x4a,
+  0x04,0xe6,0xb6,0x1b,0x33,0xd1,0xbf,0xc2,0x56,0x2a,0x30,0x15,0xc1,0xf3,0x73,0xed,
+  0x86,0x17,0x21,0x18,0xb5,0xdd,0x1c,0xd3,0x4b,0x25,0xf0,0x4d,0x38,0x31,0x8e,0x18,
+  0x47,0x82,0x30,0x1a,0x50,0x46,0x71,0xed,0xc6,0xe4,0xed,0x7b,0xd6,0xee,0x48,0x32,
+  0x86,0x44,0x90,0xe1,0x44,0x80,0x14,0xad,0x99,0xda,0xc1,0xdb,0x35,0x2e,0xf5,0x3a,
+  0xb4,0xda,0x24,0x49,0x52,0xff,0x51,0x85,0xec,0xe6,0x94,0xe4,0x07,0xa1,0xa7,0x20,
+  0x64,0x3c,0xc6,0xdc,0x01,0xca,0x41,0x99,0x91,0xa0,0x9c,0x64,0xf7,0xa0,0x44,0xb4,
+  0x74,0x4a,0xcc,0x49,0xd2,0x90,0x61,0x37,0x0e,0x16,0x7e,0x21,0x0e,0xa0,0xf6,0x89,
+  0xd0,0xc0,0x3b,0x14,0x28,0x8e,0x25,0x07,0x69,0x6f,0x65,0x6c,0xda,0xf4,0x9b,0x76,
+  0xc5,0xcd,0x82,0xe5,0xde,0x49,0x1d,0x1b,0x20,0x56,0x21,0x8a,0xce,0x27,0xce,0x2e,
+  0x34,0x76,0x5a,0xed,0x56,0xab,0x95,0x56,0xf4,0x78,0x3c,0x76,0xa2,0x2c,0x67,0x55,
+  0xdc,0x3a,0x79,0x9b,0xe2,0x56,0x03,0xbf,0xe9,0xe9,0xd7,0xd7,0xd7,0x83,0xc1,0xa8,
+  0x3d,0x0d,0xfa,0xdc,0x14,0x03,0xab,0x57,0x79,0x25,0x59,0x6c,0x4c,0x95,0x3c,0x50,
+  0x29,0x62,0x31,0xb6,0xcf,0x61,0x6c,0x17,0x1c,0xdb,0x25,0xca,0x0b,0x5b,0x08,0xfb,
+  0x96,0x17,0x95,0xe9,0x98,0x9c,0x51,0x56,0x16,0x28,0xc2,0x76,0xf7,0x64,0x7a,0x08,
+  0xe7,0x3a,0x82,0x33,0x0a,0x42,0x2a,0x1c,0x1a,0x7f,0xab,0x40,0xb6,0xcf,0x0e,0x47,
+  0x31,0xb9,0x94,0x52,0xa9,0x19,0xe3,0x4d,0xcb,0xa5,0x11,0xd2,0x1c,0x2d,0xc2,0x4d,
+  0x71,0x56,0xd8,0x7d,0x72,0xd9,0x84,0x16,0x17,0x61,0x97,0x38,0xc3,0x91,0xb0,0x65,
+  0xee,0x20,0x8e,0x51,0xd5,0x8a,0x69,0x78,0x9f,0x38,0xba,0x6b,0xc1,0xa5,0xb8,0x67,
+  0x38,0x28,0x59,0x46,0x62,0x4d,0xba,0x92,0x58,0xa4,0xc1,0xc2,0x90,0x91,0x11,0x7a,
+  0x76,0x81,0x8c,0xab,0x98,0x94,0x45,0x86,0xee,0x01,0xa1,0x40,0xc3,0x4e,0x98,0xb1,
+  0xe8,0x7c,0x50,0x19,0x8a,0x32,0x72,0xa2,0x41,0x04,0x29,0x8c,0xf9,0xa1,0x65,0xe1,
+  0x79,0x9f,0x86,0x3c,0x38,0x8e,0xa7,0x3e,0x01,0xe2,0xc0,0x9a,0x6a,0xe8,0x93,0xb5,
+  0xf7,0xa9,0xb3,0xde,0x07,0xeb,0x65,0xe0,0x3e,0x6a,0x6f,0xef,0x56,0x2d,0x21,0x48,
+  0xd9,0x1b,0xa0,0xad,0x57,0x22,0x78,0x5a,0x6e,0xf6,0xb5,0xe2,0xd2,0xac,0xb5,0xbc,
+  0x26,0x1b,0x75,0x04,0xa3,0x28,0xaa,0x1f,0x08,0x9d,0xec,0xc5,0x18,0x3f,0x0a,0x22,
+  0xe0,0xa2,0x61,0xa3,0x1c,0xdb,0xf2,0x6a,0x9c,0x9c,0xa3,0x5b,0x1b,0x84,0xb5,0xe7,
+  0xc1,0xb1,0xe6,0x79,0x27,0x9d,0x29,0xd7,0xe9,0x25,0x0f,0x41,0xb3,0xf9,0x5d,0x5b,
+  0x99,0x7d,0xb2,0x96,0x20,0x88,0x0f,0x14,0x99,0xee,0xd1,0x1f,0xa1,0x4f,0x2b,0xe3,
+  0xc8,0xba,0x11,0x2c,0xd7,0x32,0xf3,0x2e,0xbc,0x04,0xad,0x0b,0x46,0x64,0x10,0x0d,
+  0x36,0x95,0x93,0xb3,0x1f,0xce,0xa5,0x94,0xf9,0xd2,0x38,0x47,0xe5,0xae,0x93,0x97,
+  0x33,0xc4,0x2b,0x0e,0xcf,0x44,0x4c,0x17,0x74,0xea,0x34,0x39,0xd3,0x78,0xa5,0x11,
+  0x2e,0x5d,0xd3,0xbe,0x0b,0x56,0xc8,0xb2,0xc2,0x4a,0xa2,0x6a,0x1d,0xc7,0x19,0x14,
+  0xbd,0x37,0x7c,0x18,0x73,0x33,0x94,0xb3,0x94,0x17,0xab,0xa1,0xf2,0x07,0x06,0xa8,
+  0x24,0xe2,0x6e,0x32,0x43,0x21,0xa4,0xf9,0x45,0x60,0x23,0x7b,0xa0,0x48,0x96,0x28,
+  0xcc,0xe6,0xb2,0xf2,0xc4,0xf1,0xdd,0xd8,0xf9,0x20,0xb8,0x69,0x53,0xf1,0x7d,0xe9,
+  0x3e,0x65,0xcb,0x8c,0xbc,0x43,0x63,0x54,0x13,0x1f,0xb9,0xd3,0x50,0xbe,0xc9,0xb2,
+  0xc6,0x84,0x7f,0xdf,0x95,0x26,0xd3,0x6e,0x6c,0x74,0xa0,0x0e,0xe0,0xf8,0xfd,0x93,
+  0x73,0xdd,0xa7,0x03,0xb2,0x0a,0xcd,0x9c,0x8b,0x7e,0x2a,0x49,0xb7,0x31,0x23,0xc3,
+  0x06,0x21,0x36,0x79,0x4c,0xc4,0xcb,0xd4,0x11,0x1c,0x1a,0x4c,0xc2,0x78,0x1e,0x70,
+  0x26,0x90,0xc0,0x9f,0x57,0xeb,0x18,0x9f,0xbe,0x74,0x19,0xf4,0x68,0xbd,0x2d,0x9f,
+  0xaa,0x66,0x59,0xb2,0x9b,0x0d,0x0b,0x97,0x67,0x2d,0x01,0x5e,0x4b,0x55,0xec,0xdb,
+  0xf0,0x2c,0x3c,0x1d,0x9e,0x2d,0x3c,0xc8,0x70,0x2c,0xe5,0xdf,0x07,0xfc,0x5b,0x50,
+  0x41,0x9c,0x9e,0x04,0x43,0xa5,0xc8,0x71,0x59,0xa2,0x13,0xee,0x1a,0xb6,0xed,0x66,
+  0xec,0xf4,0x46,0xf0,0x55,0x96,0x87,0x0f,0xd4,0xd5,0x07,0x6c,0xaa,0x69,0xb9,0x35,
+  0x5c,0xf9,0x3b,0x10,0xd7,0x62,0x2a,0x64,0x50,0xf8,0xf2,0xc0,0xf7,0x7a,0x98,0x29,
+  0x5f,0xec,0x65,0x45,0xfa,0x3f,0x48,0xf3,0x7f,0x01,0x6a,0x9d,0xb1,0xb3,0xf0,0x99,
+  0x56,0x7a,0x0d,0xa8,0xcd,0x87,0x01,0xb5,0x19,0x7a,0x6e,0x88,0xa8,0xc7,0xe2,0x87,
+  0x78,0xf2,0xc7,0x69,0xfe,0xf8,0xa0,0x82,0xd3,0x70,0x76,0xfb,0x30,0x98,0x1e,0x89,
+  0x19,0xf1,0x19,0xe3,0xc7,0xb7,0x46,0x1b,0xcd,0xf6,0x65,0x00,0x60,0xea,0xc7,0x9d,
+  0x76,0xe3,0xae,0x4d,0xfc,0x5d,0xdf,0x4f,0xa4,0xdf,0xba,0x4c,0xee,0xbb,0x98,0x39,
+  0xe9,0x3c,0xff,0x7d,0x89,0x48,0x8c,0xac,0x6f,0x8c,0x82,0x2d,0xf8,0xd9,0xfe,0x87,
+  0x51,0x14,0x31,0x63,0xee,0xe9,0xbb,0x10,0x74,0x7b,0x6f,0xda,0xe3,0x8c,0xe6,0x35,
+  0x80,0xc1,0xbb,0xa3,0x91,0x39,0x0e,0xb5,0xd9,0xbb,0x04,0x9b,0xfa,0xf9,0xd5,0x1c,
+  0xb7,0xb6,0xda,0x44,0x7f,0xe7,0x8f,0x32,0xdc,0x59,0xa8,0xc2,0x9c,0xc3,0xbb,0xae,
+  0xbe,0xa6,0x8a,0x72,0x8e,0xea,0xc3,0x95,0x90,0x1b,0x8e,0x67,0x66,0x99,0x37,0x52,
+  0x92,0x90,0x64,0x32,0xc3,0x53,0x12,0x43,0xfb,0x3d,0xfc,0x70,0x08,0x8d,0xf1,0x2d,
+  0x58,0x0c,0x4d,0x72,0xcb,0x94,0x5d,0x2b,0x8d,0x46,0x44,0x49,0xde,0x0c,0xec,0x09,
+  0x8a,0x31,0xa1,0x96,0xbb,0x2e,0x6d,0xf9,0xc8,0x2e,0x42,0x3e,0x5b,0x3e,0xfc,0x77,
+  0xf8,0xd8,0x2e,0x43,0x05,0xf5,0x98,0xe1,0xfa,0xab,0x96,0x73,0xc6,0xf7,0x84,0x23,
+  0x50,0xc1,0x6a,0x38,0x54,0x09,0x67,0x79,0xd5,0x61,0xfe,0x53,0x0f,0xcf,0x5a,0xb0,
+  0xca,0xf0,0xa6,0xa6,0xbb,0xfb,0xba,0xfe,0xfa,0x7b,0xb8,0xcc,0xeb,0x04,0xa6,0x0c,
+  0xd8,0x8d,0x8e,0xf5,0xfc,0x3c,0x43,0xca,0x58,0xa5,0x5f,0x63,0xe2,0x66,0xf8,0x0d,
+  0x67,0xdf,0x3d,0x7d,0x11,0x3b,0x2e,0xe4,0x4f,0x93,0x17,0x1d,0xf9,0xdb,0xf1,0xb8,
+  0x5f,0x6b,0xb2,0xaf,0xc9,0xfb,0x97,0x6f,0xaf,0xc7,0x57,0x4d,0x5e,0x6a,0xf2,0x9f,
+  0xab,0xe3,0xb7,0xed,0x5e,0x93,0x57,0x1d,0x13,0xff,0xcf,0xbf,0x96,0x1d,0x79,0xdf,
+  0x91,0xd7,0x5e,0x6d,0x36,0x8c,0x49,0xda,0xfb,0x5b,0xf9,0x3b,0x0c,0x34,0xd4,0xf0,
+  0x5d,0x2f,0x65,0xbe,0xca,0x82,0x06,0xf7,0xb8,0x6b,0x80,0x2e,0x82,0xd5,0x1a,0xa8,
+  0xef,0x0e,0xa8,0x42,0x4e,0x35,0x6e,0x7e,0xc9,0x04,0xe1,0xec,0x6a,0x89,0xd4,0x6e,
+  0x28,0x14,0xda,0x1d,0xca,0xe0,0xfd,0xc1,0xcd,0x6b,0xd0,0xcf,0x9e,0x76,0xbb,0x9d,
+  0x79,0x1d,0x19,0xdd,0x71,0xcd,0xdb,0xd8,0x41,0x41,0xc6,0xd1,0x97,0xd8,0x16,0x3a,
+  0x13,0x30,0x8d,0xf4,0x1a,0x28,0x65,0xf4,0xd2,0x0c,0x15,0x25,0x0e,0xf4,0x83,0x56,
+  0x01,0xea,0x8b,0x01,0xe5,0x95,0xdf,0x0f,0xbd,0xea,0xa2,0x31,0x36,0x99,0x8f,0x4c,
+  0x8e,0x47,0xef,0xbc,0x32,0xaf,0x82,0xa3,0xbd,0x55,0x1b,0x00,0xe9,0xff,0x09,0xe7,
+  0xc1,0xaa,0x59,0xf0,0x7e,0x6a,0x30,0x48,0x0d,0xa8,0x48,0x9d,0x28,0x25,0x59,0xfc,
+  0x19,0x12,0x85,0x7e,0x99,0x09,0xc4,0xcb,0xeb,0xeb,0xe6,0x78,0xac,0xdd,0x14,0x84,
+  0x64,0x52,0x90,0x14,0x39,0xdd,0x16,0x87,0x49,0xe2,0x79,0x5b,0xc8,0x5b,0x54,0xa4,
+  0x18,0x30,0x02,0xc3,0x58,0xf3,0x57,0x7d,0x15,0x98,0x1e,0x38,0xee,0xe4,0xaf,0x53,
+  0x58,0xde,0xcc,0xe1,0x26,0x00,0x5d,0x80,0x32,0x81,0x2b,0x23,0x0b,0x9a,0xea,0xaa,
+  0x26,0x18,0x22,0xc0,0x1c,0xe8,0x94,0x26,0x63,0xfd,0xb9,0x40,0xe1,0x0d,0x06,0x17,
+  0xab,0x1d,0xc5,0x5e,0x5e,0x5e,0x74,0xe2,0xee,0xbd,0x99,0xfe,0xdd,0x54,0x58,0xf5,
+  0x2d,0x02,0xc8,0x4d,0x13,0xef,0x6b,0xa9,0x1b,0xb2,0xf8,0xae,0x04,0x18,0x77,0x81,
+  0xbd,0xea,0xee,0x92,0x1a,0x22,0x08,0x98,0xe6,0x44,0x68,0x8a,0x39,0x11,0x8a,0xc7,
+  0x7a,0xad,0xb7,0x54,0x83,0xc9,0x50,0x8d,0x77,0x05,0x20,0x85,0x8a,0x69,0x5b,0xb1,
+  0xd4,0xc7,0x00,0x98,0x10,0x07,0x43,0x98,0xba,0x5c,0x37,0xff,0xcc,0xaf,0x08,0xe3,
+  0xbb,0x77,0xd3,0xd7,0x52,0x22,0xb0,0xa3,0x9a,0x20,0xf4,0xfd,0x2b,0x47,0x45,0xa3,
+  0x84,0x8b,0x22,0x39,0x47,0xcd,0xb9,0x1f,0x20,0x34,0xc4,0x17,0x74,0x3c,0xe5,0x35,
+  0x4b,0xad,0xf5,0x69,0xde,0x70,0x9a,0xb9,0xaa,0xbe,0xbc,0x4e,0xb7,0x7d,0x6f,0xbf,
+  0x35,0x98,0x43,0x48,0xed,0x02,0xa1,0xbb,0xc7,0x60,0x0a,0xef,0x49,0x52,0x19,0xd7,
+  0xed,0xe6,0xe3,0xd0,0x4c,0x0f,0xde,0x79,0x33,0x3d,0xb8,0xbd,0xc2,0xfa,0x66,0xef,
+  0x94,0xbe,0x90,0xe0,0x70,0x51,0x86,0xb9,0xb0,0xdd,0x2b,0xe2,0x14,0x16,0xaa,0xe1,
+  0xd0,0xb9,0x58,0x1b,0x67,0x14,0x62,0x8d,0x8f,0x50,0x4a,0x8b,0x90,0x57,0x51,0x86,
+  0x11,0x0f,0xe0,0x44,0xda,0x72,0x9b,0x51,0x2c,0x59,0xad,0x96,0xcb,0x4d,0xdd,0x89,
+  0x99,0xd9,0x91,0x44,0x68,0xb1,0xed,0xbf,0x80,0x8d,0xc7,0xd4,0x7e,0x64,0xf0,0xa5,
+  0x21,0xea,0xfb,0x85,0x9e,0x36,0xc7,0xa3,0xb1,0x52,0x5b,0x25,0x50,0x93,0x6f,0xee,
+  0xb2,0xec,0x19,0xb7,0x71,0x31,0xe2,0x50,0xc2,0xb0,0x0c,0xdb,0x2a,0x5d,0xa8,0x9d,
+  0x9b,0x2a,0xd5,0x66,0x75,0xfa,0x9a,0xe3,0x98,0x20,0xab,0x8c,0x64,0x38,0x2c,0x44,
+  0x63,0xeb,0x73,0x3f,0x3a,0xed,0x37,0xa0,0xc0,0x97,0x4a,0x0d,0x10,0x32,0xa4,0x19,
+  0x0a,0x71,0x36,0x0a,0x68,0x8b,0x8c,0x6e,0xda,0x5a,0xbc,0x5d,0x8d,0xe1,0x6b,0x25,
+  0xa7,0xb9,0xfa,0x3f,0x05,0xd7,0x93,0x63,0x98,0x14,0x00,0x00
+};
+#endif // if defined(WEBSERVER_CSS) && !defined(WEBSERVER_EMBED_CUSTOM_CSS)
+
+#if defined(WEBSERVER_INCLUDE_JS) && defined(WEBSERVER_LOG)
+// fetch_and_parse_log.js: 3434 bytes minified, 1298 bytes gzip
+# define WEBSTATIC_FETCH_AND_PARSE_LOG_JS_AVAILABLE
+static const char WEBSTATIC_FETCH_AND_PARSE_LOG_JS_URL[] PROGMEM  = "/static/fetch_and_parse_log.31bbf38d.js";
+static const char WEBSTATIC_FETCH_AND_PARSE_LOG_JS_ETAG[] PROGMEM = "\"31bbf38d\"";
+static const char WEBSTATIC_FETCH_AND_PARSE_LOG_JS_TYPE[] PROGMEM = "application/javascript";
+static const uint8_t WEBSTATIC_FETCH_AND_PARSE_LOG_JS_GZ[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xa5,0x56,0x5d,0x6f,0xda,0x48,
+  0x14,0x7d,0xe7,0x57,0xdc,0xe6,0xa1,0xb6,0x17,0xd6,0x40,0xa5,0xbe,0x84,0x8f,0xa8,
+  0x6d,0x52,0x35,0x52,0x48,0xab,0x96,0x76,0x1f,0x00,0x45,0x83,0x7d,0x31,0xde,0xd8,
+  0x1e,0xef,0xcc,0x98,0x04,0x15,0xfe,0xfb,0xde,0xf1,0xd8,0x06,0x3b,0xa4,0xdb,0x76,
+  0xa5,0x88,0xd8,0x33,0x77,0xee,0xc7,0xb9,0xe7,0x9e,0xf1,0x2a,0x4b,0x3c,0x15,0xf2,
+  0x04,0x02,0x54,0x6f,0x05,0x7f,0x90,0x28,0x6c,0x07,0xbe,0xb7,0x36,0x4c,0x40,0xc6,
+  0x60,0x04,0x09,0xdb,0x84,0x01,0x53,0x5c,0xb8,0x19,0xed,0xbd,0x09,0x30,0x51,0x9d,
+  0x96,0xc2,0xb8,0x03,0x13,0xda,0xcd,0x98,0x1b,0x33,0xe5,0xad,0xed,0xae,0xcd,0x53,
+  0x14,0x6c,0xe7,0xad,0x05,0x8f,0x71,0x27,0xd9,0x8a,0x89,0x70,0xb7,0x0a,0x05,0xae,
+  0xf8,0xe3,0x2e,0x96,0x21,0xee,0x94,0x08,0x7d,0x3a,0x6d,0x5f,0x8c,0xe6,0x5d,0xc7,
+  0x99,0x77,0x2f,0xe6,0xf2,0x0f,0x7b,0xee,0xb7,0x9d,0x6e,0xe8,0xc0,0x6e,0x07,0xb3,
+  0xc5,0xa0,0x15,0xae,0xc0,0xee,0x16,0x86,0xdd,0xd0,0x55,0x28,0x95,0x3d,0x99,0xf5,
+  0x17,0x8e,0xce,0x89,0xa2,0x52,0xc8,0xee,0x7c,0x29,0x36,0x33,0x38,0x5f,0xb4,0xcd,
+  0xe1,0xc0,0xc5,0x47,0xf4,0xec,0x8c,0x55,0x4e,0x04,0xaa,0x4c,0x24,0x74,0x20,0x61,
+  0x31,0x9e,0x83,0x75,0x7d,0x65,0x75,0x5a,0x1b,0x14,0x92,0xea,0x3c,0x07,0x9b,0xdc,
+  0x90,0x47,0x6d,0x6c,0x59,0x4e,0x6b,0x3f,0x68,0xed,0xf3,0xb0,0x3a,0x0c,0x8c,0x46,
+  0x23,0xb0,0xde,0xe5,0x35,0x58,0x87,0x90,0x87,0x2a,0xe7,0xcb,0x8f,0x9f,0x3e,0xef,
+  0xae,0xfc,0x00,0xe7,0x5d,0x13,0xde,0x31,0x49,0x6b,0xc3,0x17,0x84,0x56,0x16,0x45,
+  0xfa,0x5c,0x33,0x85,0x8f,0x1a,0x9c,0xe3,0x2c,0x4c,0x12,0x26,0xfa,0xbe,0xa5,0xa1,
+  0x9c,0xcc,0x5e,0x2d,0xe0,0x02,0x66,0x3a,0x8f,0x4e,0xfe,0xb6,0x80,0x73,0x98,0x1d,
+  0xf0,0x67,0x69,0x7a,0x4b,0xde,0x3a,0x50,0x5b,0xfa,0x66,0x3c,0x76,0xc0,0xfa,0xf3,
+  0xc2,0x2a,0x10,0xb4,0x9b,0x69,0x17,0x61,0xcb,0x9c,0x43,0x82,0xf3,0x28,0xd9,0x89,
+  0x2b,0xd3,0x28,0xf4,0xd0,0xee,0x77,0x80,0xfe,0x4c,0x6a,0x8e,0xce,0xac,0x51,0xc6,
+  0x64,0xd6,0x5b,0x1c,0xd5,0x30,0xa9,0x2a,0xd0,0x6c,0x59,0x1a,0xf6,0x50,0xdc,0x63,
+  0x2a,0x0d,0xf2,0x3d,0x2f,0x13,0x82,0x3a,0xfa,0xb6,0x32,0x29,0x8c,0x5d,0xed,0x17,
+  0xda,0xd5,0x6b,0xe1,0xda,0x54,0x51,0xb3,0x19,0xe5,0x6d,0x84,0x97,0x2f,0x9b,0xb6,
+  0x30,0x84,0xfe,0x2b,0xd3,0xaa,0x47,0x35,0xe5,0x97,0x21,0xd5,0xc2,0xb6,0xda,0xfe,
+  0x4a,0x08,0x2e,0x08,0x7b,0xf2,0xdf,0x88,0xdf,0xa6,0xc5,0x50,0x42,0xc2,0x15,0xc8,
+  0x2c,0x4d,0xb9,0x50,0xe8,0xbf,0x80,0x4f,0x11,0x32,0x89,0xa0,0xc4,0x16,0x18,0xc4,
+  0xdc,0x47,0xaa,0xfc,0x01,0x97,0x55,0x40,0xab,0xb5,0x07,0x8c,0xc8,0xe2,0x44,0xac,
+  0xf7,0x48,0x38,0x87,0x49,0x00,0x11,0x0f,0x80,0x22,0x89,0x10,0xa5,0xeb,0xba,0x96,
+  0x06,0xc7,0xe7,0x5e,0x16,0xd3,0x9a,0x4b,0xb8,0x5c,0x45,0xa8,0x1f,0xdf,0x6e,0xaf,
+  0x7d,0xdb,0xf2,0x78,0xba,0x9d,0x92,0xa7,0xbb,0xbe,0xe5,0xb8,0x61,0x92,0xa0,0xf8,
+  0x30,0x9d,0xdc,0x90,0xbb,0x9a,0xfb,0x41,0x2b,0xe2,0x3c,0xbd,0xc4,0x1b,0xfa,0xb5,
+  0xfb,0xbd,0x5e,0xaf,0x03,0xbd,0x02,0x56,0x0a,0x76,0x83,0x1b,0x8c,0xf4,0x98,0xe2,
+  0x03,0xbc,0x11,0x82,0x6d,0x6d,0xeb,0x6b,0x42,0x93,0xea,0x5b,0x9d,0x02,0x01,0xfd,
+  0x70,0x9d,0xac,0xb8,0xfe,0x7f,0x89,0xcb,0x2c,0xa8,0x1e,0x60,0xc2,0x05,0xea,0xb7,
+  0xaf,0x89,0x8f,0xab,0x30,0x31,0x87,0x7e,0xf2,0xc5,0x78,0xb8,0xc4,0x8d,0x45,0xc9,
+  0xac,0x4a,0x15,0x39,0x4a,0x55,0x85,0x31,0xbe,0xe7,0xe2,0x96,0x6a,0xe9,0x00,0xa3,
+  0xed,0x0d,0x7e,0xc6,0x7f,0x32,0x9a,0x68,0x59,0x0a,0x4c,0xcc,0x1e,0xc3,0x38,0x8b,
+  0xcb,0x65,0x2a,0xa3,0x6f,0x0a,0xcb,0x84,0xae,0xc9,0xea,0x52,0x81,0x7f,0x4b,0x9e,
+  0x58,0x86,0x10,0xa1,0xbc,0x65,0xb7,0x76,0xc3,0x95,0xf6,0x55,0x5f,0xa2,0x93,0x0d,
+  0xc7,0xe5,0x88,0x1f,0xa5,0x44,0x93,0x5e,0xf1,0xbf,0xb6,0x0c,0x1a,0xe2,0x53,0x07,
+  0x86,0x23,0x78,0xdd,0xeb,0x69,0x7b,0xe9,0x09,0x1e,0x45,0xd4,0xed,0x3b,0xb5,0x4d,
+  0x73,0x6a,0xb2,0x4c,0x71,0xdd,0xeb,0x92,0x1f,0x4f,0x2d,0x64,0xcc,0xb9,0x5a,0x5b,
+  0xe5,0xb0,0x78,0x55,0x03,0xaf,0x0c,0x59,0xde,0xad,0xb3,0xe4,0xbe,0x36,0x2c,0xd7,
+  0x97,0x8a,0x7f,0xc9,0xfd,0x4c,0xb9,0xf6,0x60,0x15,0xbb,0x6b,0xf4,0xee,0xe9,0xbd,
+  0x67,0x5e,0x43,0x7a,0x94,0xa8,0xae,0x13,0x85,0x62,0xc3,0x22,0xbb,0xec,0x44,0x2e,
+  0xe2,0xba,0x04,0x63,0x3f,0x86,0x3c,0x73,0x8f,0x28,0x2e,0x2a,0xdb,0xd0,0x29,0xb5,
+  0x52,0xa7,0xd5,0x6e,0xd7,0x61,0x34,0x98,0x37,0xa0,0x1d,0x37,0xa1,0xcd,0xbd,0x16,
+  0x29,0xf5,0x8f,0x10,0x58,0xe9,0x81,0xb0,0xa9,0x8f,0x8e,0xab,0xd6,0x98,0x1c,0xf2,
+  0x12,0x28,0x53,0x9e,0x48,0x2c,0xf3,0x2b,0xdf,0x5d,0xa9,0x98,0xca,0x24,0xe9,0xd2,
+  0x08,0x5e,0x19,0x9c,0x3d,0x5a,0xe7,0x11,0xba,0x84,0x92,0x6d,0x11,0xa7,0xee,0x25,
+  0x44,0xe1,0x3d,0x4d,0xe8,0x1a,0x05,0xc2,0x03,0x93,0x34,0xa7,0xa9,0xe0,0x4b,0x9a,
+  0x29,0x17,0xbe,0x98,0xe3,0xef,0x68,0x6e,0xcd,0xcc,0x37,0x1c,0xd7,0x6a,0xad,0xf6,
+  0x34,0xbb,0xec,0x66,0x8a,0x3e,0x53,0xac,0xa4,0x68,0xd1,0xa1,0xad,0x41,0xa3,0xd1,
+  0xaf,0x63,0x12,0x3d,0xd9,0xca,0x3b,0xb6,0x6f,0xad,0xb8,0xa0,0x26,0xe4,0x0d,0x03,
+  0x8f,0xc4,0x4a,0x3b,0x77,0x6f,0x78,0xe0,0x26,0xa2,0xb0,0x1f,0x40,0xbb,0xed,0xe5,
+  0x3c,0x24,0xe5,0xa9,0x1c,0x69,0x59,0xa9,0x6c,0x0b,0xcb,0x99,0xb7,0x70,0x35,0x25,
+  0xa9,0xa2,0x38,0xd5,0x60,0x7b,0x5a,0xde,0xc1,0x46,0x21,0x9c,0xfa,0x49,0x5a,0xc9,
+  0x75,0x53,0x1b,0xd1,0xc8,0xb2,0x28,0xda,0x16,0x78,0x57,0x46,0x1a,0xe8,0xb3,0x29,
+  0xd1,0x33,0x57,0x89,0xb3,0x1c,0xf0,0x93,0xcc,0xfb,0x8f,0x2c,0x9a,0x85,0xb7,0xa9,
+  0xf2,0xa1,0x1f,0x6e,0xc0,0x8b,0x98,0x94,0xa3,0x48,0x0b,0xd4,0x9d,0x6e,0xc8,0x29,
+  0x3f,0xf9,0xae,0xd1,0x63,0x7f,0x74,0xa4,0xd4,0xb5,0x14,0x68,0x7b,0x3c,0x5c,0xf1,
+  0x44,0x81,0xc7,0x23,0x2e,0x46,0x67,0x01,0xe9,0xdc,0xd9,0xf8,0x39,0x9f,0x55,0x6e,
+  0xfa,0xe0,0xf9,0xb0,0xab,0x4f,0x8e,0xe1,0x59,0x6b,0x3d,0xdb,0x64,0x38,0xec,0x52,
+  0xce,0x63,0xcb,0xdc,0xc7,0xfb,0x86,0x26,0x54,0x07,0xa7,0xd3,0x9b,0xd3,0x4c,0xd0,
+  0x68,0x5a,0x56,0x49,0xea,0x5f,0x96,0xfc,0x1f,0x5c,0x21,0xda,0xe7,0xaf,0x5f,0x21,
+  0xd6,0x6f,0x5d,0x3d,0xd4,0xbb,0x27,0x92,0xb4,0x7f,0x86,0xda,0x5a,0xf3,0x8c,0xce,
+  0xdd,0x91,0xf0,0x13,0x46,0xcf,0xc5,0x3a,0x18,0x52,0xac,0x5c,0x2b,0xd0,0x2f,0xc4,
+  0xa5,0xee,0x82,0x2e,0x3e,0x91,0xa1,0xbe,0xe3,0x4f,0xb1,0xe0,0x80,0xf0,0x73,0x91,
+  0x4e,0x9c,0x72,0x5c,0xe3,0x9f,0x34,0x8f,0x7f,0x0b,0xf1,0xc1,0xfe,0xde,0x5a,0xe2,
+  0x9a,0xbe,0x9f,0xf4,0x97,0x41,0x5d,0xa5,0x5b,0x7b,0xe7,0xc7,0x90,0x19,0xef,0x77,
+  0x84,0x46,0xce,0xda,0x26,0xe0,0x44,0x8f,0x80,0x7c,0x19,0xf1,0x29,0x6f,0xe6,0x59,
+  0xc5,0x9c,0x2f,0xa8,0x14,0x6d,0xcb,0xbf,0x70,0x79,0x53,0x6c,0x2e,0x72,0xe2,0xdb,
+  0x35,0x66,0x9e,0x30,0xd3,0x56,0x0e,0x01,0xfe,0x54,0xbc,0x9f,0xbb,0x6d,0x7b,0xc7,
+  0x62,0x47,0x9f,0xb8,0x04,0x7b,0xfe,0x1d,0x58,0x29,0x5c,0x21,0x18,0xbf,0x41,0x8f,
+  0x7c,0xb4,0xc7,0x63,0x33,0x4f,0x5a,0x65,0x68,0xd6,0x24,0x0b,0x30,0x2f,0x65,0x38,
+  0xac,0xa6,0xe8,0x7f,0xb2,0xe3,0xe7,0x32,0x93,0x45,0x97,0xd3,0x1f,0x05,0x38,0x71,
+  0xe2,0x03,0x86,0xc1,0x5a,0x0d,0x1a,0x43,0xfe,0x3a,0xbf,0xf8,0x7f,0x1f,0xe5,0x41,
+  0xed,0x22,0xa4,0xef,0xe8,0x83,0xb1,0x66,0xd6,0xbf,0x50,0x8f,0x84,0x32,0x6a,0x0d,
+  0x00,0x00
+};
+#endif // if defined(WEBSERVER_INCLUDE_JS) && defined(WEBSERVER_LOG)
+
+#if defined(WEBSERVER_INCLUDE_JS) && defined(WEBSERVER_GITHUB_COPY)
+// github_clipboard.js: 872 bytes minified, 469 bytes gzip
+# define WEBSTATIC_GITHUB_CLIPBOARD_JS_AVAILABLE
+static const char WEBSTATIC_GITHUB_CLIPBOARD_JS_URL[] PROGMEM  = "/static/github_clipboard.5e403535.js";
+static const char WEBSTATIC_GITHUB_CLIPBOARD_JS_ETAG[] PROGMEM = "\"5e403535\"";
+static const char WEBSTATIC_GITHUB_CLIPBOARD_JS_TYPE[] PROGMEM = "application/javascript";
+static const uint8_t WEBSTATIC_GITHUB_CLIPBOARD_JS_GZ[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0x85,0x92,0x51,0x6f,0x9b,0x30,
+  0x10,0xc7,0xdf,0xf9,0x14,0xb7,0x4a,0x13,0x50,0x56,0x92,0xf5,0x31,0x34,0x9d,0xd4,
+  0x2c,0xda,0x22,0x6d,0xd2,0xb4,0x56,0x7d,0x01,0x16,0x19,0xb8,0xb4,0x96,0x8c,0x6d,
+  0xd9,0x26,0x0a,0x5a,0xf2,0xdd,0x67,0x43,0x43,0x48,0x36,0x69,0x3c,0x00,0x3e,0xdf,
+  0xff,0x77,0x7f,0x9f,0x6f,0xd3,0xf0,0xd2,0x50,0xc1,0x41,0xa3,0xf9,0x42,0xcd,0x6b,
+  0x53,0x2c,0x18,0x95,0x85,0x20,0xaa,0x0a,0x42,0xf8,0xed,0x6d,0x89,0x82,0xf2,0x18,
+  0x81,0x39,0xf8,0xcb,0xc7,0x1f,0xb0,0x24,0xba,0x85,0x3d,0xac,0xf8,0x46,0xa8,0x9a,
+  0x74,0xf2,0x7d,0xc6,0xe1,0xc6,0x3d,0xfb,0xfe,0x9d,0x71,0x3f,0xf1,0x6a,0xb2,0x5b,
+  0x33,0x21,0xa4,0xd5,0x7d,0x9c,0x4e,0x13,0xcf,0xa6,0x43,0xe0,0x88,0xd4,0x45,0x12,
+  0xfb,0xb9,0x83,0x63,0x8e,0x5d,0x45,0xd1,0x50,0xb1,0x51,0x6b,0xda,0x95,0x2b,0x85,
+  0x6c,0x9f,0x70,0x67,0xd6,0x3e,0x44,0x40,0x93,0x6e,0xd7,0xa0,0x36,0x76,0xaf,0x12,
+  0x65,0x53,0x23,0x37,0xf1,0x0b,0x9a,0x25,0x43,0xf7,0xfb,0xd0,0xae,0xaa,0xa0,0x17,
+  0x87,0x89,0x47,0x37,0x10,0xf4,0xb9,0x73,0xe0,0x0d,0x63,0x8e,0xee,0x2a,0x0f,0xb6,
+  0x22,0x6b,0xc2,0x3b,0x00,0x32,0x8d,0x6f,0x85,0x35,0x4a,0xa2,0x88,0x11,0xea,0xb1,
+  0xad,0x0b,0xc1,0x9c,0x83,0xbd,0xdf,0x93,0x28,0xbc,0x87,0x5b,0x87,0x9a,0x3a,0xce,
+  0x65,0x62,0x64,0x33,0xed,0x99,0xbd,0x83,0x77,0xea,0x96,0x8d,0xb9,0xf2,0x31,0xe5,
+  0x1c,0xd5,0xd7,0xa7,0xef,0xdf,0x62,0x85,0x92,0x91,0x12,0x83,0xc9,0x5d,0xfa,0x50,
+  0xe4,0xe9,0x4f,0x95,0x67,0xfa,0x3a,0x9b,0x7c,0xba,0x9f,0xbc,0xd0,0xfa,0x43,0x47,
+  0x08,0xad,0xab,0x0b,0xb8,0xf5,0x78,0xc6,0x9d,0x9f,0x6e,0x64,0x44,0xcc,0x26,0xe9,
+  0xe7,0x2a,0x4f,0x57,0x34,0x4f,0x9f,0xb7,0xff,0xe0,0x26,0xff,0x25,0xa4,0xbf,0xee,
+  0xf3,0xeb,0xa3,0xc4,0x09,0xfa,0x66,0xd7,0x72,0xc5,0x65,0x73,0xd6,0xf1,0x52,0x21,
+  0x31,0xf8,0xd6,0xf4,0xc0,0x37,0xf6,0x82,0x88,0x0d,0x39,0xcd,0x90,0x1f,0x6b,0xd3,
+  0x32,0x74,0x1d,0x94,0x42,0x53,0x37,0x24,0x33,0x20,0x85,0x16,0xac,0x31,0x98,0x30,
+  0xdc,0x98,0x19,0xdc,0xd8,0xa9,0x98,0xca,0x5d,0x02,0x46,0xc8,0x61,0xe5,0x8f,0x19,
+  0x43,0xeb,0xc6,0x96,0x13,0x6f,0x30,0x52,0x88,0xaa,0x8d,0x89,0x94,0xc8,0xab,0xc5,
+  0x2b,0x65,0x55,0x30,0x48,0xcf,0xad,0x20,0xc3,0xd2,0x04,0xe1,0x48,0x89,0x3b,0x2c,
+  0x17,0xa2,0xae,0x09,0xaf,0x82,0x6e,0xca,0xfc,0xf0,0x92,0xab,0xb0,0x16,0x5b,0xfc,
+  0x9b,0x4b,0x18,0x2a,0x7b,0xea,0x85,0x90,0x14,0xab,0x19,0x5c,0xb9,0xd1,0x1c,0xdd,
+  0x3a,0xf8,0x57,0xf6,0x40,0xa7,0xc8,0x3b,0x3f,0xf4,0x0e,0x7f,0x00,0xb3,0x7a,0x61,
+  0xe6,0x68,0x03,0x00,0x00
+};
+#endif // if defined(WEBSERVER_INCLUDE_JS) && defined(WEBSERVER_GITHUB_COPY)
+
+#if defined(WEBSERVER_INCLUDE_JS)
+// reboot.js: 529 bytes minified, 311 bytes gzip
+# define WEBSTATIC_REBOOT_JS_AVAILABLE
+static const char WEBSTATIC_REBOOT_JS_URL[] PROGMEM  = "/static/reboot.b74691ca.js";
+static const char WEBSTATIC_REBOOT_JS_ETAG[] PROGMEM = "\"b74691ca\"";
+static const char WEBSTATIC_REBOOT_JS_TYPE[] PROGMEM = "application/javascript";
+static const uint8_t WEBSTATIC_REBOOT_JS_GZ[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0x8d,0x91,0x4f,0x4b,0xc3,0x40,
+  0x10,0xc5,0xef,0xf9,0x14,0xc3,0x5e,0x92,0xd0,0xb0,0x82,0xde,0xac,0x51,0x10,0x8a,
+  0x2d,0xb4,0x20,0xa5,0x07,0xaf,0xc9,0x66,0x0c,0x4b,0x37,0xb3,0x71,0x77,0xb6,0x7f,
+  0x10,0xbf,0xbb,0x1b,0x23,0x68,0x6d,0x0f,0xde,0x76,0x86,0x79,0x6f,0x7e,0xf3,0x56,
+  0x43,0x09,0x8d,0x55,0xa1,0x43,0x62,0xd9,0x22,0xcf,0x0c,0x0e,0xcf,0xc7,0xe3,0xa2,
+  0xc9,0x84,0xab,0xb9,0xf3,0xad,0xc8,0x8b,0x44,0x4b,0x4d,0x84,0x6e,0xbe,0x59,0x2d,
+  0xa3,0x40,0x3c,0x1b,0xac,0x3c,0x82,0xc3,0xda,0x5a,0xbe,0x85,0x3b,0x4d,0x7d,0x60,
+  0xd0,0x4d,0x99,0x8e,0xad,0x14,0x94,0xa9,0xbc,0x2f,0xd3,0x3a,0x30,0x5b,0x02,0xa3,
+  0x69,0x9b,0xc2,0xae,0x32,0x01,0xcb,0x74,0xfd,0x3d,0xc2,0xc7,0x3e,0x56,0x3e,0xd4,
+  0x9d,0x8e,0x95,0x25,0x65,0xb4,0xda,0x46,0x87,0x2c,0x4f,0xef,0xc5,0x34,0xd9,0x55,
+  0x0e,0x0e,0x71,0x19,0xe1,0x1e,0x5e,0x56,0xcb,0x39,0x73,0xbf,0xc6,0xb7,0x80,0x9e,
+  0xa7,0xc9,0x6b,0x20,0xc5,0x3a,0x1a,0x37,0x59,0x0e,0xef,0x7f,0xe9,0x44,0x91,0xa8,
+  0x08,0xe8,0x36,0xba,0x43,0x1b,0x38,0xe3,0x3c,0xf9,0xf8,0x91,0xa8,0x33,0xc9,0x24,
+  0x6a,0x64,0x14,0x1d,0xa4,0x25,0x63,0xab,0x66,0x88,0xe4,0xab,0xea,0x91,0x32,0xf1,
+  0x34,0xdb,0x88,0x02,0xf6,0x9a,0x1a,0xbb,0x97,0xc6,0xaa,0x6a,0x70,0x91,0xd6,0xe9,
+  0x56,0x53,0x3e,0x8c,0x79,0xa4,0x88,0xf1,0x7b,0x45,0x7d,0x89,0x6a,0x3c,0x5b,0x53,
+  0x2b,0x87,0x5d,0x1c,0x5b,0x1e,0x79,0x41,0x8c,0x2e,0xe6,0x92,0xa9,0x02,0xae,0xf1,
+  0xe6,0xc4,0xc5,0x5d,0x04,0x85,0xcc,0x8d,0x29,0x44,0xa7,0xfc,0x14,0xba,0xfe,0x1f,
+  0x34,0x4c,0x40,0x5c,0x3d,0xa8,0xae,0x29,0xc7,0xcf,0x12,0x27,0x57,0x7c,0x02,0xfe,
+  0x43,0x48,0x68,0x11,0x02,0x00,0x00
+};
+#endif // if defined(WEBSERVER_INCLUDE_JS)
+
+#if defined(WEBSERVER_INCLUDE_JS) && defined(WEBSERVER_DEVICES)
+// update_sensor_values_device_page.js: 1949 bytes minified, 710 bytes gzip
+# define WEBSTATIC_UPDATE_SENSOR_VALUES_DEVICE_PAGE_JS_AVAILABLE
+static const char WEBSTATIC_UPDATE_SENSOR_VALUES_DEVICE_PAGE_JS_URL[] PROGMEM  = "/static/update_sensor_values_device_page.06de2a5f.js";
+static const char WEBSTATIC_UPDATE_SENSOR_VALUES_DEVICE_PAGE_JS_ETAG[] PROGMEM = "\"06de2a5f\"";
+static const char WEBSTATIC_UPDATE_SENSOR_VALUES_DEVICE_PAGE_JS_TYPE[] PROGMEM = "application/javascript";
+static const uint8_t WEBSTATIC_UPDATE_SENSOR_VALUES_DEVICE_PAGE_JS_GZ[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0xff,0xbd,0x55,0xdf,0x4f,0xdb,0x30,
+  0x10,0x7e,0xef,0x5f,0x71,0x3c,0xc5,0x51,0x59,0x16,0x90,0x78,0xa1,0x94,0x49,0x1b,
+  0xa0,0x21,0xb1,0x32,0x8d,0x6a,0x2f,0x08,0x4d,0x26,0xbd,0xb6,0x59,0x1c,0x3b,0xb3,
+  0x9d,0xd2,0x6a,0xe2,0x7f,0xdf,0xd9,0x49,0xda,0x24,0x05,0x0d,0xed,0x61,0xaa,0xd4,
+  0x38,0xf7,0xf3,0xbb,0xef,0xce,0x17,0xa1,0x54,0x71,0x81,0x37,0xf4,0xcf,0x8e,0xe2,
+  0x38,0x3e,0x84,0x38,0x1c,0x0d,0xe6,0xa5,0x4c,0x6c,0xaa,0x24,0x88,0x9d,0xd6,0xa6,
+  0x39,0x5e,0x29,0x3d,0xc1,0xb5,0x3d,0x04,0x4e,0xea,0x15,0x7e,0xc3,0x5f,0x25,0x1a,
+  0x6b,0x42,0xf8,0x3d,0x58,0x71,0x0d,0x39,0x5f,0xa7,0x79,0x99,0x37,0x62,0x18,0xc3,
+  0xd1,0xc8,0x2b,0x92,0xea,0x91,0x55,0x0f,0xd4,0x9a,0x54,0x41,0x50,0xbd,0x95,0x5a,
+  0xb8,0xb7,0xf7,0x3f,0x8d,0x92,0x1f,0x56,0x29,0x3e,0x8d,0x0d,0x4a,0xa3,0x74,0x59,
+  0xcc,0xb8,0xc5,0xda,0x28,0x59,0x62,0x92,0x91,0x59,0x3c,0x1a,0xa4,0x73,0x60,0xa9,
+  0x99,0xf0,0x09,0xeb,0x81,0x70,0x28,0xba,0x22,0x72,0xe8,0x41,0x1a,0x0d,0x9e,0x7d,
+  0x80,0x56,0x31,0x30,0x1e,0x83,0x2c,0x85,0x70,0xee,0x1d,0x31,0x38,0x3e,0x9c,0x83,
+  0x03,0x90,0xd2,0xbb,0x41,0x7b,0x2d,0x2d,0xea,0x15,0x17,0xac,0x61,0x88,0x39,0x37,
+  0x17,0xb1,0x42,0x78,0x4e,0xf4,0x91,0x20,0x11,0xc8,0xf5,0xd6,0x36,0x25,0x46,0x35,
+  0xda,0x52,0x4b,0x17,0x6d,0x38,0xec,0x82,0xac,0x2a,0xea,0x01,0x3f,0xef,0x03,0xf7,
+  0x51,0x6b,0x12,0x88,0xd4,0x67,0x40,0x61,0x90,0x64,0x73,0xb4,0xc9,0x92,0x11,0x87,
+  0x61,0x64,0x97,0x28,0x77,0xb8,0x34,0x9a,0x42,0x49,0x83,0x4d,0x6f,0x08,0x48,0x89,
+  0x97,0xd2,0xea,0x4d,0x95,0xb0,0xd1,0x47,0xc6,0x72,0x5b,0x1a,0x38,0x20,0x1a,0x8e,
+  0xe3,0x0a,0x3d,0xc9,0x95,0xc0,0x48,0xa8,0x05,0x0b,0xa8,0xf7,0x99,0x01,0x91,0x66,
+  0x08,0x94,0x40,0x23,0x3c,0x71,0x03,0x1c,0x0a,0xad,0x1e,0x05,0xe6,0x11,0xdc,0x55,
+  0xee,0x9f,0xd4,0x0c,0x4f,0x21,0x80,0x21,0xf4,0x02,0x77,0x6a,0xdf,0xea,0x5c,0xb3,
+  0x59,0x1f,0x32,0xf5,0x9b,0xef,0x77,0xc1,0x49,0xa3,0xe9,0xf4,0x86,0xa6,0x52,0x69,
+  0xe2,0xd9,0x4f,0x01,0x24,0x70,0x56,0x69,0xee,0xfc,0xb0,0x98,0x48,0xa0,0x5c,0xd8,
+  0x25,0x29,0x86,0xc3,0xa6,0x25,0x6d,0xfd,0x7d,0xf2,0x10,0x2d,0xb9,0xb9,0x7d,0x92,
+  0x5f,0xb5,0x2a,0x50,0xdb,0x0d,0x0b,0xa6,0xdc,0x64,0xdf,0x1d,0x2d,0x26,0xf0,0xc3,
+  0xe3,0xe3,0x57,0x53,0x06,0x59,0x2f,0xbe,0xf3,0xdf,0xd9,0x6f,0xb3,0x65,0x55,0x36,
+  0x62,0xd5,0xd3,0xdc,0x50,0xdc,0xc0,0x7e,0xd1,0xf9,0x3e,0x7b,0x88,0xfc,0xc9,0xb5,
+  0x31,0xe1,0xd4,0x3f,0x60,0x74,0x25,0xc2,0x7e,0x04,0x92,0x45,0x92,0xe7,0xde,0x6c,
+  0x9e,0x4a,0x2e,0xc4,0xa6,0x2e,0xac,0x65,0xe6,0xda,0x16,0x4c,0x37,0x05,0x5e,0x6a,
+  0xad,0x74,0xe0,0xc1,0x60,0x5e,0xf8,0xf8,0x6f,0x45,0x31,0xc3,0x24,0xcd,0xb9,0x30,
+  0x6f,0x73,0x9a,0xe8,0x8b,0xda,0xbe,0x1a,0xa4,0xae,0xf7,0x19,0x1c,0x9f,0x9c,0xf4,
+  0x51,0x14,0x5c,0x1b,0xbc,0x12,0x8a,0x5b,0xb6,0x15,0x53,0xf3,0xd5,0x55,0xba,0xc6,
+  0x59,0x37,0x40,0xd8,0x5c,0x38,0x5f,0xe3,0xf5,0x85,0x5b,0x0d,0xfe,0xf8,0xc3,0xcd,
+  0x16,0x7b,0x09,0xda,0xa4,0xcc,0x1f,0x51,0xc3,0x3b,0x38,0x0a,0xc9,0x24,0x78,0xdd,
+  0xb0,0x57,0x78,0xcb,0x6f,0xb4,0x4b,0x39,0x21,0xc6,0x5b,0x69,0x5d,0x03,0xfe,0x57,
+  0xea,0x4b,0xba,0x50,0x28,0xfd,0xcc,0xab,0xa4,0x74,0xc7,0x68,0x81,0xb6,0x96,0x7e,
+  0xdc,0x5c,0xcf,0x58,0x4d,0x4a,0x1f,0xef,0x1b,0x1d,0xab,0xd2,0xc2,0x51,0x6b,0x86,
+  0x6a,0xc7,0x83,0xd6,0x0e,0x6c,0x2b,0xa2,0x54,0x4a,0xd4,0x9f,0xa7,0x5f,0x6e,0x28,
+  0xf6,0xb6,0x75,0xcd,0x12,0xdd,0xcb,0xbf,0x17,0xa6,0xa5,0xec,0x84,0xfa,0xcb,0x84,
+  0x91,0x97,0xa3,0xf3,0x34,0x70,0x99,0x76,0xbf,0xd7,0xf6,0xc2,0xfe,0xb6,0x7d,0xed,
+  0xb3,0x15,0xb7,0xb7,0x91,0x1b,0xb5,0x30,0xf2,0x17,0x70,0xb7,0x83,0xea,0x8b,0xd8,
+  0x5e,0x81,0xee,0x1e,0xe6,0x68,0x0c,0x5f,0xb8,0xe9,0xec,0x82,0x38,0xf1,0x9f,0x88,
+  0x7f,0x07,0xd0,0x5e,0xe9,0x83,0xe7,0x43,0x68,0x19,0x3b,0x78,0x7f,0x00,0xf3,0x32,
+  0x07,0xa0,0x9d,0x07,0x00,0x00
+};
+#endif // if defined(WEBSERVER_INCLUDE_JS) && defined(WEBSERVER_DEVICES)
+
+static const WebStaticAsset_t web_static_assets[] PROGMEM = {
+#ifdef WEBSTATIC_ESPEASY_DEFAULT_CSS_AVAILABLE
+  { WEBSTATIC_ESPEASY_DEFAULT_CSS_URL, WEBSTATIC_ESPEASY_DEFAULT_CSS_ETAG, WEBSTATIC_ESPEASY_DEFAULT_CSS_TYPE, WEBSTATIC_ESPEASY_DEFAULT_CSS_GZ, sizeof(WEBSTATIC_ESPEASY_DEFAULT_CSS_GZ) },
+#endif
+#ifdef WEBSTATIC_FETCH_AND_PARSE_LOG_JS_AVAILABLE
+  { WEBSTATIC_FETCH_AND_PARSE_LOG_JS_URL, WEBSTATIC_FETCH_AND_PARSE_LOG_JS_ETAG, WEBSTATIC_FETCH_AND_PARSE_LOG_JS_TYPE, WEBSTATIC_FETCH_AND_PARSE_LOG_JS_GZ, sizeof(WEBSTATIC_FETCH_AND_PARSE_LOG_JS_GZ) },
+#endif
+#ifdef WEBSTATIC_GITHUB_CLIPBOARD_JS_AVAILABLE
+  { WEBSTATIC_GITHUB_CLIPBOARD_JS_URL, WEBSTATIC_GITHUB_CLIPBOARD_JS_ETAG, WEBSTATIC_GITHUB_CLIPBOARD_JS_TYPE, WEBSTATIC_GITHUB_CLIPBOARD_JS_GZ, sizeof(WEBSTATIC_GITHUB_CLIPBOARD_JS_GZ) },
+#endif
+#ifdef WEBSTATIC_REBOOT_JS_AVAILABLE
+  { WEBSTATIC_REBOOT_JS_URL, WEBSTATIC_REBOOT_JS_ETAG, WEBSTATIC_REBOOT_JS_TYPE, WEBSTATIC_REBOOT_JS_GZ, sizeof(WEBSTATIC_REBOOT_JS_GZ) },
+#endif
+#ifdef WEBSTATIC_UPDATE_SENSOR_VALUES_DEVICE_PAGE_JS_AVAILABLE
+  { WEBSTATIC_UPDATE_SENSOR_VALUES_DEVICE_PAGE_JS_URL, WEBSTATIC_UPDATE_SENSOR_VALUES_DEVICE_PAGE_JS_ETAG, WEBSTATIC_UPDATE_SENSOR_VALUES_DEVICE_PAGE_JS_TYPE, WEBSTATIC_UPDATE_SENSOR_VALUES_DEVICE_PAGE_JS_GZ, sizeof(WEBSTATIC_UPDATE_SENSOR_VALUES_DEVICE_PAGE_JS_GZ) },
+#endif
+  { nullptr, nullptr, nullptr, nullptr, 0 }
+};
+
+#endif // ifdef WEBSERVER_STATIC_ASSETS
+
+#endif // STATIC_WEBSTATICASSETS_GZ_H
@@ -1,6 +1,10 @@
 #include "../Static/WebStaticData.h"
 
+#include "../Static/WebStaticAssets.h"
+#include "../Static/WebStaticAssets_gz.h"
+
 #include "../Globals/Cache.h"
+#include "../Globals/Services.h"
 #include "../Helpers/ESPEasy_Storage.h"
 #include "../WebServer/HTML_wrappers.h"
 #include "../WebServer/LoadFromFS.h"
@@ -23,7 +27,14 @@ void serve_CSS() {
     addHtml(F("</style>"));
     return;
   }
-  #ifndef WEBSERVER_CSS
+  #ifdef WEBSTATIC_ESPEASY_DEFAULT_CSS_AVAILABLE
+  addHtml(F("<link"));
+  addHtmlAttribute(F("rel"), F("stylesheet"));
+  addHtmlAttribute(F("type"), F("text/css"));
+  addHtmlAttribute(F("href"), FPSTR(WEBSTATIC_ESPEASY_DEFAULT_CSS_URL));
+  addHtml('/');
+  addHtml('>');
+  #elif !defined(WEBSERVER_CSS)
   addHtml(F("<link"));
   addHtmlAttribute(F("rel"), F("stylesheet"));
   addHtmlAttribute(F("type"), F("text/css"));
@@ -50,6 +61,70 @@ void serve_favicon() {
   #endif
 }
 
+#ifdef WEBSERVER_STATIC_ASSETS
+const __FlashStringHelper * getStaticAsset_JS_URL(JSfiles_e JSfile) {
+  switch (JSfile) {
+    case JSfiles_e::UpdateSensorValuesDevicePage:
+      #ifdef WEBSTATIC_UPDATE_SENSOR_VALUES_DEVICE_PAGE_JS_AVAILABLE
+      return FPSTR(WEBSTATIC_UPDATE_SENSOR_VALUES_DEVICE_PAGE_JS_URL);
+      #endif
+      break;
+    case JSfiles_e::FetchAndParseLog:
+      #ifdef WEBSTATIC_FETCH_AND_PARSE_LOG_JS_AVAILABLE
+      return FPSTR(WEBSTATIC_FETCH_AND_PARSE_LOG_JS_URL);
+      #endif
+      break;
+    case JSfiles_e::GitHubClipboard:
+      #ifdef WEBSTATIC_GITHUB_CLIPBOARD_JS_AVAILABLE
+      return FPSTR(WEBSTATIC_GITHUB_CLIPBOARD_JS_URL);
+      #endif
+      break;
+    case JSfiles_e::Reboot:
+      #ifdef WEBSTATIC_REBOOT_JS_AVAILABLE
+      return FPSTR(WEBSTATIC_REBOOT_JS_URL);
+      #endif
+      break;
+    case JSfiles_e::SaveRulesFile:
+    case JSfiles_e::Toasting:
+      // Still embedded inline, as they depend on other inline script parts.
+      break;
+  }
+  return nullptr;
+}
+
+bool handle_static_asset(const String& uri) {
+  if (!uri.startsWith(F("/static/"))) {
+    return false;
+  }
+
+  for (size_t i = 0;; ++i) {
+    WebStaticAsset_t asset;
+    memcpy_P(&asset, &web_static_assets[i], sizeof(WebStaticAsset_t));
+
+    if (asset.url == nullptr) {
+      return false;
+    }
+
+    if (uri.equals(String(FPSTR(asset.url)))) {
+      const String etag(FPSTR(asset.etag));
+
+      // The URL contains the content hash, so a matching ETag means the browser has this exact content.
+      if (web_server.hasHeader(F("If-None-Match")) &&
+          (web_server.header(F("If-None-Match")).indexOf(etag) != -1)) {
+        web_server.send(304);
+        return true;
+      }
+      web_server.sendHeader(F("Cache-Control"),    F("public, max-age=31536000, immutable"));
+      web_server.sendHeader(F("ETag"),             etag);
+      web_server.sendHeader(F("Content-Encoding"), F("gzip"));
+      web_server.send_P(200, asset.contentType, reinterpret_cast<PGM_P>(asset.data), asset.size);
+      return true;
+    }
+  }
+  return false;
+}
+#endif // ifdef WEBSERVER_STATIC_ASSETS
+
 void serve_JS(JSfiles_e JSfile) {
     String url;
     switch (JSfile) {
@@ -84,6 +159,17 @@ void serve_JS(JSfiles_e JSfile) {
         html_add_script_end();
         return;
         #else
+        #ifdef WEBSERVER_STATIC_ASSETS
+        const __FlashStringHelper *assetUrl = getStaticAsset_JS_URL(JSfile);
+        if (assetUrl != nullptr) {
+          addHtml(F("<script"));
+          addHtml(F(" defer"));
+          addHtmlAttribute(F("src"), assetUrl);
+          addHtml('>');
+          html_add_script_end();
+          return;
+        }
+        #endif
         html_add_script(true);
         switch (JSfile) {
           case JSfiles_e::UpdateSensorValuesDevicePage:
@@ -3,6 +3,8 @@
 
 #include "../../ESPEasy_common.h"
 
+#include "../Static/WebStaticAssets.h"
+
 #define PGMT( pgm_ptr ) ( reinterpret_cast< const __FlashStringHelper * >( pgm_ptr ) )
 
 //-V::569
@@ -25,6 +27,11 @@ enum class JSfiles_e {
 
 void serve_JS(JSfiles_e JSfile);
 
+#ifdef WEBSERVER_STATIC_ASSETS
+// URL of the pre-compressed JS file, or nullptr when it is not available as static asset.
+const __FlashStringHelper * getStaticAsset_JS_URL(JSfiles_e JSfile);
+#endif
+
 
 #ifdef WEBSERVER_FAVICON
 /*********************************************************************************************\
@@ -9,6 +9,8 @@
 
 #include "../Globals/ESPEasyWiFiEvent.h"
 
+#include "../Static/WebStaticAssets.h"
+
 // ********************************************************************************
 // Web Interface handle other requests
 // ********************************************************************************
@@ -17,6 +19,10 @@ void handleNotFound() {
   checkRAM(F("handleNotFound"));
   #endif
 
+  #ifdef WEBSERVER_STATIC_ASSETS
+  if (handle_static_asset(web_server.uri())) { return; }
+  #endif
+
   if (captivePortal()) { // If captive portal redirect instead of displaying the error page.
     return;
   }
@@ -102,6 +102,7 @@ void handle_advanced() {
 #endif
     Settings.NumberExtraWiFiScans = getFormItemInt(LabelType::WIFI_NR_EXTRA_SCANS);
     Settings.UseLastWiFiFromRTC(isFormItemChecked(LabelType::WIFI_USE_LAST_CONN_FROM_RTC));
+    Settings.UseLastWiFiLeaseFromRTC(isFormItemChecked(LabelType::WIFI_USE_LAST_LEASE_FROM_RTC));
     Settings.JSONBoolWithoutQuotes(isFormItemChecked(LabelType::JSON_BOOL_QUOTES));
     Settings.EnableTimingStats(isFormItemChecked(LabelType::ENABLE_TIMING_STATISTICS));
     Settings.AllowTaskValueSetAllPlugins(isFormItemChecked(LabelType::TASKVALUESET_ALL_PLUGINS));
@@ -302,6 +303,8 @@ void handle_advanced() {
     addFormNote(note);
   }
   addFormCheckBox(LabelType::WIFI_USE_LAST_CONN_FROM_RTC, Settings.UseLastWiFiFromRTC());
+  addFormCheckBox(LabelType::WIFI_USE_LAST_LEASE_FROM_RTC, Settings.UseLastWiFiLeaseFromRTC());
+  addFormNote(F("Deep sleep only: Skip DHCP on wake-up when reconnecting to the same AP and the lease is still valid"));
 
 
 
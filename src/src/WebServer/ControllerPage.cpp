@@ -21,6 +21,7 @@
 #include "../Helpers/_Plugin_SensorTypeHelper.h"
 #include "../Helpers/ESPEasy_Storage.h"
 #include "../Helpers/StringConverter.h"
+#include "../Helpers/TaskValueDeadband.h"
 
 
 
@@ -91,6 +92,11 @@ void handle_controllers() {
     addHtmlError(SaveSettings());
 
     if (mustInit) {
+      #ifdef USES_TASK_VALUE_DEADBAND
+      // Values last sent may not have reached the (new) controller.
+      clearTaskValueDeadbandForController(controllerindex);
+      #endif // ifdef USES_TASK_VALUE_DEADBAND
+
       // Init controller plugin using the new settings.
       protocolIndex_t ProtocolIndex = getProtocolIndex_from_ControllerIndex(controllerindex);
 
@@ -8,6 +8,8 @@
 # include "../WebServer/Markup_Buttons.h"
 # include "../WebServer/Markup_Forms.h"
 
+# include "../DataTypes/TaskValueAggregate.h"
+
 # include "../Globals/CPlugins.h"
 # include "../Globals/Device.h"
 # include "../Globals/ExtraTaskSettings.h"
@@ -23,6 +25,8 @@
 # include "../Helpers/Hardware.h"
 # include "../Helpers/StringConverter.h"
 # include "../Helpers/StringGenerator_GPIO.h"
+# include "../Helpers/TaskValueAggregation.h"
+# include "../Helpers/TaskValueDeadband.h"
 
 # include "../../_Plugin_Helper.h"
 
@@ -201,6 +205,8 @@ void addDeviceSelect(const __FlashStringHelper * name,  int choice)
   addSelector_Head_reloadOnChange(name);
   addSelector_Item(F("- None -"), 0, false);
 
+  sortDeviceIndexArray();
+
   for (uint8_t x = 0; x <= deviceCount; x++)
   {
     const deviceIndex_t deviceIndex = DeviceIndex_sorted[x];
@@ -369,7 +375,33 @@ void handle_devices_CopySubmittedSettings(taskIndex_t taskIndex, pluginID_t task
     strncpy_webserver_arg(ExtraTaskSettings.TaskDeviceFormula[varNr], String(F("TDF")) + (varNr + 1));
     update_whenset_FormItemInt(String(F("TDVD")) + (varNr + 1), ExtraTaskSettings.TaskDeviceValueDecimals[varNr]);
     strncpy_webserver_arg(ExtraTaskSettings.TaskDeviceValueNames[varNr], String(F("TDVN")) + (varNr + 1));
+    # ifdef USES_TASK_VALUE_AGGREGATION
+    update_whenset_FormItemInt(String(F("TDAG")) + (varNr + 1), ExtraTaskSettings.TaskDeviceValueAggregate[varNr]);
+    # endif // ifdef USES_TASK_VALUE_AGGREGATION
+    # ifdef USES_TASK_VALUE_DEADBAND
+
+    if (Device[DeviceIndex].SendDataOption) {
+      ExtraTaskSettings.TaskDeviceValueDeadband[varNr]        = getFormItemFloat(String(F("TDDB")) + (varNr + 1));
+      ExtraTaskSettings.TaskDeviceValueDeadbandPercent[varNr] = getFormItemFloat(String(F("TDDP")) + (varNr + 1));
+    }
+    # endif // ifdef USES_TASK_VALUE_DEADBAND
+  }
+  # ifdef USES_TASK_VALUE_AGGREGATION
+
+  if (Device[DeviceIndex].SendDataOption) {
+    ExtraTaskSettings.AggregateWindowCount = getFormItemInt(F("TDAWC"), 0);
+    ExtraTaskSettings.AggregateWindowTime  = getFormItemInt(F("TDAWT"), 0);
+    ExtraTaskSettings.aggregateRawRuleEvents(isFormItemChecked(F("TDAR")));
   }
+  clearTaskValueAggregation(taskIndex);
+  # endif // ifdef USES_TASK_VALUE_AGGREGATION
+  # ifdef USES_TASK_VALUE_DEADBAND
+
+  if (Device[DeviceIndex].SendDataOption) {
+    ExtraTaskSettings.DeadbandHeartbeat = getFormItemInt(F("TDDBH"), 0);
+  }
+  clearTaskValueDeadband(taskIndex);
+  # endif // ifdef USES_TASK_VALUE_DEADBAND
 
   // allow the plugin to save plugin-specific form settings.
   {
@@ -1209,6 +1241,24 @@ void devicePage_show_controller_config(taskIndex_t taskIndex, deviceIndex_t Devi
     addRowLabel(F("Single event with all values"));
     addCheckBox(F("TVSE"), Settings.CombineTaskValues_SingleEvent(taskIndex));
     addFormNote(F("Unchecked: Send event per value. Checked: Send single event (taskname#All) containing all values "));
+    # ifdef USES_TASK_VALUE_AGGREGATION
+
+    addFormNumericBox(F("Aggregation Window"), F("TDAWC"), ExtraTaskSettings.AggregateWindowCount, 0, 65535);
+    addUnit(F("samples"));
+    addFormNumericBox(F("Aggregation Window Time"), F("TDAWT"), ExtraTaskSettings.AggregateWindowTime, 0, 65535);
+    addUnit(F("sec"));
+    addFormNote(F("Only used when an aggregate is set for a value. Window ends at whichever is reached first. Both 0: Interval"));
+
+    addRowLabel(F("Rules Use Raw Values"));
+    addCheckBox(F("TDAR"), ExtraTaskSettings.aggregateRawRuleEvents());
+    addFormNote(F("Checked: Rules events for each sample. Unchecked: Rules events with the aggregates"));
+    # endif // ifdef USES_TASK_VALUE_AGGREGATION
+    # ifdef USES_TASK_VALUE_DEADBAND
+
+    addFormNumericBox(F("Max. Silent Interval"), F("TDDBH"), ExtraTaskSettings.DeadbandHeartbeat, 0, 65535);
+    addUnit(F("sec"));
+    addFormNote(F("Values are only sent to a controller when changed more than their deadband, or after this interval. 0: No interval"));
+    # endif // ifdef USES_TASK_VALUE_DEADBAND
     addFormSeparator(2);
 
     for (controllerIndex_t controllerNr = 0; controllerNr < CONTROLLER_MAX; controllerNr++)
@@ -1279,6 +1329,21 @@ void devicePage_show_task_values(taskIndex_t taskIndex, deviceIndex_t DeviceInde
     {
       html_table_header(F("Decimals"), 30);
     }
+    # ifdef USES_TASK_VALUE_AGGREGATION
+
+    if (Device[DeviceIndex].SendDataOption)
+    {
+      html_table_header(F("Aggregate"), 100);
+    }
+    # endif // ifdef USES_TASK_VALUE_AGGREGATION
+    # ifdef USES_TASK_VALUE_DEADBAND
+
+    if (Device[DeviceIndex].SendDataOption)
+    {
+      html_table_header(F("Deadband"), 60);
+      html_table_header(F("Deadband %"), 60);
+    }
+    # endif // ifdef USES_TASK_VALUE_DEADBAND
 
     // table body
     for (uint8_t varNr = 0; varNr < valueCount; varNr++)
@@ -1306,6 +1371,36 @@ void devicePage_show_task_values(taskIndex_t taskIndex, deviceIndex_t DeviceInde
         id += (varNr + 1);
         addNumericBox(id, ExtraTaskSettings.TaskDeviceValueDecimals[varNr], 0, 6);
       }
+      # ifdef USES_TASK_VALUE_AGGREGATION
+
+      if (Device[DeviceIndex].SendDataOption)
+      {
+        html_TD();
+        String id = F("TDAG"); // ="taskdevicevalueaggregate"
+        id += (varNr + 1);
+        addSelector_Head(id);
+
+        for (uint8_t i = 0; i < static_cast<uint8_t>(TaskValueAggregate_e::MAX_TYPE); ++i) {
+          addSelector_Item(toString(static_cast<TaskValueAggregate_e>(i)), i, ExtraTaskSettings.TaskDeviceValueAggregate[varNr] == i);
+        }
+        addSelector_Foot();
+      }
+      # endif // ifdef USES_TASK_VALUE_AGGREGATION
+      # ifdef USES_TASK_VALUE_DEADBAND
+
+      if (Device[DeviceIndex].SendDataOption)
+      {
+        html_TD();
+        String id = F("TDDB"); // ="taskdevicevaluedeadband"
+        id += (varNr + 1);
+        addFloatNumberBox(id, ExtraTaskSettings.TaskDeviceValueDeadband[varNr], 0.0f, 1000000.0f);
+
+        html_TD();
+        id  = F("TDDP"); // ="taskdevicevaluedeadbandpercent"
+        id += (varNr + 1);
+        addFloatNumberBox(id, ExtraTaskSettings.TaskDeviceValueDeadbandPercent[varNr], 0.0f, 100.0f, 2);
+      }
+      # endif // ifdef USES_TASK_VALUE_DEADBAND
     }
   }
 }
@@ -120,6 +120,7 @@ void handle_i2cscanner_json() {
   for (int i = 0; i < 128; i++) {
     mainBusDevices[i] = false;
   }
+  I2CMultiplexerOff(); // Make sure no channel is left selected while scanning the main bus
   nDevices = scanI2CbusForDevices_json(Settings.I2C_Multiplexer_Addr, -1, nDevices, mainBusDevices); // Channel -1 = standard I2C bus
 #else
   nDevices = scanI2CbusForDevices_json(-1, -1, nDevices); // Standard scan
@@ -147,6 +148,8 @@ String getKnownI2Cdevice(uint8_t address) {
   String result;
 
   #if USE_I2C_DEVICE_SCAN
+  sortDeviceIndexArray();
+
   for (uint8_t x = 0; x <= deviceCount; x++) {
     const deviceIndex_t deviceIndex = DeviceIndex_sorted[x];
 
@@ -434,6 +437,7 @@ void handle_i2cscanner() {
     for (int i = 0; i < 128; i++) {
       mainBusDevices[i] = false;
     }
+    I2CMultiplexerOff(); // Make sure no channel is left selected while scanning the main bus
     nDevices = scanI2CbusForDevices(Settings.I2C_Multiplexer_Addr, -1, nDevices, mainBusDevices); // Channel -1 = standard I2C bus
     #else
     nDevices = scanI2CbusForDevices(-1, -1, nDevices); // Standard scan
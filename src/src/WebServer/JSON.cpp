@@ -8,6 +8,7 @@
 #include "../Globals/Device.h"
 #include "../Globals/Plugins.h"
 
+#include "../Helpers/BootTimeline.h"
 #include "../Helpers/ESPEasyStatistics.h"
 #include "../Helpers/ESPEasy_Storage.h"
 #include "../Helpers/Hardware.h"
@@ -200,6 +201,38 @@ void handle_json()
 
       stream_json_object_values(labels);
       stream_comma_newline();
+
+      addHtml(F("\"Boot\":{\n\"Timeline\":[\n"));
+      {
+        uint32_t start_usec = 0;
+
+        for (uint8_t i = 0; i < getBootPhaseCount(); ++i) {
+          const BootPhase_t& phase = getBootPhase(i);
+
+          if (i != 0) {
+            stream_comma_newline();
+          }
+          addHtml('{');
+          stream_next_json_object_value(F("Phase"), String(phase.label));
+          stream_next_json_object_value(F("Duration"), static_cast<int>((phase.end_usec - start_usec) / 1000));
+          stream_last_json_object_value(F("End"), static_cast<int>(phase.end_usec / 1000));
+          start_usec = phase.end_usec;
+        }
+      }
+      addHtml(F("],\n"));
+
+      static const LabelType::Enum bootLabels[] PROGMEM =
+      {
+        LabelType::BOOT_SETUP_DURATION,
+        LabelType::BOOT_FIRST_READ,
+        LabelType::PREV_BOOT_SETUP_DURATION,
+        LabelType::PREV_BOOT_FIRST_READ,
+
+        LabelType::MAX_LABEL
+      };
+
+      stream_json_object_values(bootLabels);
+      stream_comma_newline();
     }
 
     if (showWifi) {
@@ -244,6 +277,7 @@ void handle_json()
 #endif
         LabelType::WIFI_NR_EXTRA_SCANS,
         LabelType::WIFI_USE_LAST_CONN_FROM_RTC,
+        LabelType::WIFI_USE_LAST_LEASE_FROM_RTC,
         LabelType::WIFI_RSSI,
 
 
@@ -469,7 +503,7 @@ void handle_json()
 // JSON formatted timing statistics
 // ********************************************************************************
 
-#ifdef WEBSERVER_NEW_UI
+#if defined(WEBSERVER_NEW_UI) || defined(WEBSERVER_TIMINGSTATS)
 void handle_timingstats_json() {
   TXBuffer.startJsonStream();
   json_init();
@@ -481,7 +515,7 @@ void handle_timingstats_json() {
   TXBuffer.endStream();
 }
 
-#endif // WEBSERVER_NEW_UI
+#endif // if defined(WEBSERVER_NEW_UI) || defined(WEBSERVER_TIMINGSTATS)
 
 #ifdef WEBSERVER_NEW_UI
 void handle_nodes_list_json() {
@@ -19,10 +19,10 @@ void handle_json();
 // JSON formatted timing statistics
 // ********************************************************************************
 
-#ifdef WEBSERVER_NEW_UI
+#if defined(WEBSERVER_NEW_UI) || defined(WEBSERVER_TIMINGSTATS)
 void handle_timingstats_json();
 
-#endif // WEBSERVER_NEW_UI
+#endif // if defined(WEBSERVER_NEW_UI) || defined(WEBSERVER_TIMINGSTATS)
 
 #ifdef WEBSERVER_NEW_UI
 void handle_nodes_list_json();
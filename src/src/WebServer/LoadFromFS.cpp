@@ -1,5 +1,6 @@
 #include "../WebServer/LoadFromFS.h"
 
+#include "../Globals/Cache.h"
 #include "../Globals/RamTracker.h"
 
 #include "../Helpers/ESPEasy_Storage.h"
@@ -100,16 +101,25 @@ bool loadFromFS(String path) {
 
   fs::File f;
 
-  // Search flash file system first, then SD if present
-  f = tryOpenFile(path.c_str(), "r");
-  #ifdef FEATURE_SD
-  if (!f) {
-    f = SD.open(path.c_str(), "r");
-  }
-  #endif // ifdef FEATURE_SD
+  #ifdef USE_ASSET_PACK
+  const uint8_t *packedData = nullptr;
+  size_t packedSize         = 0;
+  const bool isPacked       = Cache.assetPack.find(path, packedData, packedSize);
+
+  if (!isPacked)
+  #endif // ifdef USE_ASSET_PACK
+  {
+    // Search flash file system first, then SD if present
+    f = tryOpenFile(path.c_str(), "r");
+    #ifdef FEATURE_SD
+    if (!f) {
+      f = SD.open(path.c_str(), "r");
+    }
+    #endif // ifdef FEATURE_SD
 
-  if (!f) {
-    return false;
+    if (!f) {
+      return false;
+    }
   }
 
   // prevent reloading stuff on every click
@@ -121,8 +131,19 @@ bool loadFromFS(String path) {
     web_server.sendHeader(F("Content-Disposition"), F("attachment;"));
   }
 
-  web_server.streamFile(f, dataType);
-  f.close();
+  #ifdef USE_ASSET_PACK
+  if (isPacked) {
+    // Send straight from mapped flash, like streamFile() would for a file.
+    if (gzipEncoded(path)) {
+      web_server.sendHeader(F("Content-Encoding"), F("gzip"));
+    }
+    web_server.send_P(200, reinterpret_cast<PGM_P>(dataType), reinterpret_cast<PGM_P>(packedData), packedSize);
+  } else
+  #endif // ifdef USE_ASSET_PACK
+  {
+    web_server.streamFile(f, dataType);
+    f.close();
+  }
 
   statusLED(true);
   return true;
@@ -135,6 +156,27 @@ size_t streamFromFS(String path, bool htmlEscape) {
 
   size_t bytesStreamed = 0;
 
+  #ifdef USE_ASSET_PACK
+  {
+    const uint8_t *packedData = nullptr;
+    size_t packedSize         = 0;
+
+    if (Cache.assetPack.find(path, packedData, packedSize)) {
+      String escaped;
+      for (; bytesStreamed < packedSize; ++bytesStreamed) {
+        const char c = static_cast<char>(packedData[bytesStreamed]);
+        if (htmlEscape && htmlEscapeChar(c, escaped)) {
+          addHtml(escaped);
+        } else {
+          addHtml(c);
+        }
+      }
+      statusLED(true);
+      return bytesStreamed;
+    }
+  }
+  #endif // ifdef USE_ASSET_PACK
+
   fs::File f;
 
   // Search flash file system first, then SD if present
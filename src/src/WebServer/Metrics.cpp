@@ -7,6 +7,10 @@
 # include "../../_Plugin_Helper.h"
 # include "../Helpers/ESPEasyStatistics.h"
 # include "../Static/WebStaticData.h"
+# include "../DataStructs/TimingStats.h"
+# include "../Globals/CPlugins.h"
+# include "../Globals/Protocol.h"
+# include "../Helpers/Hardware.h"
 
 #ifdef WEBSERVER_METRICS
 
@@ -66,9 +70,38 @@ void handle_metrics() {
     addHtml(getValue(LabelType::NUMBER_RECONNECTS));
     addHtml('\n');
 
+    //I2C bus switching
+    if (Settings.isI2CEnabled()) {
+        #ifdef FEATURE_I2CMULTIPLEXER
+        if (isI2CMultiplexerEnabled()) {
+            addHtml(F("# HELP espeasy_i2c_mux_switches I2C multiplexer channel selections, written or skipped as already selected\n"));
+            addHtml(F("# TYPE espeasy_i2c_mux_switches counter\n"));
+            addHtml(F("espeasy_i2c_mux_switches{result=\"written\"} "));
+            addHtml(getValue(LabelType::I2C_MUX_SWITCHES));
+            addHtml(F("\nespeasy_i2c_mux_switches{result=\"skipped\"} "));
+            addHtml(getValue(LabelType::I2C_MUX_SWITCHES_SKIPPED));
+            addHtml('\n');
+        }
+        #endif
+        addHtml(F("# HELP espeasy_i2c_clock_changes I2C clock speed changes, applied or skipped as already set\n"));
+        addHtml(F("# TYPE espeasy_i2c_clock_changes counter\n"));
+        addHtml(F("espeasy_i2c_clock_changes{result=\"written\"} "));
+        addHtml(getValue(LabelType::I2C_CLOCK_CHANGES));
+        addHtml(F("\nespeasy_i2c_clock_changes{result=\"skipped\"} "));
+        addHtml(getValue(LabelType::I2C_CLOCK_CHANGES_SKIPPED));
+        addHtml('\n');
+    }
+
     //devices
     handle_metrics_devices();
 
+    #ifdef USES_TIMING_STATS
+    //timing statistics
+    if (Settings.EnableTimingStats()) {
+        handle_metrics_timingstats();
+    }
+    #endif
+
       TXBuffer.endStream();
 }
 
@@ -114,4 +147,94 @@ void handle_metrics_devices(){
          }
     }
 }
+#ifdef USES_TIMING_STATS
+void stream_metrics_timing_stats(const String& labels, const TimingStats& stats) {
+    const uint8_t percentiles[] = { 50, 95, 99 };
+    for (uint8_t i = 0; i < 3; ++i) {
+        addHtml(F("espeasy_timing_usec{"));
+        addHtml(labels);
+        addHtml(F(",quantile=\"0."));
+        addHtmlInt(percentiles[i]);
+        addHtml(F("\"} "));
+        addHtmlInt(stats.getPercentile(percentiles[i]));
+        addHtml('\n');
+    }
+    // Sum and count are monotonic, not reset via the timing stats page.
+    addHtml(F("espeasy_timing_usec_sum{"));
+    addHtml(labels);
+    addHtml(F("} "));
+    addHtml(ull2String(stats.getTotalUsec()));
+    addHtml('\n');
+
+    addHtml(F("espeasy_timing_usec_count{"));
+    addHtml(labels);
+    addHtml(F("} "));
+    addHtmlInt(stats.getTotalCount());
+    addHtml('\n');
+}
+
+void stream_metrics_timing_dropped(const __FlashStringHelper *type, uint32_t dropped) {
+    addHtml(F("espeasy_timing_dropped_total{type=\""));
+    addHtml(type);
+    addHtml(F("\"} "));
+    addHtmlInt(dropped);
+    addHtml('\n');
+}
+
+void handle_metrics_timingstats(){
+    // Not cleared here, the quantiles are reset via the timing stats page
+    addHtml(F("# HELP espeasy_timing_usec Execution time, quantiles since last reset of the timing statistics\n"));
+    addHtml(F("# TYPE espeasy_timing_usec summary\n"));
+    String labels;
+
+    for (uint8_t slot = 0; slot < pluginStats.size(); ++slot) {
+        const TimingStats& stats = pluginStats.getStats(slot);
+        const deviceIndex_t deviceIndex = static_cast<deviceIndex_t>(pluginStats.getKey(slot) / 256);
+        if ((stats.getTotalCount() > 0) && validDeviceIndex(deviceIndex)) {
+            labels  = F("type=\"plugin\",id=\"");
+            labels += Device[deviceIndex].Number;
+            labels += F("\",name=\"");
+            labels += getPluginNameFromDeviceIndex(deviceIndex);
+            labels += F("\",function=\"");
+            labels += getPluginFunctionName(pluginStats.getKey(slot) % 256);
+            labels += '"';
+            stream_metrics_timing_stats(labels, stats);
+        }
+    }
+
+    for (uint8_t slot = 0; slot < controllerStats.size(); ++slot) {
+        const TimingStats& stats = controllerStats.getStats(slot);
+        const protocolIndex_t protocolIndex = static_cast<protocolIndex_t>(controllerStats.getKey(slot) / 256);
+        if (stats.getTotalCount() > 0) {
+            labels  = F("type=\"controller\",id=\"");
+            labels += Protocol[protocolIndex].Number;
+            labels += F("\",name=\"");
+            labels += getCPluginNameFromProtocolIndex(protocolIndex);
+            labels += F("\",function=\"");
+            labels += getCPluginCFunctionName(static_cast<CPlugin::Function>(controllerStats.getKey(slot) % 256));
+            labels += '"';
+            stream_metrics_timing_stats(labels, stats);
+        }
+    }
+
+    for (uint8_t slot = 0; slot < miscStats.size(); ++slot) {
+        const TimingStats& stats = miscStats.getStats(slot);
+        if (stats.getTotalCount() > 0) {
+            labels  = F("type=\"misc\",id=\"");
+            labels += miscStats.getKey(slot);
+            labels += F("\",name=\"");
+            labels += getMiscStatsName(miscStats.getKey(slot));
+            labels += '"';
+            stream_metrics_timing_stats(labels, stats);
+        }
+    }
+
+    addHtml(F("# HELP espeasy_timing_dropped_total Measurements not recorded as all timing stats slots were in use\n"));
+    addHtml(F("# TYPE espeasy_timing_dropped_total counter\n"));
+    stream_metrics_timing_dropped(F("plugin"),     pluginStats.getDropped());
+    stream_metrics_timing_dropped(F("controller"), controllerStats.getDropped());
+    stream_metrics_timing_dropped(F("misc"),       miscStats.getDropped());
+}
+#endif // ifdef USES_TIMING_STATS
+
 #endif // WEBSERVER_METRICS
@@ -8,6 +8,14 @@
 void handle_metrics();
 void handle_metrics_devices();
 
+#ifdef USES_TIMING_STATS
+#include "../DataStructs/TimingStats.h"
+
+void stream_metrics_timing_stats(const String& labels, const TimingStats& stats);
+void stream_metrics_timing_dropped(const __FlashStringHelper *type, uint32_t dropped);
+void handle_metrics_timingstats();
+#endif
+
 #endif    // ifdef WEBSERVER_METRICS
 
 #endif
@@ -0,0 +1,116 @@
+#include "../WebServer/Profiler.h"
+
+#if defined(WEBSERVER_TIMINGSTATS) && defined(USES_SAMPLING_PROFILER)
+
+# include "../WebServer/WebServer.h"
+# include "../WebServer/AccessControl.h"
+# include "../WebServer/JSON.h"
+# include "../WebServer/Markup_Forms.h"
+
+# include "../Helpers/Convert.h"
+# include "../Helpers/SamplingProfiler.h"
+
+# include <algorithm>
+# include <vector>
+
+# define PROFILE_DEFAULT_SECONDS  10
+
+typedef std::pair<uint16_t, uint32_t> ProfileEntry; // tag, ticks
+
+static bool profileEntryCompare(const ProfileEntry& a, const ProfileEntry& b)
+{
+  return a.second > b.second;
+}
+
+static void stream_profile_entry(uint16_t tag, const String& name, uint32_t ticks, uint32_t totalTicks)
+{
+  stream_next_json_object_value(F("name"), name);
+  stream_next_json_object_value(F("cat"), static_cast<int>(SamplingProfiler::getCategory(tag)));
+  stream_next_json_object_value(F("id"), SamplingProfiler::getId(tag));
+  stream_next_json_object_value(F("usec"), String(ticks * PROFILER_SAMPLE_INTERVAL_USEC));
+  stream_to_json_object_value(F("pct"), toString(totalTicks == 0 ? 0.0f : 100.0f * ticks / totalTicks, 1));
+}
+
+void handle_profile_json() {
+  #ifndef BUILD_NO_RAM_TRACKER
+  checkRAM(F("handle_profile_json"));
+  #endif // ifndef BUILD_NO_RAM_TRACKER
+
+  if (!isLoggedIn()) { return; }
+
+  if (getFormItemInt(F("stop"), 0) != 0) {
+    samplingProfiler.stop();
+  }
+
+  if (getFormItemInt(F("start"), 0) != 0) {
+    samplingProfiler.start();
+  }
+
+  int seconds = getFormItemInt(F("seconds"), PROFILE_DEFAULT_SECONDS);
+
+  if (seconds < 1) { seconds = PROFILE_DEFAULT_SECONDS; }
+
+  // Collect a snapshot first, the stream itself is also profiled.
+  std::map<uint32_t, uint32_t> ticksPerPath;
+  const uint32_t totalTicks = samplingProfiler.collect(seconds * 1000ul, ticksPerPath);
+
+  // Totals per root tag
+  std::vector<ProfileEntry> roots;
+
+  for (auto it = ticksPerPath.begin(); it != ticksPerPath.end(); ++it) {
+    const uint16_t root = it->first >> 16;
+
+    if (roots.empty() || (roots.back().first != root)) {
+      roots.emplace_back(root, 0);
+    }
+    roots.back().second += it->second;
+  }
+  std::sort(roots.begin(), roots.end(), profileEntryCompare);
+
+  TXBuffer.startJsonStream();
+  addHtml('{');
+  stream_next_json_object_value(F("running"), jsonBool(samplingProfiler.isRunning()));
+  stream_next_json_object_value(F("interval_usec"), PROFILER_SAMPLE_INTERVAL_USEC);
+  stream_next_json_object_value(F("seconds"), seconds);
+  stream_next_json_object_value(F("usec"), String(totalTicks * PROFILER_SAMPLE_INTERVAL_USEC));
+  addHtml(F("\"profile\":[\n"));
+
+  for (auto root = roots.begin(); root != roots.end(); ++root) {
+    if (root != roots.begin()) {
+      addHtml(',', '\n');
+    }
+    addHtml('{');
+    stream_profile_entry(root->first, SamplingProfiler::getTagName(root->first), root->second, totalTicks);
+    addHtml(F(",\"children\":["));
+
+    // Leaf tags within this root, map keys with the same root are consecutive.
+    std::vector<ProfileEntry> children;
+    const uint32_t firstKey = static_cast<uint32_t>(root->first) << 16;
+
+    for (auto it = ticksPerPath.lower_bound(firstKey);
+         it != ticksPerPath.end() && (it->first >> 16) == root->first;
+         ++it) {
+      children.emplace_back(it->first & 0xFFFF, it->second);
+    }
+    std::sort(children.begin(), children.end(), profileEntryCompare);
+
+    for (auto child = children.begin(); child != children.end(); ++child) {
+      if (child != children.begin()) {
+        addHtml(',');
+      }
+      addHtml('{');
+
+      // Time spent in the root itself, not in any nested tagged section.
+      stream_profile_entry(child->first,
+                           child->first == root->first ? String(F("self")) : SamplingProfiler::getTagName(child->first),
+                           child->second,
+                           totalTicks);
+      addHtml('}');
+    }
+    addHtml(']', '}');
+  }
+  addHtml(F("\n]}"));
+  TXBuffer.endStream();
+}
+
+#endif // if defined(WEBSERVER_TIMINGSTATS) && defined(USES_SAMPLING_PROFILER)
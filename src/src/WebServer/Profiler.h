@@ -0,0 +1,18 @@
+#ifndef WEBSERVER_WEBSERVER_PROFILER_H
+#define WEBSERVER_WEBSERVER_PROFILER_H
+
+#include "../WebServer/common.h"
+
+#if defined(WEBSERVER_TIMINGSTATS) && defined(USES_SAMPLING_PROFILER)
+
+// ********************************************************************************
+// Web Interface sampling profiler
+// /profile?start=1      Start the profiler (allocates the sample buffer)
+// /profile?stop=1       Stop the profiler and free the sample buffer
+// /profile?seconds=N    Breakdown of the last N seconds (default 10)
+// ********************************************************************************
+void handle_profile_json();
+
+#endif // if defined(WEBSERVER_TIMINGSTATS) && defined(USES_SAMPLING_PROFILER)
+
+#endif // ifndef WEBSERVER_WEBSERVER_PROFILER_H
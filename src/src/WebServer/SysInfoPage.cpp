@@ -24,6 +24,7 @@
 #include "../Globals/RTC.h"
 #include "../Globals/Settings.h"
 
+#include "../Helpers/BootTimeline.h"
 #include "../Helpers/Convert.h"
 #include "../Helpers/ESPEasyStatistics.h"
 #include "../Helpers/ESPEasy_Storage.h"
@@ -269,6 +270,8 @@ void handle_sysinfo() {
 
   handle_sysinfo_SystemStatus();
 
+  handle_sysinfo_BootTimeline();
+
   handle_sysinfo_NetworkServices();
 
   handle_sysinfo_ESP_Board();
@@ -322,6 +325,31 @@ void handle_sysinfo_basicInfo() {
   addRowLabelValue(LabelType::SW_WD_COUNT);
 }
 
+void handle_sysinfo_BootTimeline() {
+  addTableSeparator(F("Boot Timeline"), 2, 3);
+
+  addRowLabelValue(LabelType::BOOT_SETUP_DURATION);
+  addUnit(F("ms"));
+  addRowLabelValue(LabelType::BOOT_FIRST_READ);
+  addUnit(F("ms"));
+  addRowLabelValue(LabelType::PREV_BOOT_SETUP_DURATION);
+  addUnit(F("ms"));
+  addRowLabelValue(LabelType::PREV_BOOT_FIRST_READ);
+  addUnit(F("ms"));
+
+  uint32_t start_usec = 0;
+
+  for (uint8_t i = 0; i < getBootPhaseCount(); ++i) {
+    const BootPhase_t& phase = getBootPhase(i);
+    addRowLabel(phase.label);
+    addHtmlInt((phase.end_usec - start_usec) / 1000);
+    addHtml(F(" ms (at "));
+    addHtmlInt(phase.end_usec / 1000);
+    addHtml(F(" ms)"));
+    start_usec = phase.end_usec;
+  }
+}
+
 void handle_sysinfo_memory() {
   addTableSeparator(F("Memory"), 2, 3);
 
@@ -480,6 +508,7 @@ void handle_sysinfo_WiFiSettings() {
 #endif
   addRowLabelValue(LabelType::WIFI_NR_EXTRA_SCANS);
   addRowLabelValue(LabelType::WIFI_USE_LAST_CONN_FROM_RTC);
+  addRowLabelValue(LabelType::WIFI_USE_LAST_LEASE_FROM_RTC);
 }
 
 void handle_sysinfo_Firmware() {
@@ -518,6 +547,17 @@ void handle_sysinfo_SystemStatus() {
     addRowLabelValue(LabelType::I2C_BUS_STATE);
     addRowLabelValue(LabelType::I2C_BUS_CLEARED_COUNT);
   }
+
+  if (Settings.isI2CEnabled()) {
+    #ifdef FEATURE_I2CMULTIPLEXER
+    if (isI2CMultiplexerEnabled()) {
+      addRowLabelValue(LabelType::I2C_MUX_SWITCHES);
+      addRowLabelValue(LabelType::I2C_MUX_SWITCHES_SKIPPED);
+    }
+    #endif // ifdef FEATURE_I2CMULTIPLEXER
+    addRowLabelValue(LabelType::I2C_CLOCK_CHANGES);
+    addRowLabelValue(LabelType::I2C_CLOCK_CHANGES_SKIPPED);
+  }
 }
 
 void handle_sysinfo_NetworkServices() {
@@ -34,6 +34,9 @@ void handle_timingstats() {
   html_table_header(F("min (ms)"));
   html_table_header(F("Avg (ms)"));
   html_table_header(F("max (ms)"));
+  html_table_header(F("p50 (ms)"));
+  html_table_header(F("p95 (ms)"));
+  html_table_header(F("p99 (ms)"));
 
   long timeSinceLastReset = stream_timing_statistics(true);
   html_end_table();
@@ -48,6 +51,15 @@ void handle_timingstats() {
   addRowLabel(F("Time span"));
   addHtml(toString(timespan));
   addHtml(F(" sec"));
+  {
+    const uint32_t dropped = pluginStats.getDropped() + controllerStats.getDropped() + miscStats.getDropped();
+
+    if (dropped > 0) {
+      addRowLabel(F("Dropped measurements"));
+      addHtmlInt(dropped);
+      addHtml(F(" (all stats slots were in use)"));
+    }
+  }
   addRowLabel(F("*"));
   addHtml(F("Duty cycle based on average < 1 msec is highly unreliable"));
   html_end_table();
@@ -101,17 +113,30 @@ void stream_html_timing_stats(const TimingStats& stats, long timeSinceLastReset)
   format_using_threshhold(avg);
   html_TD();
   format_using_threshhold(maxVal);
+  html_TD();
+  format_using_threshhold(stats.getPercentile(50));
+  html_TD();
+  format_using_threshhold(stats.getPercentile(95));
+  html_TD();
+  format_using_threshhold(stats.getPercentile(99));
 }
 
 long stream_timing_statistics(bool clearStats) {
   long timeSinceLastReset = timePassedSince(timingstats_last_reset);
 
-  for (auto& x: pluginStats) {
-    if (!x.second.isEmpty()) {
-      const deviceIndex_t deviceIndex = static_cast<deviceIndex_t>(x.first / 256);
+  if (clearStats) {
+    releaseUnusedTimingStats();
+  }
+
+  for (uint8_t slot = 0; slot < pluginStats.size(); ++slot) {
+    const int    key   = pluginStats.getKey(slot);
+    TimingStats& stats = pluginStats.getStats(slot);
+
+    if (!stats.isEmpty()) {
+      const deviceIndex_t deviceIndex = static_cast<deviceIndex_t>(key / 256);
 
       if (validDeviceIndex(deviceIndex)) {
-        if (x.second.thresholdExceeded(TIMING_STATS_THRESHOLD)) {
+        if (stats.thresholdExceeded(TIMING_STATS_THRESHOLD)) {
           html_TR_TD_highlight();
         } else {
           html_TR_TD();
@@ -123,19 +148,22 @@ long stream_timing_statistics(bool clearStats) {
           addHtml(getPluginNameFromDeviceIndex(deviceIndex));
         }
         html_TD();
-        addHtml(getPluginFunctionName(x.first % 256));
-        stream_html_timing_stats(x.second, timeSinceLastReset);
+        addHtml(getPluginFunctionName(key % 256));
+        stream_html_timing_stats(stats, timeSinceLastReset);
       }
 
-      if (clearStats) { x.second.reset(); }
+      if (clearStats) { stats.reset(); }
     }
   }
 
-  for (auto& x: controllerStats) {
-    if (!x.second.isEmpty()) {
-      const int ProtocolIndex = x.first / 256;
+  for (uint8_t slot = 0; slot < controllerStats.size(); ++slot) {
+    const int    key   = controllerStats.getKey(slot);
+    TimingStats& stats = controllerStats.getStats(slot);
+
+    if (!stats.isEmpty()) {
+      const int ProtocolIndex = key / 256;
 
-      if (x.second.thresholdExceeded(TIMING_STATS_THRESHOLD)) {
+      if (stats.thresholdExceeded(TIMING_STATS_THRESHOLD)) {
         html_TR_TD_highlight();
       } else {
         html_TR_TD();
@@ -147,25 +175,28 @@ long stream_timing_statistics(bool clearStats) {
         addHtml(getCPluginNameFromProtocolIndex(ProtocolIndex));
       }
       html_TD();
-      addHtml(getCPluginCFunctionName(static_cast<CPlugin::Function>(x.first % 256)));
-      stream_html_timing_stats(x.second, timeSinceLastReset);
+      addHtml(getCPluginCFunctionName(static_cast<CPlugin::Function>(key % 256)));
+      stream_html_timing_stats(stats, timeSinceLastReset);
 
-      if (clearStats) { x.second.reset(); }
+      if (clearStats) { stats.reset(); }
     }
   }
 
-  for (auto& x: miscStats) {
-    if (!x.second.isEmpty()) {
-      if (x.second.thresholdExceeded(TIMING_STATS_THRESHOLD)) {
+  for (uint8_t slot = 0; slot < miscStats.size(); ++slot) {
+    const int    key   = miscStats.getKey(slot);
+    TimingStats& stats = miscStats.getStats(slot);
+
+    if (!stats.isEmpty()) {
+      if (stats.thresholdExceeded(TIMING_STATS_THRESHOLD)) {
         html_TR_TD_highlight();
       } else {
         html_TR_TD();
       }
-      addHtml(getMiscStatsName(x.first));
+      addHtml(getMiscStatsName(key));
       html_TD();
-      stream_html_timing_stats(x.second, timeSinceLastReset);
+      stream_html_timing_stats(stats, timeSinceLastReset);
 
-      if (clearStats) { x.second.reset(); }
+      if (clearStats) { stats.reset(); }
     }
   }
 
@@ -31,6 +31,7 @@
 #include "../WebServer/SysInfoPage.h"
 #include "../WebServer/Metrics.h"
 #include "../WebServer/SysVarPage.h"
+#include "../WebServer/Profiler.h"
 #include "../WebServer/TimingStats.h"
 #include "../WebServer/ToolsPage.h"
 #include "../WebServer/UploadPage.h"
@@ -270,6 +271,10 @@ void WebServerInit()
 #endif // WEBSERVER_SYSVARS
 #ifdef WEBSERVER_TIMINGSTATS
   web_server.on(F("/timingstats"), handle_timingstats);
+  web_server.on(F("/timingstats_json"), handle_timingstats_json);
+#ifdef USES_SAMPLING_PROFILER
+  web_server.on(F("/profile"),     handle_profile_json);
+#endif // ifdef USES_SAMPLING_PROFILER
 #endif // WEBSERVER_TIMINGSTATS
 #ifdef WEBSERVER_TOOLS
   web_server.on(F("/tools"),       handle_tools);
@@ -290,11 +295,21 @@ void WebServerInit()
   web_server.on(F("/node_list_json"),    handle_nodes_list_json);
   web_server.on(F("/pinstates_json"),    handle_pinstates_json);
   web_server.on(F("/sysinfo_json"),      handle_sysinfo_json);
+#ifndef WEBSERVER_TIMINGSTATS
   web_server.on(F("/timingstats_json"),  handle_timingstats_json);
+#endif // ifndef WEBSERVER_TIMINGSTATS
   web_server.on(F("/upload_json"),       HTTP_POST, handle_upload_json, handleFileUpload);
   web_server.on(F("/wifiscanner_json"),  handle_wifiscanner_json);
 #endif // WEBSERVER_NEW_UI
 
+#ifdef WEBSERVER_STATIC_ASSETS
+  {
+    // Needed to answer conditional requests for static assets with "304 Not Modified"
+    static const char *collectedHeaders[] = { "If-None-Match" };
+    web_server.collectHeaders(collectedHeaders, 1);
+  }
+#endif // ifdef WEBSERVER_STATIC_ASSETS
+
   web_server.onNotFound(handleNotFound);
 
   #if defined(ESP8266) || defined(ESP32)
@@ -321,7 +336,6 @@ void WebServerInit()
       client.setTimeout(CONTROLLER_CLIENTTIMEOUT_DFLT);
       SSDP_schema(client);
     });
-    SSDP_begin();
   }
   # endif // USES_SSDP
   #endif  // if defined(ESP8266)
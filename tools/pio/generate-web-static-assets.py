@@ -0,0 +1,179 @@
+# Generate pre-compressed, content-hashed static web assets.
+#
+# Each file in ASSETS is minified, gzip compressed and embedded in
+# src/src/Static/WebStaticAssets_gz.h together with a URL containing a hash of its content.
+# Since the URL changes whenever the content changes, the browser may cache these forever.
+#
+# The generated header is committed and not touched by the build.
+# Run this script after changing one of the files in static/:
+#   python tools/pio/generate-web-static-assets.py
+# CI checks the committed header is up to date with:
+#   python tools/pio/generate-web-static-assets.py --check
+#
+# Only the built-in minifiers below are used (or an existing .min file), so the output,
+# and thus the content hash in the URL, does not depend on the installed Python packages.
+#
+# Brotli is not generated: browsers only accept 'br' encoding over HTTPS.
+
+import gzip
+import hashlib
+import os
+import re
+import struct
+import sys
+import zlib
+
+PROJECT_DIR = os.path.abspath(os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", ".."))
+
+STATIC_DIR = os.path.join(PROJECT_DIR, "static")
+OUTPUT_FILE = os.path.join(PROJECT_DIR, "src", "src", "Static", "WebStaticAssets_gz.h")
+
+# (source file, content type, preprocessor condition)
+ASSETS = [
+    ("espeasy_default.css", "text/css", "defined(WEBSERVER_CSS) && !defined(WEBSERVER_EMBED_CUSTOM_CSS)"),
+    ("fetch_and_parse_log.js", "application/javascript", "defined(WEBSERVER_INCLUDE_JS) && defined(WEBSERVER_LOG)"),
+    ("github_clipboard.js", "application/javascript", "defined(WEBSERVER_INCLUDE_JS) && defined(WEBSERVER_GITHUB_COPY)"),
+    ("reboot.js", "application/javascript", "defined(WEBSERVER_INCLUDE_JS)"),
+    ("update_sensor_values_device_page.js", "application/javascript", "defined(WEBSERVER_INCLUDE_JS) && defined(WEBSERVER_DEVICES)"),
+]
+
+
+def minify_css(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    text = re.sub(r"\s+", " ", text)
+    text = re.sub(r"\s*([{};:,>])\s*", r"\1", text)
+    return text.replace(";}", "}").strip()
+
+
+def minify_js(text):
+    # Conservative: only strip indentation, empty lines and full line comments.
+    # Line breaks are kept, so automatic semicolon insertion is not affected.
+    lines = []
+    for line in text.splitlines():
+        line = line.strip()
+        if line and not line.startswith("//"):
+            lines.append(line)
+    return "\n".join(lines)
+
+
+def read_minified(fname):
+    base, ext = os.path.splitext(fname)
+    min_file = os.path.join(STATIC_DIR, base + ".min" + ext)
+    if os.path.isfile(min_file):
+        with open(min_file, "r", encoding="utf-8") as f:
+            return f.read().strip()
+    with open(os.path.join(STATIC_DIR, fname), "r", encoding="utf-8") as f:
+        text = f.read()
+    return minify_css(text) if ext == ".css" else minify_js(text)
+
+
+def c_name(fname):
+    return "WEBSTATIC_" + re.sub(r"[^A-Za-z0-9]", "_", fname).upper()
+
+
+def gzip_compress(data):
+    # Fixed gzip header (no mtime, OS unknown), as the header written by the gzip module
+    # differs between Python versions.
+    header = b"\x1f\x8b\x08\x00\x00\x00\x00\x00\x02\xff"
+    compressor = zlib.compressobj(9, zlib.DEFLATED, -zlib.MAX_WBITS)
+    deflated = compressor.compress(data) + compressor.flush()
+    return header + deflated + struct.pack("<II", zlib.crc32(data) & 0xffffffff, len(data) & 0xffffffff)
+
+
+def c_array(data):
+    hexbytes = ["0x{:02x}".format(b) for b in data]
+    return ",\n".join("  " + ",".join(hexbytes[i:i + 16]) for i in range(0, len(hexbytes), 16))
+
+
+def generate():
+    out = []
+    out.append("// Generated by tools/pio/generate-web-static-assets.py from the files in static/")
+    out.append("// Do not edit, run the script again after changing a file in static/")
+    out.append("")
+    out.append("#ifndef STATIC_WEBSTATICASSETS_GZ_H")
+    out.append("#define STATIC_WEBSTATICASSETS_GZ_H")
+    out.append("")
+    out.append('#include "../Static/WebStaticAssets.h"')
+    out.append("")
+    out.append("#ifdef WEBSERVER_STATIC_ASSETS")
+    out.append("")
+
+    for fname, content_type, condition in ASSETS:
+        minified = read_minified(fname).encode("utf-8")
+        digest = hashlib.sha256(minified).hexdigest()[:8]
+        compressed = gzip_compress(minified)
+        base, ext = os.path.splitext(fname)
+        name = c_name(fname)
+
+        out.append("#if {}".format(condition))
+        out.append("// {}: {} bytes minified, {} bytes gzip".format(fname, len(minified), len(compressed)))
+        out.append("# define {}_AVAILABLE".format(name))
+        out.append('static const char {}_URL[] PROGMEM  = "/static/{}.{}{}";'.format(name, base, digest, ext))
+        out.append('static const char {}_ETAG[] PROGMEM = "\\"{}\\"";'.format(name, digest))
+        out.append('static const char {}_TYPE[] PROGMEM = "{}";'.format(name, content_type))
+        out.append("static const uint8_t {}_GZ[] PROGMEM = {{".format(name))
+        out.append(c_array(compressed))
+        out.append("};")
+        out.append("#endif // if {}".format(condition))
+        out.append("")
+
+    out.append("static const WebStaticAsset_t web_static_assets[] PROGMEM = {")
+    for fname, content_type, condition in ASSETS:
+        name = c_name(fname)
+        out.append("#ifdef {}_AVAILABLE".format(name))
+        out.append("  {{ {0}_URL, {0}_ETAG, {0}_TYPE, {0}_GZ, sizeof({0}_GZ) }},".format(name))
+        out.append("#endif")
+    out.append("  { nullptr, nullptr, nullptr, nullptr, 0 }")
+    out.append("};")
+    out.append("")
+    out.append("#endif // ifdef WEBSERVER_STATIC_ASSETS")
+    out.append("")
+    out.append("#endif // STATIC_WEBSTATICASSETS_GZ_H")
+    out.append("")
+
+    return "\n".join(out)
+
+
+def check(content):
+    # The compressed bytes may differ with another zlib version,
+    # so compare the decompressed data of each asset and the rest of the header.
+    if not os.path.isfile(OUTPUT_FILE):
+        print("Missing {}".format(OUTPUT_FILE))
+        return False
+    with open(OUTPUT_FILE, "r", encoding="utf-8") as f:
+        committed = f.read()
+
+    array_re = re.compile(r"(_GZ\[\] PROGMEM = \{\n)(.*?)(\n\};)", re.S)
+
+    def payloads(text):
+        result = []
+        for m in array_re.finditer(text):
+            data = bytes(int(x, 16) for x in re.findall(r"0x([0-9a-f]{2})", m.group(2)))
+            result.append(gzip.decompress(data))
+        return result
+
+    def strip_sizes(text):
+        text = array_re.sub(r"\1\3", text)
+        return re.sub(r"bytes minified, \d+ bytes gzip", "bytes minified", text)
+
+    if (strip_sizes(committed) != strip_sizes(content)) or (payloads(committed) != payloads(content)):
+        print("{} is outdated, run: python tools/pio/generate-web-static-assets.py".format(OUTPUT_FILE))
+        return False
+    return True
+
+
+def write(content):
+    # Only write when changed, to prevent needless recompiles.
+    if os.path.isfile(OUTPUT_FILE):
+        with open(OUTPUT_FILE, "r", encoding="utf-8") as f:
+            if f.read() == content:
+                return
+    with open(OUTPUT_FILE, "w", encoding="utf-8", newline="\n") as f:
+        f.write(content)
+    print("Generated {}".format(OUTPUT_FILE))
+
+
+if __name__ == "__main__":
+    if "--check" in sys.argv[1:]:
+        sys.exit(0 if check(generate()) else 1)
+    write(generate())